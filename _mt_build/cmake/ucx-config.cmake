@@ -0,0 +1,10 @@
+#
+# Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2021. ALL RIGHTS RESERVED.
+#
+# See file LICENSE for terms.
+#
+
+include("${CMAKE_CURRENT_LIST_DIR}/ucx-targets.cmake")
+
+set(UCX_LIBRARIES "${exec_prefix}/lib")
+set(UCX_INCLUDE_DIRS "${prefix}/include")
@@ -0,0 +1,2 @@
+build_modules=":ib:cma"
+build_bindings=""
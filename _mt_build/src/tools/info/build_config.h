@@ -0,0 +1,170 @@
+{"UCX_CONFIG_H", UCS_PP_MAKE_STRING()},
+{"ENABLE_ASSERT", UCS_PP_MAKE_STRING(1)},
+{"ENABLE_BUILTIN_MEMCPY", UCS_PP_MAKE_STRING(1)},
+{"ENABLE_DEBUG_DATA", UCS_PP_MAKE_STRING(0)},
+{"ENABLE_MT", UCS_PP_MAKE_STRING(1)},
+{"ENABLE_PARAMS_CHECK", UCS_PP_MAKE_STRING(1)},
+{"HAVE_ALLOCA", UCS_PP_MAKE_STRING(1)},
+{"HAVE_ALLOCA_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_ATTRIBUTE_NOOPTIMIZE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_CLEARENV", UCS_PP_MAKE_STRING(1)},
+{"HAVE_CPU_SET_T", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DC_DV", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_ASPRINTF", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_BASENAME", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_CPU_ISSET", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_CPU_ZERO", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_ETHTOOL_CMD_SPEED", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_FMEMOPEN", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_FUSE_MOUNT", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DECL_FUSE_OPEN_CHANNEL", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DECL_FUSE_UNMOUNT", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DECL_F_SETOWN_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_GETAUXVAL", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_ACCESS_ON_DEMAND", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_ACCESS_RELAXED_ORDERING", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_ADVISE_MR", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_ALLOC_DM", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_ALLOC_TD", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_CREATE_CQ_ATTR_IGNORE_OVERRUN", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_CREATE_CQ_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_CREATE_QP_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_CREATE_SRQ", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_CREATE_SRQ_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_EVENT_GID_CHANGE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_EVENT_TYPE_STR", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_GET_ASYNC_EVENT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_GET_DEVICE_NAME", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_LINK_LAYER_ETHERNET", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_LINK_LAYER_INFINIBAND", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_QPF_GRH_REQUIRED", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_QUERY_DEVICE_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_QUERY_GID", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_REG_DMABUF_MR", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_SET_ECE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_TRANSPORT_UNSPECIFIED", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_TRANSPORT_USNIC", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_TRANSPORT_USNIC_UDP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IBV_WC_STATUS_STR", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_INOTIFY_ADD_WATCH", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_INOTIFY_INIT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IN_ATTRIB", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_IPPROTO_TCP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MADV_FREE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MADV_REMOVE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MEMFD_CREATE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MFD_HUGETLB", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_CQ_INIT_ATTR_MASK_COMPRESSED_CQE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_CQ_INIT_ATTR_MASK_CQE_SIZE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_CREATE_QP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_DCTYPE_DCT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_DEVX_SUBSCRIBE_DEVX_EVENT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_DEVX_UMEM_REG_EX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_INIT_OBJ", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_IS_SUPPORTED", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_OBJ_AH", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_QP_CREATE_ALLOW_SCATTER_TO_CQE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_UAR_ALLOC_TYPE_BF", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_MLX5DV_UAR_ALLOC_TYPE_NC", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_POSIX_MADV_DONTNEED", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_PR_SET_PTRACER", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SOL_SOCKET", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SO_KEEPALIVE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SPEED_UNKNOWN", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_STRERROR_R", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_BRK", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_IPC", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DECL_SYS_MADVISE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_MMAP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_MREMAP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_MUNMAP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_SHMAT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_SYS_SHMDT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_TCP_KEEPCNT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_TCP_KEEPIDLE", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL_TCP_KEEPINTVL", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DECL___PPC_GET_TIMEBASE", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DECL___PPC_GET_TIMEBASE_FREQ", UCS_PP_MAKE_STRING(0)},
+{"HAVE_DEVX", UCS_PP_MAKE_STRING(1)},
+{"HAVE_DLFCN_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_HW_TIMER", UCS_PP_MAKE_STRING(1)},
+{"HAVE_IB", UCS_PP_MAKE_STRING(1)},
+{"HAVE_IBV_DM", UCS_PP_MAKE_STRING(1)},
+{"HAVE_IN6_ADDR_S6_ADDR32", UCS_PP_MAKE_STRING(1)},
+{"HAVE_INFINIBAND_MLX5DV_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_INOTIFY", UCS_PP_MAKE_STRING(1)},
+{"HAVE_INTTYPES_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_IP_IP_DST", UCS_PP_MAKE_STRING(1)},
+{"HAVE_LIBGEN_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_LIBRT", UCS_PP_MAKE_STRING(1)},
+{"HAVE_LINUX_FUTEX_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_LINUX_IP_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_LINUX_MMAN_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MALLOC_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MALLOC_TRIM", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MEMALIGN", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MLX5_DV", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MLX5_HW_UD", UCS_PP_MAKE_STRING(1)},
+{"HAVE_MREMAP", UCS_PP_MAKE_STRING(1)},
+{"HAVE_NETINET_IP_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_NET_ETHERNET_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_POSIX_MEMALIGN", UCS_PP_MAKE_STRING(1)},
+{"HAVE_PREFETCH", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SCHED_GETAFFINITY", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SCHED_SETAFFINITY", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SIGACTION_SA_RESTORER", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SIGEVENT_SIGEV_UN_TID", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SIGHANDLER_T", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STDINT_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STDIO_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STDLIB_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRERROR_R", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRINGS_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRING_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRUCT_DL_PHDR_INFO", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRUCT_IBV_DEVICE_ATTR_EX_ODP_CAPS", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRUCT_IBV_DEVICE_ATTR_EX_PCI_ATOMIC_CAPS", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRUCT_IBV_TM_CAPS_FLAGS", UCS_PP_MAKE_STRING(1)},
+{"HAVE_STRUCT_MLX5DV_CQ_CQ_UAR", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SYS_EPOLL_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SYS_EVENTFD_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SYS_STAT_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SYS_TYPES_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_SYS_UIO_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_TL_DC", UCS_PP_MAKE_STRING(1)},
+{"HAVE_TL_RC", UCS_PP_MAKE_STRING(1)},
+{"HAVE_TL_UD", UCS_PP_MAKE_STRING(1)},
+{"HAVE_UCM_PTMALLOC286", UCS_PP_MAKE_STRING(1)},
+{"HAVE_UNISTD_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE_WCHAR_H", UCS_PP_MAKE_STRING(1)},
+{"HAVE___CLEAR_CACHE", UCS_PP_MAKE_STRING(1)},
+{"HAVE___CURBRK", UCS_PP_MAKE_STRING(1)},
+{"HAVE___SIGHANDLER_T", UCS_PP_MAKE_STRING(1)},
+{"IBV_HW_TM", UCS_PP_MAKE_STRING(1)},
+{"LT_OBJDIR", UCS_PP_MAKE_STRING(".libs/")},
+{"NVALGRIND", UCS_PP_MAKE_STRING(1)},
+{"PACKAGE", UCS_PP_MAKE_STRING("ucx")},
+{"PACKAGE_BUGREPORT", UCS_PP_MAKE_STRING("")},
+{"PACKAGE_NAME", UCS_PP_MAKE_STRING("ucx")},
+{"PACKAGE_STRING", UCS_PP_MAKE_STRING("ucx 1.17")},
+{"PACKAGE_TARNAME", UCS_PP_MAKE_STRING("ucx")},
+{"PACKAGE_URL", UCS_PP_MAKE_STRING("")},
+{"PACKAGE_VERSION", UCS_PP_MAKE_STRING("1.17")},
+{"STDC_HEADERS", UCS_PP_MAKE_STRING(1)},
+{"STRERROR_R_CHAR_P", UCS_PP_MAKE_STRING(1)},
+{"UCM_BISTRO_HOOKS", UCS_PP_MAKE_STRING(1)},
+{"UCS_MAX_LOG_LEVEL", UCS_PP_MAKE_STRING(UCS_LOG_LEVEL_TRACE_POLL)},
+{"UCT_TCP_EP_KEEPALIVE", UCS_PP_MAKE_STRING(1)},
+{"UCT_UD_EP_DEBUG_HOOKS", UCS_PP_MAKE_STRING(0)},
+{"UCX_CONFIGURE_FLAGS", UCS_PP_MAKE_STRING("--disable-doxygen-doc --without-go --without-java --enable-gtest --enable-debug --enable-assertions --enable-mt")},
+{"UCX_MODULE_SUBDIR", UCS_PP_MAKE_STRING("ucx")},
+{"VERSION", UCS_PP_MAKE_STRING("1.17")},
+{"restrict", UCS_PP_MAKE_STRING(__restrict__)},
+{"test_MODULES", UCS_PP_MAKE_STRING(":module")},
+{"ucm_MODULES", UCS_PP_MAKE_STRING("")},
+{"ucs_MODULES", UCS_PP_MAKE_STRING("")},
+{"uct_MODULES", UCS_PP_MAKE_STRING(":ib:cma")},
+{"uct_cuda_MODULES", UCS_PP_MAKE_STRING("")},
+{"uct_ib_MODULES", UCS_PP_MAKE_STRING("")},
+{"uct_rocm_MODULES", UCS_PP_MAKE_STRING("")},
+{"ucx_perftest_MODULES", UCS_PP_MAKE_STRING("")},
@@ -81,6 +81,14 @@ AC_CHECK_FUNCS([sched_setaffinity sched_getaffinity])
 AC_CHECK_FUNCS([cpuset_setaffinity cpuset_getaffinity])
 
 
+#
+# Anonymous shared memory files
+#
+AC_CHECK_DECLS([memfd_create, MFD_HUGETLB], [], [],
+               [#define _GNU_SOURCE 1
+#include <sys/mman.h>])
+
+
 #
 # Route file descriptor signal to specific thread
 #
@@ -23,6 +23,7 @@ BEGIN_C_DECLS
 typedef enum {
     UCX_PERF_API_UCT,
     UCX_PERF_API_UCP,
+    UCX_PERF_API_UCG,
     UCX_PERF_API_LAST
 } ucx_perf_api_t;
 
@@ -38,6 +39,9 @@ typedef enum {
     UCX_PERF_CMD_TAG,
     UCX_PERF_CMD_TAG_SYNC,
     UCX_PERF_CMD_STREAM,
+    UCX_PERF_CMD_BCAST,
+    UCX_PERF_CMD_REDUCE,
+    UCX_PERF_CMD_ALLREDUCE,
     UCX_PERF_CMD_LAST
 } ucx_perf_cmd_t;
 
@@ -1845,11 +1845,15 @@ static void ucp_perf_cleanup(ucx_perf_context_t *perf)
     ucp_cleanup(perf->ucp.context);
 }
 
-ucx_perf_funcs_t ucx_perf_funcs[] = {
+ucx_perf_funcs_t ucx_perf_funcs[UCX_PERF_API_LAST] = {
     [UCX_PERF_API_UCT] = {uct_perf_setup, uct_perf_cleanup,
                           uct_perf_test_dispatch, uct_perf_barrier},
     [UCX_PERF_API_UCP] = {ucp_perf_setup, ucp_perf_cleanup,
-                          ucp_perf_test_dispatch, ucp_perf_thread_barrier}
+                          ucp_perf_test_dispatch, ucp_perf_thread_barrier},
+#ifdef ENABLE_UCG
+    [UCX_PERF_API_UCG] = {ucg_perf_setup, ucg_perf_cleanup,
+                          ucg_perf_test_dispatch, ucg_perf_barrier}
+#endif
 };
 
 ucs_status_t ucx_perf_allocators_init(ucx_perf_context_t *perf,
@@ -1906,8 +1910,9 @@ ucs_status_t ucx_perf_run(const ucx_perf_params_t *params,
         goto out;
     }
 
-    if ((params->api != UCX_PERF_API_UCT) && (params->api != UCX_PERF_API_UCP)) {
-        ucs_error("Invalid test API parameter (should be UCT or UCP)");
+    if ((params->api >= UCX_PERF_API_LAST) ||
+        (ucx_perf_funcs[params->api].setup == NULL)) {
+        ucs_error("Invalid test API parameter (should be UCT, UCP or UCG)");
         status = UCS_ERR_INVALID_PARAM;
         goto out;
     }
@@ -116,6 +116,10 @@ struct ucx_perf_context {
             ucp_rkey_h                 self_send_rkey;
             ucp_rkey_h                 self_recv_rkey;
         } ucp;
+
+        struct {
+            struct ucg_group           *group;
+        } ucg;
     };
 };
 
@@ -156,6 +160,10 @@ void ucx_perf_calc_result(ucx_perf_context_t *perf, ucx_perf_result_t *result);
 void uct_perf_barrier(ucx_perf_context_t *perf);
 void ucp_perf_thread_barrier(ucx_perf_context_t *perf);
 void ucp_perf_barrier(ucx_perf_context_t *perf);
+ucs_status_t ucg_perf_setup(ucx_perf_context_t *perf);
+void ucg_perf_cleanup(ucx_perf_context_t *perf);
+ucs_status_t ucg_perf_test_dispatch(ucx_perf_context_t *perf);
+void ucg_perf_barrier(ucx_perf_context_t *perf);
 
 ucs_status_t ucp_perf_test_alloc_mem(ucx_perf_context_t *perf);
 void ucp_perf_test_free_mem(ucx_perf_context_t *perf);
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <tools/perf/lib/libperf_int.h>
+#include <ucg/api/ucg.h>
+#include <ucs/debug/log.h>
+#include <ucs/debug/memtrack_int.h>
+#include <string.h>
+
+
+/* Reductions are done on doubles, rooted operations are rooted at rank 0 */
+#define UCG_PERF_DT    UCG_DT_DOUBLE
+#define UCG_PERF_OP    UCG_OP_SUM
+#define UCG_PERF_ROOT  0
+
+
+static void ucg_perf_progress(void *arg)
+{
+    /* Collective operations are blocking, nothing to progress */
+}
+
+/*
+ * Exchange group information over the RTE. RTE recv() returns data only from
+ * the peer process, so groups are limited to 2 processes.
+ */
+static ucs_status_t
+ucg_perf_oob_allgather(const void *sbuf, void *rbuf, size_t length, void *arg)
+{
+    ucx_perf_context_t *perf = arg;
+    unsigned group_size      = rte_call(perf, group_size);
+    unsigned group_index     = rte_call(perf, group_index);
+    struct iovec vec;
+    void *req = NULL;
+    unsigned i;
+
+    vec.iov_base = (void*)sbuf;
+    vec.iov_len  = length;
+
+    rte_call(perf, post_vec, &vec, 1, &req);
+    rte_call(perf, exchange_vec, req);
+
+    /* In loopback mode, own data is also received from the RTE */
+    memcpy(UCS_PTR_BYTE_OFFSET(rbuf, group_index * length), sbuf, length);
+    for (i = 0; i < group_size; ++i) {
+        rte_call(perf, recv, i, UCS_PTR_BYTE_OFFSET(rbuf, i * length), length,
+                 req);
+    }
+
+    return UCS_OK;
+}
+
+static ucs_status_t ucg_perf_check_params(ucx_perf_context_t *perf)
+{
+    size_t length = ucx_perf_get_message_size(&perf->params);
+
+    if (rte_call(perf, group_size) > 2) {
+        ucs_error("UCG tests support at most 2 processes");
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    if (perf->params.thread_count > 1) {
+        ucs_error("UCG tests do not support multiple threads");
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    if ((perf->params.send_mem_type != UCS_MEMORY_TYPE_HOST) ||
+        (perf->params.recv_mem_type != UCS_MEMORY_TYPE_HOST)) {
+        ucs_error("UCG tests support only host memory");
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    if ((perf->params.command != UCX_PERF_CMD_BCAST) &&
+        ((length % ucg_dt_size(UCG_PERF_DT)) != 0)) {
+        ucs_error("UCG reduction message size must be a multiple of %zu",
+                  ucg_dt_size(UCG_PERF_DT));
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    return UCS_OK;
+}
+
+ucs_status_t ucg_perf_setup(ucx_perf_context_t *perf)
+{
+    size_t length = ucx_perf_get_message_size(&perf->params);
+    size_t alignment = ucs_max(perf->params.alignment, sizeof(double));
+    ucg_group_params_t params;
+    ucs_status_t status;
+    int ret;
+
+    status = ucg_perf_check_params(perf);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    ret = ucs_posix_memalign(&perf->send_buffer, alignment,
+                             ucs_max(length, 1), "ucg_perf_send");
+    if (ret != 0) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    ret = ucs_posix_memalign(&perf->recv_buffer, alignment,
+                             ucs_max(length, 1), "ucg_perf_recv");
+    if (ret != 0) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_send;
+    }
+
+    memset(perf->send_buffer, 0, length);
+    memset(perf->recv_buffer, 0, length);
+
+    params.field_mask    = UCG_GROUP_PARAM_FIELD_RANK |
+                           UCG_GROUP_PARAM_FIELD_SIZE |
+                           UCG_GROUP_PARAM_FIELD_OOB;
+    params.rank          = rte_call(perf, group_index);
+    params.size          = rte_call(perf, group_size);
+    params.oob.allgather = ucg_perf_oob_allgather;
+    params.oob.arg       = perf;
+
+    status = ucg_group_create(&params, &perf->ucg.group);
+    if (status != UCS_OK) {
+        goto err_free_recv;
+    }
+
+    return UCS_OK;
+
+err_free_recv:
+    ucs_free(perf->recv_buffer);
+err_free_send:
+    ucs_free(perf->send_buffer);
+    return status;
+}
+
+void ucg_perf_cleanup(ucx_perf_context_t *perf)
+{
+    ucg_group_destroy(perf->ucg.group);
+    ucs_free(perf->recv_buffer);
+    ucs_free(perf->send_buffer);
+}
+
+void ucg_perf_barrier(ucx_perf_context_t *perf)
+{
+    rte_call(perf, barrier, ucg_perf_progress, NULL);
+}
+
+ucs_status_t ucg_perf_test_dispatch(ucx_perf_context_t *perf)
+{
+    size_t length     = ucx_perf_get_message_size(&perf->params);
+    size_t count      = length / ucg_dt_size(UCG_PERF_DT);
+    ucg_group_h group = perf->ucg.group;
+    ucs_status_t status;
+
+    ucg_perf_barrier(perf);
+    ucx_perf_test_start_clock(perf);
+
+    UCX_PERF_TEST_FOREACH(perf) {
+        switch (perf->params.command) {
+        case UCX_PERF_CMD_BCAST:
+            status = ucg_bcast(group, perf->send_buffer, length,
+                               UCG_PERF_ROOT);
+            break;
+        case UCX_PERF_CMD_REDUCE:
+            status = ucg_reduce(group, perf->send_buffer, perf->recv_buffer,
+                                count, UCG_PERF_DT, UCG_PERF_OP,
+                                UCG_PERF_ROOT);
+            break;
+        case UCX_PERF_CMD_ALLREDUCE:
+            status = ucg_allreduce(group, perf->send_buffer,
+                                   perf->recv_buffer, count, UCG_PERF_DT,
+                                   UCG_PERF_OP);
+            break;
+        default:
+            ucs_error("Invalid UCG test case: %d", perf->params.command);
+            return UCS_ERR_INVALID_PARAM;
+        }
+
+        if (status != UCS_OK) {
+            return status;
+        }
+
+        ucx_perf_update(perf, 1, length);
+    }
+
+    ucx_perf_get_time(perf);
+    ucg_perf_barrier(perf);
+    return UCS_OK;
+}
@@ -105,6 +105,17 @@ test_type_t tests[] = {
     {"ucp_am_bw", UCX_PERF_API_UCP, UCX_PERF_CMD_AM, UCX_PERF_TEST_TYPE_STREAM_UNI,
      "am bandwidth / message rate", "overhead", 32},
 
+#ifdef ENABLE_UCG
+    {"ucg_bcast", UCX_PERF_API_UCG, UCX_PERF_CMD_BCAST, UCX_PERF_TEST_TYPE_PINGPONG,
+     "shared memory broadcast latency", "latency", 1},
+
+    {"ucg_reduce", UCX_PERF_API_UCG, UCX_PERF_CMD_REDUCE, UCX_PERF_TEST_TYPE_PINGPONG,
+     "shared memory reduce latency", "latency", 1},
+
+    {"ucg_allreduce", UCX_PERF_API_UCG, UCX_PERF_CMD_ALLREDUCE, UCX_PERF_TEST_TYPE_PINGPONG,
+     "shared memory allreduce latency", "latency", 1},
+#endif
+
     {NULL}
 };
 
@@ -30,7 +30,8 @@ static void usage(const struct perftest_context *ctx, const char *program)
 {
     static const char* api_names[] = {
         [UCX_PERF_API_UCT] = "UCT",
-        [UCX_PERF_API_UCP] = "UCP"
+        [UCX_PERF_API_UCP] = "UCP",
+        [UCX_PERF_API_UCG] = "UCG"
     };
     test_type_t *test;
     int UCS_V_UNUSED rank;
@@ -143,6 +144,14 @@ static void usage(const struct perftest_context *ctx, const char *program)
     printf("     -y             do additional memcopy to the user memory in active message receive handler\n");
     printf("     -z             pass pre-registered memory handle\n");
     printf("\n");
+#ifdef ENABLE_UCG
+    printf("  UCG only:\n");
+    printf("     ucg_* tests run a group of the 2 test processes, since the test setup\n");
+    printf("     exchanges data only with the peer process. The two-level (intra-node\n");
+    printf("     and inter-node) algorithms need several processes on each of several\n");
+    printf("     nodes, so they are not exercised.\n");
+    printf("\n");
+#endif
     printf("   NOTE: When running UCP tests, transport and device should be specified by\n");
     printf("         environment variables: UCX_TLS and UCX_[SELF|SHM|NET]_DEVICES.\n");
     printf("\n");
@@ -494,6 +503,8 @@ ucs_status_t check_params(const perftest_params_t *params)
                      params->super.uct.tl_name);
         }
         return UCS_OK;
+    case UCX_PERF_API_UCG:
+        return UCS_OK;
     default:
         ucs_error("Invalid test case");
         return UCS_ERR_INVALID_PARAM;
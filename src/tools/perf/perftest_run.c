@@ -139,6 +139,9 @@ static void print_header(struct perftest_context *ctx)
         } else if (test->api == UCX_PERF_API_UCP) {
             test_api_str  = "protocol layer";
             test_data_str = "(automatic)"; /* TODO contig/stride/stream */
+        } else if (test->api == UCX_PERF_API_UCG) {
+            test_api_str  = "group collectives";
+            test_data_str = "contig";
         } else {
             return;
         }
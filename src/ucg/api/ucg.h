@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCG_H_
+#define UCG_H_
+
+#include <ucs/sys/compiler_def.h>
+#include <ucs/type/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+BEGIN_C_DECLS
+
+/**
+ * @defgroup UCG_API Unified Communication Group (UCG) API
+ * @{
+ * UCG provides collective operations among a group of processes running on
+ * the same host. Data is exchanged through shared memory segments allocated
+ * by the UCT shared memory (mm) transports, and synchronization is done by
+ * polling on flags in these segments, so no messages are sent at all.
+ *
+ * All collective operations are blocking, and must be invoked by all group
+ * members in the same order.
+ * @}
+ */
+
+
+/**
+ * @ingroup UCG_API
+ * @brief UCG group handle.
+ *
+ * A group is a set of processes which participate together in collective
+ * operations. Every process in the group is identified by its rank.
+ */
+typedef struct ucg_group *ucg_group_h;
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Out-of-band all-gather function.
+ *
+ * Used during group creation to exchange shared memory segment information.
+ * Every group member provides @a length bytes in @a sbuf, and upon return
+ * @a rbuf must contain the buffers of all members ordered by rank.
+ *
+ * @param [in]  sbuf    Local data to distribute.
+ * @param [out] rbuf    Receive buffer, of size @a length times group size.
+ * @param [in]  length  Size of every member's data.
+ * @param [in]  arg     User-defined argument, @ref ucg_group_params_t::oob.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+typedef ucs_status_t (*ucg_oob_allgather_func_t)(const void *sbuf, void *rbuf,
+                                                 size_t length, void *arg);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Reduction datatypes.
+ */
+typedef enum {
+    UCG_DT_INT32,
+    UCG_DT_INT64,
+    UCG_DT_FLOAT,
+    UCG_DT_DOUBLE,
+    UCG_DT_LAST
+} ucg_dt_t;
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Reduction operations.
+ */
+typedef enum {
+    UCG_OP_SUM,
+    UCG_OP_MIN,
+    UCG_OP_MAX,
+    UCG_OP_LAST
+} ucg_op_t;
+
+
+/**
+ * @ingroup UCG_API
+ * @brief UCG group parameters field mask.
+ */
+enum ucg_group_params_field {
+    UCG_GROUP_PARAM_FIELD_RANK      = UCS_BIT(0), /**< rank */
+    UCG_GROUP_PARAM_FIELD_SIZE      = UCS_BIT(1), /**< size */
+    UCG_GROUP_PARAM_FIELD_OOB       = UCS_BIT(2), /**< oob */
+    UCG_GROUP_PARAM_FIELD_FRAG_SIZE = UCS_BIT(3), /**< frag_size */
+    UCG_GROUP_PARAM_FIELD_NODE_ID   = UCS_BIT(4)  /**< node_id */
+};
+
+
+/**
+ * @ingroup UCG_API
+ * @brief UCG group creation parameters.
+ */
+typedef struct ucg_group_params {
+    /**
+     * Mask of valid fields in this structure, using bits from
+     * @ref ucg_group_params_field. Fields not specified in this mask are
+     * ignored. RANK, SIZE and OOB are mandatory.
+     */
+    uint64_t                     field_mask;
+
+    /**
+     * Rank of the calling process in the group, in the range [0, size).
+     */
+    unsigned                     rank;
+
+    /**
+     * Number of processes in the group.
+     */
+    unsigned                     size;
+
+    /**
+     * Out-of-band exchange used during group creation.
+     */
+    struct {
+        ucg_oob_allgather_func_t allgather; /**< All-gather function */
+        void                     *arg;      /**< Argument to pass to it */
+    } oob;
+
+    /**
+     * Size of every shared memory buffer, in bytes. Larger operations are
+     * pipelined in fragments of this size. Default: 8192.
+     */
+    size_t                       frag_size;
+
+    /**
+     * Locality domain of the calling process. Ranks with the same node ID
+     * share the first level of the two-level collective algorithms, and the
+     * lowest such rank acts as the domain leader. If not set, the NUMA node
+     * of the CPU the process is running on is used. Setting the same value
+     * for all ranks selects flat (single-level) algorithms.
+     */
+    int                          node_id;
+} ucg_group_params_t;
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Create a group.
+ *
+ * This is a collective call: all members must call it with the same size and
+ * distinct ranks.
+ *
+ * @param [in]  params   Group parameters.
+ * @param [out] group_p  Filled with the new group handle.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucg_group_create(const ucg_group_params_t *params,
+                              ucg_group_h *group_p);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Destroy a group.
+ *
+ * This is a collective call, since the shared memory of a member can be
+ * released only after all other members stopped accessing it.
+ *
+ * @param [in]  group    Group to destroy.
+ */
+void ucg_group_destroy(ucg_group_h group);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Block until all group members reached the barrier.
+ *
+ * @param [in]  group    Group handle.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucg_barrier(ucg_group_h group);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Broadcast a buffer from the root to all group members.
+ *
+ * @param [in]    group   Group handle.
+ * @param [inout] buffer  Data to send on the root, receive buffer elsewhere.
+ * @param [in]    length  Data length in bytes.
+ * @param [in]    root    Rank of the root.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucg_bcast(ucg_group_h group, void *buffer, size_t length,
+                       unsigned root);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Reduce the buffers of all group members to the root.
+ *
+ * The reduction is applied in rank order within every locality domain and
+ * then in domain order, so the result is reproducible for floating point
+ * datatypes given the same group layout.
+ *
+ * @param [in]  group   Group handle.
+ * @param [in]  sbuf    Local contribution, @a count elements of @a dt.
+ * @param [out] rbuf    Result buffer, relevant only on the root. May be the
+ *                      same as @a sbuf.
+ * @param [in]  count   Number of elements.
+ * @param [in]  dt      Element datatype.
+ * @param [in]  op      Reduction operation.
+ * @param [in]  root    Rank of the root.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucg_reduce(ucg_group_h group, const void *sbuf, void *rbuf,
+                        size_t count, ucg_dt_t dt, ucg_op_t op, unsigned root);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Reduce the buffers of all group members and distribute the result.
+ *
+ * Same as @ref ucg_reduce, but all group members receive the result.
+ *
+ * @param [in]  group   Group handle.
+ * @param [in]  sbuf    Local contribution, @a count elements of @a dt.
+ * @param [out] rbuf    Result buffer. May be the same as @a sbuf.
+ * @param [in]  count   Number of elements.
+ * @param [in]  dt      Element datatype.
+ * @param [in]  op      Reduction operation.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucg_allreduce(ucg_group_h group, const void *sbuf, void *rbuf,
+                           size_t count, ucg_dt_t dt, ucg_op_t op);
+
+
+/**
+ * @ingroup UCG_API
+ * @brief Get the size of a reduction datatype.
+ *
+ * @param [in]  dt      Datatype.
+ *
+ * @return Size of a single element in bytes.
+ */
+size_t ucg_dt_size(ucg_dt_t dt);
+
+END_C_DECLS
+
+#endif
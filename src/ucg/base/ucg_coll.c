@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ucg_group.h"
+#include "ucg_reduce.h"
+
+#include <ucs/debug/log.h>
+#include <ucs/sys/math.h>
+#include <sched.h>
+#include <string.h>
+
+
+/* Number of polls of a flag before yielding the CPU */
+#define UCG_COLL_SPIN_COUNT 1024
+
+
+/*
+ * Collective operations are split into steps, each of them handling at most
+ * one fragment of data. Consecutive steps use the buffer slots in turn, so a
+ * member may fill its buffers for the next fragment while others still read
+ * the current one. A step starts only after all members have finished reading
+ * the buffers of the previous step which used the same slot, so every buffer
+ * can be reused without further synchronization.
+ */
+
+static UCS_F_ALWAYS_INLINE void
+ucg_coll_wait(volatile uint64_t *flag, uint64_t seq)
+{
+    unsigned count = 0;
+
+    while (*flag < seq) {
+        if (++count == UCG_COLL_SPIN_COUNT) {
+            /* Let other group members run on an oversubscribed host */
+            sched_yield();
+            count = 0;
+        }
+    }
+
+    ucs_memory_cpu_load_fence();
+}
+
+static UCS_F_ALWAYS_INLINE void
+ucg_coll_publish(volatile uint64_t *flag, uint64_t seq)
+{
+    ucs_memory_cpu_store_fence();
+    *flag = seq;
+}
+
+static uint64_t ucg_coll_step_start(ucg_group_h group)
+{
+    uint64_t seq = ++group->seq;
+    uint64_t prev_seq;
+    unsigned i;
+
+    /* Last step which used the same buffer slot, or 0 if there was none */
+    prev_seq = ucs_max(seq, UCG_GROUP_NUM_SLOTS) - UCG_GROUP_NUM_SLOTS;
+    for (i = 0; i < group->size; ++i) {
+        ucg_coll_wait(&group->members[i].ctrl->done_seq, prev_seq);
+    }
+
+    return seq;
+}
+
+static void ucg_coll_step_end(ucg_group_h group, uint64_t seq)
+{
+    ucg_coll_publish(&ucg_group_self(group)->ctrl->done_seq, seq);
+}
+
+/*
+ * Reduce the contributions of the members in 'ranks' to 'dst', in order.
+ * If 'domain' is set, the domain reductions of these members (which must be
+ * leaders) are used instead of their own contributions.
+ */
+static void
+ucg_coll_reduce_members(ucg_group_h group, const unsigned *ranks,
+                        unsigned num_ranks, int domain, uint64_t seq,
+                        void *dst, size_t count, size_t length,
+                        ucg_reduce_func_t reduce_func)
+{
+    ucg_group_member_t *member;
+    const ucg_group_slot_t *slot;
+    volatile uint64_t *flag;
+    const void *src;
+    unsigned i;
+
+    for (i = 0; i < num_ranks; ++i) {
+        member = &group->members[ranks[i]];
+        slot   = ucg_group_member_slot(member, seq);
+        if (domain) {
+            flag = member->partial_flag;
+            src  = slot->partial_src;
+        } else {
+            flag = &member->ctrl->in_seq;
+            src  = slot->in;
+        }
+
+        ucg_coll_wait(flag, seq);
+        if (i == 0) {
+            memcpy(dst, src, length);
+        } else {
+            reduce_func(dst, src, count);
+        }
+    }
+}
+
+/*
+ * Reduce one fragment. Every member publishes its contribution, leaders of
+ * multi-member domains reduce their domain, and then the domain reductions
+ * are combined: by every leader for allreduce, or by the root for reduce.
+ * Members of multi-member domains copy the allreduce result from their leader
+ * instead of reading all other domains.
+ */
+static void
+ucg_coll_reduce_frag(ucg_group_h group, const void *sbuf, void *rbuf,
+                     size_t count, size_t length,
+                     ucg_reduce_func_t reduce_func, int all, unsigned root)
+{
+    ucg_group_member_t *self = ucg_group_self(group);
+    int single_domain_member = group->num_peers == 1;
+    ucg_group_slot_t *slot, *leader_slot;
+    ucg_group_member_t *leader;
+    uint64_t seq;
+    void *dst;
+
+    seq  = ucg_coll_step_start(group);
+    slot = ucg_group_member_slot(self, seq);
+
+    memcpy(slot->in, sbuf, length);
+    ucg_coll_publish(&self->ctrl->in_seq, seq);
+
+    if (ucg_group_is_leader(group) && !single_domain_member) {
+        ucg_coll_reduce_members(group, group->peers, group->num_peers, 0, seq,
+                                slot->partial, count, length, reduce_func);
+        ucg_coll_publish(&self->ctrl->partial_seq, seq);
+    }
+
+    if (!all) {
+        if (group->rank == root) {
+            ucg_coll_reduce_members(group, group->leaders, group->num_leaders,
+                                    1, seq, rbuf, count, length, reduce_func);
+        }
+    } else if (ucg_group_is_leader(group)) {
+        dst = single_domain_member ? rbuf : slot->result;
+        ucg_coll_reduce_members(group, group->leaders, group->num_leaders, 1,
+                                seq, dst, count, length, reduce_func);
+        if (!single_domain_member) {
+            ucg_coll_publish(&self->ctrl->result_seq, seq);
+            memcpy(rbuf, slot->result, length);
+        }
+    } else {
+        leader      = &group->members[self->leader];
+        leader_slot = ucg_group_member_slot(leader, seq);
+        ucg_coll_wait(&leader->ctrl->result_seq, seq);
+        memcpy(rbuf, leader_slot->result, length);
+    }
+
+    ucg_coll_step_end(group, seq);
+}
+
+static ucs_status_t
+ucg_coll_reduce_common(ucg_group_h group, const void *sbuf, void *rbuf,
+                       size_t count, ucg_dt_t dt, ucg_op_t op, int all,
+                       unsigned root)
+{
+    ucg_reduce_func_t reduce_func;
+    size_t dt_size, max_frag_count, frag_count, offset;
+
+    if ((dt >= UCG_DT_LAST) || (op >= UCG_OP_LAST) || (root >= group->size)) {
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    dt_size        = ucg_dt_size(dt);
+    max_frag_count = group->frag_size / dt_size;
+    if (max_frag_count == 0) {
+        ucs_error("group fragment size %zu is too small for %s",
+                  group->frag_size, ucg_dt_names[dt]);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    reduce_func = ucg_reduce_funcs[dt][op];
+    for (offset = 0; offset < count; offset += frag_count) {
+        frag_count = ucs_min(max_frag_count, count - offset);
+        ucg_coll_reduce_frag(group,
+                             UCS_PTR_BYTE_OFFSET(sbuf, offset * dt_size),
+                             UCS_PTR_BYTE_OFFSET(rbuf, offset * dt_size),
+                             frag_count, frag_count * dt_size, reduce_func,
+                             all, root);
+    }
+
+    return UCS_OK;
+}
+
+ucs_status_t ucg_reduce(ucg_group_h group, const void *sbuf, void *rbuf,
+                        size_t count, ucg_dt_t dt, ucg_op_t op, unsigned root)
+{
+    return ucg_coll_reduce_common(group, sbuf, rbuf, count, dt, op, 0, root);
+}
+
+ucs_status_t ucg_allreduce(ucg_group_h group, const void *sbuf, void *rbuf,
+                           size_t count, ucg_dt_t dt, ucg_op_t op)
+{
+    return ucg_coll_reduce_common(group, sbuf, rbuf, count, dt, op, 1, 0);
+}
+
+/*
+ * Broadcast one fragment. Leaders and members of the root's domain read the
+ * root buffer directly. Leaders of other domains also republish the data
+ * locally, so the rest of their domain does not cross the domain boundary.
+ */
+static void ucg_coll_bcast_frag(ucg_group_h group, void *buffer, size_t length,
+                                unsigned root)
+{
+    ucg_group_member_t *self  = ucg_group_self(group);
+    ucg_group_member_t *rootm = &group->members[root];
+    ucg_group_slot_t *slot, *root_slot, *leader_slot;
+    ucg_group_member_t *leader;
+    uint64_t seq;
+
+    seq       = ucg_coll_step_start(group);
+    slot      = ucg_group_member_slot(self, seq);
+    root_slot = ucg_group_member_slot(rootm, seq);
+
+    if (group->rank == root) {
+        memcpy(slot->in, buffer, length);
+        ucg_coll_publish(&self->ctrl->in_seq, seq);
+    } else if (self->leader == rootm->leader) {
+        ucg_coll_wait(&rootm->ctrl->in_seq, seq);
+        memcpy(buffer, root_slot->in, length);
+    } else if (ucg_group_is_leader(group)) {
+        ucg_coll_wait(&rootm->ctrl->in_seq, seq);
+        if (group->num_peers > 1) {
+            memcpy(slot->result, root_slot->in, length);
+            ucg_coll_publish(&self->ctrl->result_seq, seq);
+            memcpy(buffer, slot->result, length);
+        } else {
+            memcpy(buffer, root_slot->in, length);
+        }
+    } else {
+        leader      = &group->members[self->leader];
+        leader_slot = ucg_group_member_slot(leader, seq);
+        ucg_coll_wait(&leader->ctrl->result_seq, seq);
+        memcpy(buffer, leader_slot->result, length);
+    }
+
+    ucg_coll_step_end(group, seq);
+}
+
+ucs_status_t ucg_bcast(ucg_group_h group, void *buffer, size_t length,
+                       unsigned root)
+{
+    size_t offset, frag_length;
+
+    if (root >= group->size) {
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    for (offset = 0; offset < length; offset += group->frag_size) {
+        frag_length = ucs_min(group->frag_size, length - offset);
+        ucg_coll_bcast_frag(group, UCS_PTR_BYTE_OFFSET(buffer, offset),
+                            frag_length, root);
+    }
+
+    return UCS_OK;
+}
+
+ucs_status_t ucg_barrier(ucg_group_h group)
+{
+    uint64_t seq;
+    unsigned i;
+
+    seq = ucg_coll_step_start(group);
+
+    ucg_coll_publish(&ucg_group_self(group)->ctrl->in_seq, seq);
+    for (i = 0; i < group->size; ++i) {
+        ucg_coll_wait(&group->members[i].ctrl->in_seq, seq);
+    }
+
+    ucg_coll_step_end(group, seq);
+    return UCS_OK;
+}
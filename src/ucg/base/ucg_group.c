@@ -0,0 +1,378 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ucg_group.h"
+
+#include <ucs/arch/bitops.h>
+#include <ucs/debug/log.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/memory/numa.h>
+#include <ucs/sys/compiler.h>
+#include <ucs/sys/math.h>
+#include <string.h>
+
+
+/* Shared memory domains to allocate the segments from, by preference */
+static const char *ucg_group_md_names[] = {"posix", "sysv"};
+
+
+/* Segment information exchanged during group creation */
+typedef struct {
+    int      node_id;  /* Locality domain of the owner */
+    uint64_t address;  /* Segment address in the owner's address space */
+    /* Followed by the packed segment rkey */
+} UCS_S_PACKED ucg_group_addr_t;
+
+
+static size_t ucg_group_buf_size(ucg_group_h group)
+{
+    return ucs_align_up_pow2(group->frag_size, UCS_SYS_CACHE_LINE_SIZE);
+}
+
+static void
+ucg_group_member_set_seg(ucg_group_h group, ucg_group_member_t *member,
+                         void *seg_address)
+{
+    size_t buf_size = ucg_group_buf_size(group);
+    ucg_group_slot_t *slot;
+    void *buf;
+    unsigned i;
+
+    member->ctrl = seg_address;
+    buf          = UCS_PTR_BYTE_OFFSET(seg_address, sizeof(ucg_group_ctrl_t));
+    for (i = 0; i < UCG_GROUP_NUM_SLOTS; ++i) {
+        slot          = &member->slots[i];
+        slot->in      = buf;
+        slot->partial = UCS_PTR_BYTE_OFFSET(slot->in, buf_size);
+        slot->result  = UCS_PTR_BYTE_OFFSET(slot->partial, buf_size);
+        buf           = UCS_PTR_BYTE_OFFSET(slot->result, buf_size);
+    }
+}
+
+static ucs_status_t ucg_group_open_md(ucg_group_h group)
+{
+    uct_component_attr_t component_attr;
+    uct_md_config_t *md_config;
+    uct_component_h component;
+    ucs_status_t status;
+    unsigned i, j;
+
+    status = uct_query_components(&group->components, &group->num_components);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    for (i = 0; i < ucs_static_array_size(ucg_group_md_names); ++i) {
+        for (j = 0; j < group->num_components; ++j) {
+            component                 = group->components[j];
+            component_attr.field_mask = UCT_COMPONENT_ATTR_FIELD_NAME;
+            status = uct_component_query(component, &component_attr);
+            if ((status != UCS_OK) ||
+                strcmp(component_attr.name, ucg_group_md_names[i])) {
+                continue;
+            }
+
+            status = uct_md_config_read(component, NULL, NULL, &md_config);
+            if (status != UCS_OK) {
+                continue;
+            }
+
+            status = uct_md_open(component, component_attr.name, md_config,
+                                 &group->md);
+            uct_config_release(md_config);
+            if (status == UCS_OK) {
+                group->component = component;
+                return UCS_OK;
+            }
+        }
+    }
+
+    ucs_error("no shared memory domain available for group collectives");
+    uct_release_component_list(group->components);
+    return UCS_ERR_UNSUPPORTED;
+}
+
+static ucs_status_t ucg_group_alloc_seg(ucg_group_h group)
+{
+    uct_alloc_method_t method = UCT_ALLOC_METHOD_MD;
+    uct_mem_alloc_params_t params;
+    ucs_status_t status;
+
+    params.field_mask = UCT_MEM_ALLOC_PARAM_FIELD_FLAGS    |
+                        UCT_MEM_ALLOC_PARAM_FIELD_MEM_TYPE |
+                        UCT_MEM_ALLOC_PARAM_FIELD_MDS      |
+                        UCT_MEM_ALLOC_PARAM_FIELD_NAME;
+    params.flags      = UCT_MD_MEM_ACCESS_ALL;
+    params.mem_type   = UCS_MEMORY_TYPE_HOST;
+    params.mds.mds    = &group->md;
+    params.mds.count  = 1;
+    params.name       = "ucg segment";
+
+    status = uct_mem_alloc(sizeof(ucg_group_ctrl_t) +
+                           (UCG_GROUP_NUM_SLOTS * 3 *
+                            ucg_group_buf_size(group)),
+                           &method, 1, &params, &group->seg);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    memset(group->seg.address, 0, sizeof(ucg_group_ctrl_t));
+    return UCS_OK;
+}
+
+static void ucg_group_detach(ucg_group_h group, unsigned count)
+{
+    unsigned i;
+
+    for (i = 0; i < count; ++i) {
+        if (i != group->rank) {
+            uct_rkey_release(group->component, &group->members[i].rkey);
+        }
+    }
+}
+
+static ucs_status_t
+ucg_group_attach(ucg_group_h group, const void *addrs, size_t addr_size)
+{
+    ucg_group_member_t *member;
+    const ucg_group_addr_t *addr;
+    void *seg_address;
+    ucs_status_t status;
+    unsigned i;
+
+    for (i = 0; i < group->size; ++i) {
+        member          = &group->members[i];
+        addr            = UCS_PTR_BYTE_OFFSET(addrs, i * addr_size);
+        member->node_id = addr->node_id;
+
+        if (i == group->rank) {
+            ucg_group_member_set_seg(group, member, group->seg.address);
+            continue;
+        }
+
+        status = uct_rkey_unpack(group->component, addr + 1, &member->rkey);
+        if (status != UCS_OK) {
+            goto err;
+        }
+
+        status = uct_rkey_ptr(group->component, &member->rkey, addr->address,
+                              &seg_address);
+        if (status != UCS_OK) {
+            uct_rkey_release(group->component, &member->rkey);
+            goto err;
+        }
+
+        ucg_group_member_set_seg(group, member, seg_address);
+    }
+
+    return UCS_OK;
+
+err:
+    ucs_error("failed to attach to the segment of rank %u: %s", i,
+              ucs_status_string(status));
+    ucg_group_detach(group, i);
+    return status;
+}
+
+/*
+ * Select the leader of every locality domain - its lowest rank. If all ranks
+ * are in the same domain, a two-level algorithm has no benefit, so every rank
+ * becomes a leader of itself and reduces the contributions of all others.
+ */
+static void ucg_group_init_topo(ucg_group_h group)
+{
+    ucg_group_member_t *member, *leader;
+    unsigned i, j, domain_size;
+    ucg_group_slot_t *slot;
+
+    group->num_leaders = 0;
+    for (i = 0; i < group->size; ++i) {
+        member         = &group->members[i];
+        member->leader = i;
+        for (j = 0; j < i; ++j) {
+            if (group->members[j].node_id == member->node_id) {
+                member->leader = group->members[j].leader;
+                break;
+            }
+        }
+
+        group->num_leaders += (member->leader == i);
+    }
+
+    if (group->num_leaders == 1) {
+        for (i = 0; i < group->size; ++i) {
+            group->members[i].leader = i;
+        }
+        group->num_leaders = group->size;
+    }
+
+    group->num_peers = 0;
+    for (i = 0, j = 0; i < group->size; ++i) {
+        member = &group->members[i];
+        if (member->leader == i) {
+            group->leaders[j++] = i;
+        }
+        if (member->leader == ucg_group_self(group)->leader) {
+            group->peers[group->num_peers++] = i;
+        }
+    }
+
+    for (i = 0; i < group->num_leaders; ++i) {
+        leader      = &group->members[group->leaders[i]];
+        domain_size = 0;
+        for (j = 0; j < group->size; ++j) {
+            domain_size += (group->members[j].leader == group->leaders[i]);
+        }
+
+        for (j = 0; j < UCG_GROUP_NUM_SLOTS; ++j) {
+            slot              = &leader->slots[j];
+            slot->partial_src = (domain_size > 1) ? slot->partial : slot->in;
+        }
+
+        leader->partial_flag = (domain_size > 1) ? &leader->ctrl->partial_seq :
+                                                   &leader->ctrl->in_seq;
+    }
+}
+
+ucs_status_t ucg_group_create(const ucg_group_params_t *params,
+                              ucg_group_h *group_p)
+{
+    const uint64_t required_fields = UCG_GROUP_PARAM_FIELD_RANK |
+                                     UCG_GROUP_PARAM_FIELD_SIZE |
+                                     UCG_GROUP_PARAM_FIELD_OOB;
+    ucg_group_addr_t *addrs, *local_addr;
+    size_t addr_size;
+    uct_md_attr_t md_attr;
+    ucg_group_h group;
+    ucs_status_t status;
+
+    if (!ucs_test_all_flags(params->field_mask, required_fields) ||
+        (params->size == 0) || (params->rank >= params->size) ||
+        (params->oob.allgather == NULL)) {
+        ucs_error("invalid group parameters");
+        status = UCS_ERR_INVALID_PARAM;
+        goto err;
+    }
+
+    group = ucs_calloc(1, sizeof(*group), "ucg_group");
+    if (group == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err;
+    }
+
+    group->rank      = params->rank;
+    group->size      = params->size;
+    group->seq       = 0;
+    group->frag_size = (params->field_mask & UCG_GROUP_PARAM_FIELD_FRAG_SIZE) ?
+                       params->frag_size : UCG_GROUP_DEFAULT_FRAG_SIZE;
+    if (group->frag_size == 0) {
+        ucs_error("invalid group fragment size");
+        status = UCS_ERR_INVALID_PARAM;
+        goto err_free_group;
+    }
+
+    group->members = ucs_calloc(group->size, sizeof(*group->members),
+                                "ucg_group_members");
+    group->leaders = ucs_calloc(group->size, sizeof(*group->leaders),
+                                "ucg_group_leaders");
+    group->peers   = ucs_calloc(group->size, sizeof(*group->peers),
+                                "ucg_group_peers");
+    if ((group->members == NULL) || (group->leaders == NULL) ||
+        (group->peers == NULL)) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_arrays;
+    }
+
+    status = ucg_group_open_md(group);
+    if (status != UCS_OK) {
+        goto err_free_arrays;
+    }
+
+    status = uct_md_query(group->md, &md_attr);
+    if (status != UCS_OK) {
+        goto err_close_md;
+    }
+
+    status = ucg_group_alloc_seg(group);
+    if (status != UCS_OK) {
+        goto err_close_md;
+    }
+
+    addr_size = sizeof(*local_addr) + md_attr.rkey_packed_size;
+    addrs     = ucs_malloc(addr_size * (group->size + 1), "ucg_group_addrs");
+    if (addrs == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_seg;
+    }
+
+    local_addr          = UCS_PTR_BYTE_OFFSET(addrs, addr_size * group->size);
+    local_addr->node_id = (params->field_mask &
+                           UCG_GROUP_PARAM_FIELD_NODE_ID) ?
+                          params->node_id : ucs_numa_node_of_current_cpu();
+    local_addr->address = (uintptr_t)group->seg.address;
+
+    status = uct_md_mkey_pack(group->md, group->seg.memh, local_addr + 1);
+    if (status != UCS_OK) {
+        goto err_free_addrs;
+    }
+
+    status = params->oob.allgather(local_addr, addrs, addr_size,
+                                   params->oob.arg);
+    if (status != UCS_OK) {
+        goto err_free_addrs;
+    }
+
+    status = ucg_group_attach(group, addrs, addr_size);
+    if (status != UCS_OK) {
+        goto err_free_addrs;
+    }
+
+    ucg_group_init_topo(group);
+    ucs_free(addrs);
+
+    ucs_debug("group %p rank %u/%u: node %d, leader %u, %u leaders, "
+              "%u domain peers, fragment %zu", group, group->rank, group->size,
+              ucg_group_self(group)->node_id, ucg_group_self(group)->leader,
+              group->num_leaders, group->num_peers, group->frag_size);
+
+    *group_p = group;
+    return UCS_OK;
+
+err_free_addrs:
+    ucs_free(addrs);
+err_free_seg:
+    uct_mem_free(&group->seg);
+err_close_md:
+    uct_md_close(group->md);
+    uct_release_component_list(group->components);
+err_free_arrays:
+    ucs_free(group->peers);
+    ucs_free(group->leaders);
+    ucs_free(group->members);
+err_free_group:
+    ucs_free(group);
+err:
+    return status;
+}
+
+void ucg_group_destroy(ucg_group_h group)
+{
+    /* Make sure no member accesses our segment anymore */
+    (void)ucg_barrier(group);
+
+    ucg_group_detach(group, group->size);
+    uct_mem_free(&group->seg);
+    uct_md_close(group->md);
+    uct_release_component_list(group->components);
+    ucs_free(group->peers);
+    ucs_free(group->leaders);
+    ucs_free(group->members);
+    ucs_free(group);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCG_GROUP_H_
+#define UCG_GROUP_H_
+
+#include <ucg/api/ucg.h>
+#include <uct/api/uct.h>
+#include <ucs/arch/cpu.h>
+
+
+/* Default size of every shared memory data buffer */
+#define UCG_GROUP_DEFAULT_FRAG_SIZE 8192
+
+
+/* Number of buffer sets, used by consecutive collective steps in turn */
+#define UCG_GROUP_NUM_SLOTS         2
+
+
+/*
+ * Control block at the head of every member's shared memory segment. Every
+ * flag is written only by the segment owner and holds the sequence number of
+ * the last collective step in which it was set. Each flag has its own cache
+ * line, so polling one of them does not disturb writers of the others.
+ */
+typedef struct {
+    /* Own contribution was copied to the 'in' buffer */
+    volatile uint64_t in_seq      UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE);
+
+    /* Locality domain reduction was written to the 'partial' buffer */
+    volatile uint64_t partial_seq UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE);
+
+    /* Final result was written to the 'result' buffer */
+    volatile uint64_t result_seq  UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE);
+
+    /* Owner finished reading the buffers of other members */
+    volatile uint64_t done_seq    UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE);
+} ucg_group_ctrl_t;
+
+
+/*
+ * Data buffers of a group member, used by one collective step.
+ */
+typedef struct {
+    void              *in;            /* Contribution buffer */
+    void              *partial;       /* Locality domain reduction buffer */
+    void              *result;        /* Final result buffer */
+
+    /* Where other domains read this member's domain reduction from. Relevant
+     * only for leaders: if the domain has a single member, it is the 'in'
+     * buffer, since no reduction is needed. */
+    const void        *partial_src;
+} ucg_group_slot_t;
+
+
+/*
+ * Group member, as seen by the local process.
+ */
+typedef struct {
+    ucg_group_ctrl_t  *ctrl;          /* Control block */
+    ucg_group_slot_t  slots[UCG_GROUP_NUM_SLOTS];
+    volatile uint64_t *partial_flag;  /* Flag of the domain reduction */
+
+    int               node_id;        /* Locality domain */
+    unsigned          leader;         /* Rank of the domain leader */
+    uct_rkey_bundle_t rkey;           /* Attached remote segment */
+} ucg_group_member_t;
+
+
+/*
+ * Group of processes sharing memory segments.
+ */
+typedef struct ucg_group {
+    unsigned               rank;           /* Own rank */
+    unsigned               size;           /* Number of members */
+    size_t                 frag_size;      /* Size of a data buffer */
+    uint64_t               seq;            /* Last collective step */
+
+    uct_component_h        *components;    /* Queried UCT components */
+    unsigned               num_components;
+    uct_component_h        component;      /* Shared memory component */
+    uct_md_h               md;             /* Shared memory domain */
+    uct_allocated_memory_t seg;            /* Own segment */
+
+    ucg_group_member_t     *members;       /* All members, by rank */
+    unsigned               *leaders;       /* Domain leaders, ascending */
+    unsigned               num_leaders;
+    unsigned               *peers;         /* Own domain members, ascending */
+    unsigned               num_peers;
+} ucg_group_t;
+
+
+static UCS_F_ALWAYS_INLINE ucg_group_member_t *
+ucg_group_self(ucg_group_h group)
+{
+    return &group->members[group->rank];
+}
+
+
+static UCS_F_ALWAYS_INLINE int ucg_group_is_leader(ucg_group_h group)
+{
+    return ucg_group_self(group)->leader == group->rank;
+}
+
+
+/* Buffers of a member for the collective step 'seq' */
+static UCS_F_ALWAYS_INLINE ucg_group_slot_t *
+ucg_group_member_slot(ucg_group_member_t *member, uint64_t seq)
+{
+    return &member->slots[seq % UCG_GROUP_NUM_SLOTS];
+}
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ucg_reduce.h"
+
+#include <ucs/debug/assert.h>
+#include <stdint.h>
+
+
+#define UCG_REDUCE_SUM(_a, _b) ((_a) + (_b))
+#define UCG_REDUCE_MIN(_a, _b) (((_b) < (_a)) ? (_b) : (_a))
+#define UCG_REDUCE_MAX(_a, _b) (((_b) > (_a)) ? (_b) : (_a))
+
+
+/*
+ * The loops are kept trivial and the pointers restrict-qualified, so the
+ * compiler vectorizes them with the widest SIMD instructions enabled for the
+ * build (SSE/AVX on x86, NEON/SVE on Arm).
+ */
+#define UCG_REDUCE_FUNC_DEFINE(_name, _type, _op) \
+    static void ucg_reduce_##_name(void *dst, const void *src, size_t count) \
+    { \
+        _type *restrict d       = (_type*)dst; \
+        const _type *restrict s = (const _type*)src; \
+        size_t i; \
+        \
+        for (i = 0; i < count; ++i) { \
+            d[i] = _op(d[i], s[i]); \
+        } \
+    }
+
+
+#define UCG_REDUCE_DT_DEFINE(_dt, _type) \
+    UCG_REDUCE_FUNC_DEFINE(sum_##_dt, _type, UCG_REDUCE_SUM) \
+    UCG_REDUCE_FUNC_DEFINE(min_##_dt, _type, UCG_REDUCE_MIN) \
+    UCG_REDUCE_FUNC_DEFINE(max_##_dt, _type, UCG_REDUCE_MAX)
+
+
+#define UCG_REDUCE_DT_FUNCS(_dt) \
+    { \
+        [UCG_OP_SUM] = ucg_reduce_sum_##_dt, \
+        [UCG_OP_MIN] = ucg_reduce_min_##_dt, \
+        [UCG_OP_MAX] = ucg_reduce_max_##_dt \
+    }
+
+
+UCG_REDUCE_DT_DEFINE(int32, int32_t)
+UCG_REDUCE_DT_DEFINE(int64, int64_t)
+UCG_REDUCE_DT_DEFINE(float, float)
+UCG_REDUCE_DT_DEFINE(double, double)
+
+
+const ucg_reduce_func_t ucg_reduce_funcs[UCG_DT_LAST][UCG_OP_LAST] = {
+    [UCG_DT_INT32]  = UCG_REDUCE_DT_FUNCS(int32),
+    [UCG_DT_INT64]  = UCG_REDUCE_DT_FUNCS(int64),
+    [UCG_DT_FLOAT]  = UCG_REDUCE_DT_FUNCS(float),
+    [UCG_DT_DOUBLE] = UCG_REDUCE_DT_FUNCS(double)
+};
+
+
+const char *ucg_dt_names[] = {
+    [UCG_DT_INT32]  = "int32",
+    [UCG_DT_INT64]  = "int64",
+    [UCG_DT_FLOAT]  = "float",
+    [UCG_DT_DOUBLE] = "double",
+    [UCG_DT_LAST]   = NULL
+};
+
+
+const char *ucg_op_names[] = {
+    [UCG_OP_SUM]  = "sum",
+    [UCG_OP_MIN]  = "min",
+    [UCG_OP_MAX]  = "max",
+    [UCG_OP_LAST] = NULL
+};
+
+
+size_t ucg_dt_size(ucg_dt_t dt)
+{
+    static const size_t dt_sizes[] = {
+        [UCG_DT_INT32]  = sizeof(int32_t),
+        [UCG_DT_INT64]  = sizeof(int64_t),
+        [UCG_DT_FLOAT]  = sizeof(float),
+        [UCG_DT_DOUBLE] = sizeof(double)
+    };
+
+    ucs_assert(dt < UCG_DT_LAST);
+    return dt_sizes[dt];
+}
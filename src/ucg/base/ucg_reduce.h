@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCG_REDUCE_H_
+#define UCG_REDUCE_H_
+
+#include <ucg/api/ucg.h>
+
+
+/**
+ * Reduction kernel: dst[i] = dst[i] <op> src[i], for i in [0, count).
+ * The buffers must not overlap.
+ */
+typedef void (*ucg_reduce_func_t)(void *dst, const void *src, size_t count);
+
+
+/* Reduction kernels, indexed by [datatype][operation] */
+extern const ucg_reduce_func_t ucg_reduce_funcs[UCG_DT_LAST][UCG_OP_LAST];
+
+
+/* Datatype names for debug prints */
+extern const char *ucg_dt_names[];
+
+
+/* Operation names for debug prints */
+extern const char *ucg_op_names[];
+
+#endif
@@ -0,0 +1,7 @@
+#
+# Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+#
+# See file LICENSE for terms.
+#
+
+AC_CONFIG_FILES([src/ucg/Makefile])
@@ -240,7 +240,24 @@ typedef enum {
     /**< Pack addresses of network devices only. Using such shortened addresses
      *   for the remote node peers will reduce the amount of wireup data being
      *   exchanged during connection establishment phase. */
-    UCP_WORKER_ADDRESS_FLAG_NET_ONLY = UCS_BIT(0)
+    UCP_WORKER_ADDRESS_FLAG_NET_ONLY = UCS_BIT(0),
+
+    /**< Publish the device and transport description of the address as a
+     *   dictionary. A peer which has connected to such an address can later
+     *   accept compact addresses of any worker with the same kind of
+     *   resources, for example other processes on the same node or on other
+     *   nodes with the same hardware. Requires address version 2, otherwise
+     *   ignored. */
+    UCP_WORKER_ADDRESS_FLAG_DICT     = UCS_BIT(1),
+
+    /**< Pack a compact address which consists of the worker identity, a
+     *   dictionary reference and the device and interface addresses only.
+     *   The peer must have previously unpacked an address created with
+     *   @ref UCP_WORKER_ADDRESS_FLAG_DICT by a worker with the same kind of
+     *   resources, otherwise endpoint creation fails with
+     *   @ref UCS_ERR_NO_ELEM. Requires address version 2, otherwise
+     *   ignored. */
+    UCP_WORKER_ADDRESS_FLAG_COMPACT  = UCS_BIT(2)
 } ucp_worker_address_flags_t;
 
 
@@ -469,6 +486,43 @@ enum ucp_worker_address_attr_field {
 };
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief UCP worker group parameters field mask.
+ *
+ * The enumeration allows specifying which fields in
+ * @ref ucp_worker_group_params_t are present. It is used to enable backward
+ * compatibility support.
+ */
+enum ucp_worker_group_params_field {
+    UCP_WORKER_GROUP_PARAM_FIELD_NUM_WORKERS   = UCS_BIT(0), /**< Number of
+                                                                  workers */
+    UCP_WORKER_GROUP_PARAM_FIELD_WORKER_PARAMS = UCS_BIT(1), /**< Member worker
+                                                                  parameters */
+    UCP_WORKER_GROUP_PARAM_FIELD_FLAGS         = UCS_BIT(2)  /**< Group flags */
+};
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief UCP worker group flags.
+ *
+ * This enumeration allows specifying flags for @ref ucp_worker_group_params_t.
+ */
+typedef enum {
+    /**
+     * Progress every member worker by an internal thread, which is bound to its
+     * own CPU core from the process affinity mask. The member workers are
+     * created in @ref UCS_THREAD_MODE_MULTI mode, so the application may post
+     * operations on them from any thread. If the context was created with
+     * @ref UCP_FEATURE_WAKEUP, an idle thread waits for events on its worker;
+     * otherwise it polls with an increasing delay, up to 1 millisecond, which
+     * is added to the latency of the first message after an idle period.
+     */
+    UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD = UCS_BIT(0)
+} ucp_worker_group_flags_t;
+
+
 /**
  * @ingroup UCP_WORKER
  * @brief UCP listener attributes field mask.
@@ -604,7 +658,20 @@ enum ucp_am_cb_flags {
      * so the data will be accessible outside the callback, until
      * @ref ucp_am_data_release is called.
      */
-    UCP_AM_FLAG_PERSISTENT_DATA = UCS_BIT(1)
+    UCP_AM_FLAG_PERSISTENT_DATA = UCS_BIT(1),
+
+    /**
+     * Call the @ref ucp_am_recv_callback_t callback as soon as the first
+     * fragment of a message sent by multiple eager fragments arrives, with
+     * @ref UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG flag set. The user provides the
+     * destination buffers (contiguous buffer or IOV, optionally with a memory
+     * handle) by calling @ref ucp_am_recv_data_nbx, and every fragment is
+     * unpacked directly to them as it arrives, in any order, instead of
+     * assembling the whole message in an internal buffer first. This flag can
+     * be set only by @ref ucp_worker_set_am_recv_handler, and is mutually
+     * exclusive with @a UCP_AM_FLAG_PERSISTENT_DATA.
+     */
+    UCP_AM_FLAG_MULTI_FRAG_RECV = UCS_BIT(2)
 };
 
 
@@ -785,7 +852,19 @@ typedef enum {
      * data by calling @ref ucp_am_recv_data_nbx routine. This flag is mutually
      * exclusive with @a UCP_AM_RECV_ATTR_FLAG_DATA.
      */
-    UCP_AM_RECV_ATTR_FLAG_RNDV         = UCS_BIT(17)
+    UCP_AM_RECV_ATTR_FLAG_RNDV         = UCS_BIT(17),
+
+    /**
+     * Indicates that the arriving data is sent by multiple eager fragments, and
+     * only the first fragment has arrived so far. Can be set only if the
+     * callback was registered with @ref UCP_AM_FLAG_MULTI_FRAG_RECV flag. In
+     * this case @a data parameter of the @ref ucp_am_recv_callback_t points to
+     * the internal UCP descriptor, which can be used for receiving the whole
+     * message by @ref ucp_am_recv_data_nbx routine, in the same way as with
+     * @a UCP_AM_RECV_ATTR_FLAG_RNDV. This flag is mutually exclusive with
+     * @a UCP_AM_RECV_ATTR_FLAG_DATA and @a UCP_AM_RECV_ATTR_FLAG_RNDV.
+     */
+    UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG   = UCS_BIT(18)
 } ucp_am_recv_attr_t;
 
 
@@ -1412,6 +1491,42 @@ typedef struct ucp_worker_address_attr {
 } ucp_worker_address_attr_t;
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief Tuning parameters for the UCP worker group.
+ *
+ * The structure defines the parameters that are used for the UCP worker group
+ * tuning during the @ref ucp_worker_group_create "worker group creation".
+ */
+typedef struct ucp_worker_group_params {
+    /**
+     * Mask of valid fields in this structure, using bits from
+     * @ref ucp_worker_group_params_field.
+     * Fields not specified in this mask will be ignored.
+     * Provides ABI compatibility with respect to adding new fields.
+     */
+    uint64_t                    field_mask;
+
+    /**
+     * Number of member workers in the group. If not specified, a worker is
+     * created for every CPU core in the process affinity mask.
+     */
+    unsigned                    num_workers;
+
+    /**
+     * Parameters to create every member worker with. If not specified,
+     * default worker parameters are used.
+     */
+    const ucp_worker_params_t   *worker_params;
+
+    /**
+     * Group flags, using bits from @ref ucp_worker_group_flags_t.
+     * If not specified, 0 is assumed.
+     */
+    uint64_t                    flags;
+} ucp_worker_group_params_t;
+
+
 /**
  * @ingroup UCP_ENDPOINT
  * @brief UCP endpoint performance evaluation request attributes.
@@ -2262,6 +2377,131 @@ void ucp_worker_print_info(ucp_worker_h worker, FILE *stream);
 void ucp_worker_release_address(ucp_worker_h worker, ucp_address_t *address);
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief Create a worker group.
+ *
+ * This routine creates a @ref ucp_worker_group_h "worker group", which consists
+ * of several @ref ucp_worker_h "workers" of the same context. The group has a
+ * single address, obtained by @ref ucp_worker_group_get_address, and
+ * endpoints to remote groups are created by @ref ucp_worker_group_ep_create on
+ * one of the member workers. All endpoints between two groups connect the same
+ * pair of member workers in both directions, and different remote groups are
+ * spread between the members, so the communication of a group with many peers
+ * is divided between its members without routing by the application.
+ *
+ * @note The group does not route receives. Messages from a remote group
+ * arrive only on the member worker which is connected to that group, so
+ * receive operations, such as @ref ucp_tag_recv_nbx, and active message
+ * handlers must be posted or set by the application on that member. An
+ * application which does not know the member of a remote group has to post
+ * its receives and set its handlers on every member worker.
+ *
+ * @param [in]  context       Handle to @ref ucp_context_h
+ *                            "UCP application context".
+ * @param [in]  params        User defined @ref ucp_worker_group_params_t
+ *                            configurations for the @ref ucp_worker_group_h
+ *                            "worker group".
+ * @param [out] group_p       A pointer to the worker group object allocated by
+ *                            the UCP library.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ */
+ucs_status_t ucp_worker_group_create(ucp_context_h context,
+                                     const ucp_worker_group_params_t *params,
+                                     ucp_worker_group_h *group_p);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Destroy a worker group.
+ *
+ * This routine stops the progress threads of the group, if any, and destroys
+ * all its member workers. All endpoints created on the group must be closed
+ * before calling this routine.
+ *
+ * @param [in]  group         Worker group object to destroy.
+ */
+void ucp_worker_group_destroy(ucp_worker_group_h group);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Get the number of member workers in a worker group.
+ *
+ * @param [in]  group         Worker group object to query.
+ *
+ * @return Number of member workers.
+ */
+unsigned ucp_worker_group_get_num_workers(ucp_worker_group_h group);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Get a member worker of a worker group.
+ *
+ * The returned worker can be used with any UCP routine, for example to set
+ * active message handlers or post receive operations, but it must not be
+ * destroyed by the application.
+ *
+ * @param [in]  group         Worker group object.
+ * @param [in]  index         Index of the member worker, less than
+ *                            @ref ucp_worker_group_get_num_workers.
+ *
+ * @return Member worker handle.
+ */
+ucp_worker_h ucp_worker_group_get_worker(ucp_worker_group_h group,
+                                         unsigned index);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Get the address of a worker group.
+ *
+ * This routine returns the address of the worker group, which contains the
+ * addresses of all its member workers. The address has to be passed to remote
+ * peers which call @ref ucp_worker_group_ep_create.
+ *
+ * @param [in]  group            Worker group object.
+ * @param [out] address_p        Filled with a pointer to the group address,
+ *                               which must be released by
+ *                               @ref ucp_worker_group_release_address.
+ * @param [out] address_length_p Filled with the length of the group address.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ */
+ucs_status_t ucp_worker_group_get_address(ucp_worker_group_h group,
+                                          ucp_address_t **address_p,
+                                          size_t *address_length_p);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Release the address of a worker group.
+ *
+ * @param [in]  group         Worker group object.
+ * @param [in]  address       Address to release, which was returned by
+ *                            @ref ucp_worker_group_get_address.
+ */
+void ucp_worker_group_release_address(ucp_worker_group_h group,
+                                      ucp_address_t *address);
+
+
+/**
+ * @ingroup UCP_WORKER
+ * @brief Progress all member workers of a worker group.
+ *
+ * This routine calls @ref ucp_worker_progress on every member worker. It is
+ * intended for groups created without
+ * @ref UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD.
+ *
+ * @param [in]  group         Worker group to progress.
+ *
+ * @return Non-zero if any communication was progressed, zero otherwise.
+ */
+unsigned ucp_worker_group_progress(ucp_worker_group_h group);
+
+
 /**
  * @ingroup UCP_WORKER
  * @brief Get attributes of the particular worker address.
@@ -2379,6 +2619,12 @@ ucs_status_t ucp_worker_get_efd(ucp_worker_h worker, int *fd);
  * notification and may not progress some of the requests as it would when
  * calling @ref ucp_worker_progress (which is not invoked in that duration).
  *
+ * @note If the UCX_WAIT_SPIN_TIME configuration is set, this routine first
+ * calls @ref ucp_worker_progress in a loop for a limited time, and returns
+ * once it reports any events. The spin time adapts to the recent waiting
+ * times, so frequent events are handled without the latency of a blocking
+ * wait.
+ *
  * @note UCP @ref ucp_feature "features" have to be triggered
  *   with @ref UCP_FEATURE_WAKEUP to select proper transport
  *
@@ -2628,6 +2874,61 @@ ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
                            ucp_ep_h *ep_p);
 
 
+/**
+ * @ingroup UCP_ENDPOINT
+ * @brief Create and connect multiple endpoints.
+ *
+ * This routine creates and connects @a count @ref ucp_ep_h "endpoints" on a
+ * @ref ucp_worker_h "local worker", one for every element of @a params, as if
+ * @ref ucp_ep_create was called for each of them. This is a convenience
+ * wrapper, which creates either all of the endpoints or none of them; it is
+ * not faster than calling @ref ucp_ep_create for every element of @a params.
+ *
+ * @param [in]  worker      Handle to the worker; the endpoints are associated
+ *                          with the worker.
+ * @param [in]  count       Number of endpoints to create.
+ * @param [in]  params      Array of @a count @ref ucp_ep_params_t
+ *                          configurations, one for every endpoint.
+ * @param [out] ep_p        Array of @a count handles, filled with the created
+ *                          endpoints in the order of @a params.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ *
+ * @note Every element of @a params has to specify ucp_ep_params_t::address.
+ *
+ * @note If creating any of the endpoints fails, the endpoints which were
+ * already created by this call are destroyed and the error is returned.
+ */
+ucs_status_t ucp_ep_create_batch(ucp_worker_h worker, unsigned count,
+                                 const ucp_ep_params_t *params,
+                                 ucp_ep_h *ep_p);
+
+
+/**
+ * @ingroup UCP_ENDPOINT
+ * @brief Create an endpoint from a worker group to a remote worker group.
+ *
+ * This routine creates an @ref ucp_ep_h "endpoint" to a remote worker group on
+ * one of the member workers of @a group. The local and remote members are
+ * selected by the identities of both groups, such that the endpoint created
+ * by the remote group to this group connects the same pair of member workers.
+ * The endpoint is used as any other endpoint of the selected member worker,
+ * and its operations complete when that worker is progressed.
+ *
+ * @param [in]  group       Handle to the local worker group.
+ * @param [in]  params      User defined @ref ucp_ep_params_t configurations
+ *                          for the @ref ucp_ep_h "UCP endpoint". The
+ *                          ucp_ep_params_t::address field has to be set to an
+ *                          address returned by @ref ucp_worker_group_get_address.
+ * @param [out] ep_p        A handle to the created endpoint.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ */
+ucs_status_t ucp_worker_group_ep_create(ucp_worker_group_h group,
+                                        const ucp_ep_params_t *params,
+                                        ucp_ep_h *ep_p);
+
+
 /**
  * @ingroup UCP_ENDPOINT
  *
@@ -3125,6 +3426,10 @@ void ucp_memh_buffer_release(void *buffer,
  *       "ucp_rkey_destroy()" routine.
  * @note The remote key object can be used for communications only on the
  *       endpoint on which it was unpacked.
+ * @note If the UCX_RKEY_CACHE_SIZE configuration is set, unpacking the same
+ *       buffer on the same endpoint again may return the same remote key
+ *       handle. Every returned handle must still be released by a separate
+ *       call to @ref ucp_rkey_destroy "ucp_rkey_destroy()".
  *
  * @param [in]  ep            Endpoint to access using the remote key.
  * @param [in]  rkey_buffer   Packed rkey.
@@ -3280,6 +3585,12 @@ ucs_status_ptr_t ucp_am_send_nbx(ucp_ep_h ep, unsigned id,
  *       Data descriptor is considered to be valid if:
  *       - It is a rendezvous request (@a UCP_AM_RECV_ATTR_FLAG_RNDV is set in
  *         @ref ucp_am_recv_param_t.recv_attr) or
+ *       - It is a multi-fragment eager message
+ *         (@a UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG is set in
+ *         @ref ucp_am_recv_param_t.recv_attr). In this case the remaining
+ *         fragments are unpacked directly to @a buffer as they arrive, and the
+ *         operation completes when all of them were received. @a buffer must
+ *         be large enough to hold the whole message, or
  *       - It is a persistent data pointer (@a UCP_AM_RECV_ATTR_FLAG_DATA is set
  *         in @ref ucp_am_recv_param_t.recv_attr). In this case receive
  *         operation may be needed to unpack data to device memory (for example
@@ -246,6 +246,19 @@ enum ucp_mem_attr_field {
  typedef struct ucp_worker                *ucp_worker_h;
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief UCP Worker group
+ *
+ * UCP worker group is a set of @ref ucp_worker_h "workers" of the same
+ * context, which is addressed by remote peers as a single entity. Every member
+ * worker is typically driven by its own thread running on its own core, and
+ * endpoints created on the group are spread between the members by remote
+ * peer.
+ */
+typedef struct ucp_worker_group          *ucp_worker_group_h;
+
+
 /**
  * @ingroup UCP_COMM
  * @brief UCP Tag Identifier
@@ -41,16 +41,129 @@ void ucp_am_cleanup(ucp_worker_h worker)
     ucs_array_cleanup_dynamic(&worker->am.cbs);
 }
 
-void ucp_am_ep_init(ucp_ep_h ep)
+static UCS_F_ALWAYS_INLINE ucp_am_first_ftr_t *
+ucp_am_multi_frag_first_ftr(ucp_recv_desc_t *desc)
 {
-    ucp_ep_ext_t *ep_ext = ep->ext;
+    return UCS_PTR_BYTE_OFFSET(desc + 1,
+                               desc->length - sizeof(ucp_am_first_ftr_t));
+}
+
+static UCS_F_ALWAYS_INLINE ucp_request_t *
+ucp_am_multi_frag_req(ucp_recv_desc_t *mf_rdesc)
+{
+    return ((ucp_am_multi_frag_t*)(mf_rdesc + 1))->req;
+}
+
+static void ucp_am_multi_frag_complete(ucp_recv_desc_t *mf_rdesc,
+                                       ucs_status_t status)
+{
+    ucp_request_t *req = ucp_am_multi_frag_req(mf_rdesc);
+
+    ucs_list_del(&mf_rdesc->am_first.list);
+    if (req != NULL) {
+        if (req->status != UCS_OK) {
+            status = req->status;
+        }
+
+        ucp_datatype_iter_cleanup(&req->recv.dt_iter, 1, UCP_DT_MASK_ALL);
+        ucp_request_complete_am_recv(req, status);
+    }
+
+    ucs_free(mf_rdesc);
+}
+
+static UCS_F_ALWAYS_INLINE void
+ucp_am_multi_frag_unpack(ucp_worker_h worker, ucp_recv_desc_t *mf_rdesc,
+                         const void *data, size_t length, size_t offset)
+{
+    ucp_request_t *req = ucp_am_multi_frag_req(mf_rdesc);
+    ucs_status_t status;
+
+    ucs_assert(mf_rdesc->am_first.remaining >= length);
+    mf_rdesc->am_first.remaining -= length;
+
+    if ((req == NULL) || ucs_unlikely(req->status != UCS_OK)) {
+        /* The message is dropped */
+        return;
+    }
 
-    if (ep->worker->context->config.features & UCP_FEATURE_AM) {
-        ucs_list_head_init(&ep_ext->am.started_ams);
-        ucs_queue_head_init(&ep_ext->am.mid_rdesc_q);
+    status = UCS_PROFILE_CALL(ucp_datatype_iter_unpack, &req->recv.dt_iter,
+                              worker, length, offset, data);
+    if (ucs_unlikely(status != UCS_OK)) {
+        req->status = status;
     }
 }
 
+/*
+ * Start receiving the multi-fragment message, which first fragment is held by
+ * desc, to the user buffer described by req. If req is NULL, the message is
+ * dropped.
+ */
+static ucs_status_t ucp_am_multi_frag_start(ucp_worker_h worker,
+                                            ucp_recv_desc_t *desc,
+                                            ucp_request_t *req)
+{
+    ucp_am_first_ftr_t *first_ftr = ucp_am_multi_frag_first_ftr(desc);
+    ucp_am_hdr_t *hdr             = (ucp_am_hdr_t*)(desc + 1);
+    ucp_recv_desc_t *mf_rdesc, *mid_rdesc;
+    ucp_am_multi_frag_t *mf;
+    ucp_am_mid_hdr_t *mid_hdr;
+    ucp_am_mid_ftr_t *mid_ftr;
+    ucs_queue_iter_t iter;
+    ucp_ep_ext_t *ep_ext;
+    ucp_ep_h ep;
+
+    UCP_WORKER_GET_VALID_EP_BY_ID(&ep, worker, first_ftr->super.ep_id,
+                                  return UCS_ERR_CANCELED,
+                                  "AM multi-fragment receive");
+    ep_ext = ep->ext;
+
+    mf_rdesc = ucs_malloc(sizeof(*mf_rdesc) + sizeof(*mf),
+                          "ucp recv desc for multi-fragment AM");
+    if (ucs_unlikely(mf_rdesc == NULL)) {
+        ucs_error("failed to allocate descriptor for receiving UCP AM (id %u)",
+                  hdr->am_id);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    mf_rdesc->flags              = UCP_RECV_DESC_FLAG_MALLOC |
+                                   UCP_RECV_DESC_FLAG_AM_MULTI_FRAG;
+    mf_rdesc->am_first.remaining = first_ftr->total_size;
+    mf                           = (ucp_am_multi_frag_t*)(mf_rdesc + 1);
+    mf->first_ftr                = *first_ftr;
+    mf->req                      = req;
+    ucs_list_add_tail(&ep_ext->cold->am.started_ams, &mf_rdesc->am_first.list);
+
+    ucp_am_multi_frag_unpack(worker, mf_rdesc, hdr + 1,
+                             desc->length - (hdr->header_length +
+                                             UCP_AM_FIRST_FRAG_META_LEN),
+                             0);
+
+    /* Unpack the middle fragments which arrived before the receive was
+     * started */
+    ucs_queue_for_each_safe(mid_rdesc, iter, &ep_ext->cold->am.mid_rdesc_q,
+                            am_mid_queue) {
+        mid_ftr = UCS_PTR_BYTE_OFFSET(mid_rdesc + 1,
+                                      mid_rdesc->length - sizeof(*mid_ftr));
+        if (mid_ftr->msg_id != first_ftr->super.msg_id) {
+            continue;
+        }
+
+        mid_hdr = (ucp_am_mid_hdr_t*)(mid_rdesc + 1);
+        ucs_queue_del_iter(&ep_ext->cold->am.mid_rdesc_q, iter);
+        ucp_am_multi_frag_unpack(worker, mf_rdesc, mid_hdr + 1,
+                                 mid_rdesc->length - UCP_AM_MID_FRAG_META_LEN,
+                                 mid_hdr->offset);
+        ucp_recv_desc_release(mid_rdesc);
+    }
+
+    if (mf_rdesc->am_first.remaining == 0) {
+        ucp_am_multi_frag_complete(mf_rdesc, UCS_OK);
+    }
+
+    return UCS_OK;
+}
+
 void ucp_am_ep_cleanup(ucp_ep_h ep)
 {
     ucp_ep_ext_t *ep_ext = ep->ext;
@@ -58,24 +171,29 @@ void ucp_am_ep_cleanup(ucp_ep_h ep)
     ucs_queue_iter_t iter;
     size_t count;
 
-    if (!(ep->worker->context->config.features & UCP_FEATURE_AM)) {
+    if (!(ep->worker->context->config.features & UCP_FEATURE_AM) ||
+        (ep_ext->cold == NULL)) {
         return;
     }
 
     count = 0;
-    ucs_list_for_each_safe(rdesc, tmp_rdesc, &ep_ext->am.started_ams,
+    ucs_list_for_each_safe(rdesc, tmp_rdesc, &ep_ext->cold->am.started_ams,
                            am_first.list) {
-        ucs_list_del(&rdesc->am_first.list);
-        ucs_free(rdesc);
+        if (rdesc->flags & UCP_RECV_DESC_FLAG_AM_MULTI_FRAG) {
+            ucp_am_multi_frag_complete(rdesc, UCS_ERR_CANCELED);
+        } else {
+            ucs_list_del(&rdesc->am_first.list);
+            ucs_free(rdesc);
+        }
         ++count;
     }
     ucs_trace_data("worker %p: %zu unhandled first AM fragments have been"
                    " dropped on ep %p", ep->worker, count, ep);
 
     count = 0;
-    ucs_queue_for_each_safe(rdesc, iter, &ep_ext->am.mid_rdesc_q,
+    ucs_queue_for_each_safe(rdesc, iter, &ep_ext->cold->am.mid_rdesc_q,
                             am_mid_queue) {
-        ucs_queue_del_iter(&ep_ext->am.mid_rdesc_q, iter);
+        ucs_queue_del_iter(&ep_ext->cold->am.mid_rdesc_q, iter);
         ucp_recv_desc_release(rdesc);
         ++count;
     }
@@ -158,6 +276,10 @@ UCS_PROFILE_FUNC_VOID(ucp_am_data_release, (worker, data),
     }
 
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+    if (rdesc->flags & UCP_RECV_DESC_FLAG_AM_MULTI_FRAG) {
+        /* The message is not needed, drop its remaining fragments */
+        ucp_am_multi_frag_start(worker, rdesc, NULL);
+    }
     ucp_recv_desc_release(rdesc);
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
 }
@@ -214,6 +336,12 @@ ucs_status_t ucp_worker_set_am_handler(ucp_worker_h worker, uint16_t id,
 {
     ucs_status_t status;
 
+    if (flags & UCP_AM_FLAG_MULTI_FRAG_RECV) {
+        ucs_error("UCP_AM_FLAG_MULTI_FRAG_RECV flag is not supported by "
+                  "ucp_worker_set_am_handler()");
+        return UCS_ERR_INVALID_PARAM;
+    }
+
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
 
     status = ucp_worker_set_am_handler_common(worker, id, flags);
@@ -330,6 +458,13 @@ ucs_status_t ucp_worker_set_am_recv_handler(ucp_worker_h worker,
     id    = param->id;
     flags = UCP_PARAM_VALUE(AM_HANDLER, param, flags, FLAGS, 0);
 
+    if (ucs_test_all_flags(flags, UCP_AM_FLAG_MULTI_FRAG_RECV |
+                                  UCP_AM_FLAG_PERSISTENT_DATA)) {
+        ucs_error("UCP_AM_FLAG_MULTI_FRAG_RECV and UCP_AM_FLAG_PERSISTENT_DATA "
+                  "flags are mutually exclusive");
+        return UCS_ERR_INVALID_PARAM;
+    }
+
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
 
     status = ucp_worker_set_am_handler_common(worker, id, flags);
@@ -1058,6 +1193,75 @@ ucs_status_ptr_t ucp_am_send_nb(ucp_ep_h ep, uint16_t id, const void *payload,
     return ucp_am_send_nbx(ep, id, NULL, 0, payload, count, &params);
 }
 
+static UCS_F_ALWAYS_INLINE void ucp_am_recv_desc_done(ucp_recv_desc_t *desc)
+{
+    if (desc->flags & UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS) {
+        /* Clear this flag, because receive operation is already completed and
+         * desc is not needed anymore. If receive operation was invoked from
+         * UCP AM callback, UCT AM handler would release this desc (by
+         * returning UCS_OK) back to UCT.
+         */
+        desc->flags &= ~UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS;
+    } else {
+        ucp_recv_desc_release(desc);
+    }
+}
+
+static ucs_status_ptr_t
+ucp_am_recv_data_multi_frag(ucp_worker_h worker, ucp_recv_desc_t *desc,
+                            void *buffer, size_t count,
+                            const ucp_request_param_t *param)
+{
+    size_t total_size = ucp_am_multi_frag_first_ftr(desc)->total_size;
+    ucp_request_t *req;
+    ucs_status_t status;
+
+    req = ucp_request_get_param(worker, param,
+                                {status = UCS_ERR_NO_MEMORY;
+                                 goto err;});
+
+    req->status       = UCS_OK;
+    req->recv.worker  = worker;
+    req->flags        = UCP_REQUEST_FLAG_RECV_AM;
+    req->recv.op_attr = param->op_attr_mask;
+    /* The first fragment is unpacked right away, so the descriptor is not
+     * needed by the request */
+    req->recv.am.desc = NULL;
+
+    status = ucp_datatype_iter_init_unpack(worker->context, buffer, count,
+                                           &req->recv.dt_iter, param);
+    if (ucs_unlikely(status != UCS_OK)) {
+        goto err_put;
+    }
+
+    if (ucs_unlikely(req->recv.dt_iter.length < total_size)) {
+        ucs_error("AM rx buffer too small %zu, need %zu",
+                  req->recv.dt_iter.length, total_size);
+        status = UCS_ERR_MESSAGE_TRUNCATED;
+        goto err_cleanup;
+    }
+
+    req->recv.dt_iter.length = total_size;
+    ucp_request_set_callback_param(param, recv_am, req, recv.am);
+
+    status = ucp_am_multi_frag_start(worker, desc, req);
+    if (ucs_unlikely(status != UCS_OK)) {
+        ucp_datatype_iter_cleanup(&req->recv.dt_iter, 1, UCP_DT_MASK_ALL);
+        ucp_request_put_param(param, req);
+        return UCS_STATUS_PTR(status);
+    }
+
+    return req + 1;
+
+err_cleanup:
+    ucp_datatype_iter_cleanup(&req->recv.dt_iter, 1, UCP_DT_MASK_ALL);
+err_put:
+    ucp_request_put_param(param, req);
+err:
+    ucp_am_multi_frag_start(worker, desc, NULL);
+    return UCS_STATUS_PTR(status);
+}
+
 UCS_PROFILE_FUNC(ucs_status_ptr_t, ucp_am_recv_data_nbx,
                  (worker, data_desc, buffer, count, param),
                  ucp_worker_h worker, void *data_desc, void *buffer,
@@ -1094,9 +1298,17 @@ UCS_PROFILE_FUNC(ucs_status_ptr_t, ucp_am_recv_data_nbx,
     desc->flags |= UCP_RECV_DESC_FLAG_RECV_STARTED;
 
     ucs_trace("AM recv %s buffer %p dt 0x%lx count %zu",
-              (desc->flags & UCP_RECV_DESC_FLAG_RNDV) ? "rndv" : "eager",
+              (desc->flags & UCP_RECV_DESC_FLAG_RNDV)           ? "rndv" :
+              (desc->flags & UCP_RECV_DESC_FLAG_AM_MULTI_FRAG) ? "multi" :
+                                                                 "eager",
               buffer, ucp_request_param_datatype(param), count);
 
+    if (desc->flags & UCP_RECV_DESC_FLAG_AM_MULTI_FRAG) {
+        ret = ucp_am_recv_data_multi_frag(worker, desc, buffer, count, param);
+        ucp_am_recv_desc_done(desc);
+        goto out;
+    }
+
     if (ucs_unlikely((desc->flags & UCP_RECV_DESC_FLAG_RNDV) &&
                      (count > 0ul))) {
         req = ucp_request_get_param(worker, param,
@@ -1170,16 +1382,7 @@ UCS_PROFILE_FUNC(ucs_status_ptr_t, ucp_am_recv_data_nbx,
     }
 
     ucs_assert(status != UCS_INPROGRESS);
-    if (desc->flags & UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS) {
-        /* Clear this flag, because receive operation is already completed and
-         * desc is not needed anymore. If receive operation was invoked from
-         * UCP AM callback, UCT AM handler would release this desc (by
-         * returning UCS_OK) back to UCT.
-         */
-        desc->flags &= ~UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS;
-    } else {
-        ucp_recv_desc_release(desc);
-    }
+    ucp_am_recv_desc_done(desc);
 
 out:
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
@@ -1334,7 +1537,11 @@ ucp_am_find_first_rdesc(ucp_worker_h worker, ucp_ep_ext_t *ep_ext,
     ucp_recv_desc_t *rdesc;
     ucp_am_first_ftr_t *first_ftr;
 
-    ucs_list_for_each(rdesc, &ep_ext->am.started_ams, am_first.list) {
+    if (ep_ext->cold == NULL) {
+        return NULL;
+    }
+
+    ucs_list_for_each(rdesc, &ep_ext->cold->am.started_ams, am_first.list) {
         first_ftr = (ucp_am_first_ftr_t*)(rdesc + 1);
         if (first_ftr->super.msg_id == msg_id) {
             return rdesc;
@@ -1434,6 +1641,70 @@ ucp_am_handle_unfinished(ucp_worker_h worker, ucp_recv_desc_t *first_rdesc,
     return;
 }
 
+static UCS_F_ALWAYS_INLINE int
+ucp_am_multi_frag_recv_enabled(ucp_worker_h worker, uint16_t am_id)
+{
+    return (am_id < ucs_array_length(&worker->am.cbs)) &&
+           (ucs_array_elem(&worker->am.cbs, am_id).flags &
+            UCP_AM_FLAG_MULTI_FRAG_RECV);
+}
+
+/*
+ * Pass the first fragment of a multi-fragment message to the user callback, to
+ * let it provide the buffer for the whole message.
+ */
+static ucs_status_t
+ucp_am_multi_frag_first_handler(ucp_worker_h worker, ucp_ep_h ep,
+                                void *am_data, size_t am_length,
+                                unsigned am_flags)
+{
+    ucp_am_hdr_t *hdr             = am_data;
+    ucp_am_entry_t *am_cb         = &ucs_array_elem(&worker->am.cbs,
+                                                    hdr->am_id);
+    ucp_am_first_ftr_t *first_ftr = UCS_PTR_BYTE_OFFSET(am_data,
+                                                        am_length -
+                                                        sizeof(*first_ftr));
+    ucp_am_recv_param_t param;
+    ucs_status_t status, desc_status;
+    ucp_recv_desc_t *desc;
+    void *user_hdr;
+
+    desc_status = ucp_recv_desc_init(worker, am_data, am_length, 0, am_flags, 0,
+                                     UCP_RECV_DESC_FLAG_AM_MULTI_FRAG |
+                                     UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS, 0, 1,
+                                     "am_multi_frag_first_handler", &desc);
+    if (ucs_unlikely(UCS_STATUS_IS_ERR(desc_status))) {
+        ucs_error("worker %p could not allocate descriptor for active"
+                  " message first fragment on callback %u", worker,
+                  hdr->am_id);
+        return UCS_OK;
+    }
+
+    user_hdr        = (hdr->header_length != 0) ?
+                      UCS_PTR_BYTE_OFFSET(first_ftr,
+                                          -(ssize_t)hdr->header_length) :
+                      NULL;
+    param.recv_attr = UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG |
+                      ucp_am_hdr_reply_ep(worker, hdr->flags, ep,
+                                          &param.reply_ep);
+    status          = am_cb->cb(am_cb->context, user_hdr, hdr->header_length,
+                                desc + 1, first_ftr->total_size, &param);
+    if (ucp_am_rdesc_in_progress(desc, status)) {
+        /* User wants to start the receive later */
+        desc->flags &= ~UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS;
+        return desc_status;
+    } else if (!(desc->flags & UCP_RECV_DESC_FLAG_RECV_STARTED)) {
+        /* User does not need the message, drop its remaining fragments */
+        ucp_am_multi_frag_start(worker, desc, NULL);
+    }
+
+    if (!(desc->flags & UCP_RECV_DESC_FLAG_UCT_DESC)) {
+        ucp_recv_desc_release(desc);
+    }
+
+    return UCS_OK;
+}
+
 UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
                  (am_arg, am_data, am_length, am_flags),
                  void *am_arg, void *am_data, size_t am_length,
@@ -1472,11 +1743,20 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
                                      "am_long_first_handler");
     }
 
+    if (ucs_unlikely(ucp_ep_ext_cold_get(ep_ext) == NULL)) {
+        return UCS_OK; /* release UCT desc */
+    }
+
     /* This is the first fragment, other fragments (if arrived) should be on
-     * ep_ext->am.mid_rdesc_q queue */
+     * ep_ext->cold->am.mid_rdesc_q queue */
     ucs_assert(NULL == ucp_am_find_first_rdesc(worker, ep_ext,
                                                first_ftr->super.msg_id));
 
+    if (ucp_am_multi_frag_recv_enabled(worker, hdr->am_id)) {
+        return ucp_am_multi_frag_first_handler(worker, ep, am_data, am_length,
+                                               am_flags);
+    }
+
     /* Alloc buffer for the data and its desc, as we know total_size.
      * Need to allocate a separate rdesc which would be in one contigious chunk
      * with data buffer. The layout of assembled message is below:
@@ -1501,6 +1781,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
                                   first_rdesc + 1, UCP_AM_FIRST_FRAG_META_LEN),
                           worker->am.alignment);
 
+    first_rdesc->flags              = UCP_RECV_DESC_FLAG_MALLOC;
     first_rdesc->payload_offset     = UCP_AM_FIRST_FRAG_META_LEN + padding;
     first_rdesc->am_first.remaining = first_ftr->total_size;
 
@@ -1522,7 +1803,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
                            user_hdr, user_hdr_length);
 
     /* Copy all already arrived middle fragments to the data buffer */
-    ucs_queue_for_each_safe(mid_rdesc, iter, &ep_ext->am.mid_rdesc_q,
+    ucs_queue_for_each_safe(mid_rdesc, iter, &ep_ext->cold->am.mid_rdesc_q,
                             am_mid_queue) {
         mid_ftr = UCS_PTR_BYTE_OFFSET(mid_rdesc + 1,
                                       mid_rdesc->length - sizeof(*mid_ftr));
@@ -1531,7 +1812,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
         }
 
         mid_hdr = (ucp_am_mid_hdr_t*)(mid_rdesc + 1);
-        ucs_queue_del_iter(&ep_ext->am.mid_rdesc_q, iter);
+        ucs_queue_del_iter(&ep_ext->cold->am.mid_rdesc_q, iter);
         ucp_am_copy_data_fragment(first_rdesc, mid_hdr + 1,
                                   mid_rdesc->length - UCP_AM_MID_FRAG_META_LEN,
                                   mid_hdr->offset +
@@ -1539,7 +1820,8 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
         ucp_recv_desc_release(mid_rdesc);
     }
 
-    ucs_list_add_tail(&ep_ext->am.started_ams, &first_rdesc->am_first.list);
+    ucs_list_add_tail(&ep_ext->cold->am.started_ams,
+                      &first_rdesc->am_first.list);
 
     /* Note: copy first chunk of data together with AM header, which contains
      * data needed to process other fragments. */
@@ -1574,7 +1856,17 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_middle_handler,
 
     ep_ext      = ep->ext;
     first_rdesc = ucp_am_find_first_rdesc(worker, ep_ext, mid_ftr->msg_id);
-    if (first_rdesc != NULL) {
+    if ((first_rdesc != NULL) &&
+        (first_rdesc->flags & UCP_RECV_DESC_FLAG_AM_MULTI_FRAG)) {
+        /* The receive was started, unpack the data to the user buffer */
+        ucp_am_multi_frag_unpack(worker, first_rdesc, mid_hdr + 1,
+                                 am_length - UCP_AM_MID_FRAG_META_LEN,
+                                 mid_hdr->offset);
+        if (first_rdesc->am_first.remaining == 0) {
+            ucp_am_multi_frag_complete(first_rdesc, UCS_OK);
+        }
+        return UCS_OK;
+    } else if (first_rdesc != NULL) {
         /* First fragment already arrived, just copy the data */
         ucp_am_handle_unfinished(worker, first_rdesc, mid_hdr + 1,
                                  am_length - UCP_AM_MID_FRAG_META_LEN,
@@ -1586,6 +1878,10 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_middle_handler,
     /* Init desc and put it on the queue in ep AM extension, because data
      * buffer is not allocated yet. When first fragment arrives (carrying total
      * data size), all middle fragments will be copied to the data buffer. */
+    if (ucs_unlikely(ucp_ep_ext_cold_get(ep_ext) == NULL)) {
+        return UCS_OK; /* release UCT desc */
+    }
+
     status = ucp_recv_desc_init(worker, am_data, am_length, 0, am_flags,
                                 sizeof(*mid_hdr), 0, 0, 1,
                                 "am_long_middle_handler", &mid_rdesc);
@@ -1596,7 +1892,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_middle_handler,
     }
 
     ucs_assert(mid_rdesc != NULL);
-    ucs_queue_push(&ep_ext->am.mid_rdesc_q, &mid_rdesc->am_mid_queue);
+    ucs_queue_push(&ep_ext->cold->am.mid_rdesc_q, &mid_rdesc->am_mid_queue);
 
     return status;
 }
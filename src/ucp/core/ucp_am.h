@@ -116,6 +116,19 @@ typedef struct {
 } ucp_am_first_desc_t;
 
 
+/**
+ * State of a multi-fragment message, which is received directly to the user
+ * buffer. Follows ucp_recv_desc_t on the list of unfinished AM's.
+ */
+typedef struct {
+    ucp_am_first_ftr_t       first_ftr;   /* Copy of the first fragment footer,
+                                             must be first to match middle
+                                             fragments by message id */
+    ucp_request_t            *req;        /* Receive request, or NULL if the
+                                             message is dropped */
+} ucp_am_multi_frag_t;
+
+
 #define UCP_AM_FIRST_FRAG_META_LEN \
     (sizeof(ucp_am_hdr_t) + sizeof(ucp_am_first_ftr_t))
 
@@ -128,8 +141,6 @@ ucs_status_t ucp_am_init(ucp_worker_h worker);
 
 void ucp_am_cleanup(ucp_worker_h worker);
 
-void ucp_am_ep_init(ucp_ep_h ep);
-
 void ucp_am_ep_cleanup(ucp_ep_h ep);
 
 ucs_status_t ucp_proto_progress_am_rndv_rts(uct_pending_req_t *self);
@@ -54,7 +54,8 @@
     _macro(UCP_AM_ID_AM_SINGLE) \
     _macro(UCP_AM_ID_AM_FIRST) \
     _macro(UCP_AM_ID_AM_MIDDLE) \
-    _macro(UCP_AM_ID_AM_SINGLE_REPLY)
+    _macro(UCP_AM_ID_AM_SINGLE_REPLY) \
+    _macro(UCP_AM_ID_ATOMIC_REP_BATCH)
 
 #define UCP_AM_HANDLER_DECL(_id) extern ucp_am_handler_t ucp_am_handler_##_id;
 
@@ -197,6 +198,16 @@ static ucs_config_field_t ucp_context_config_table[] = {
    ucs_offsetof(ucp_context_config_t, multi_path_ratio),
    UCS_CONFIG_TYPE_POS_DOUBLE},
 
+  {"MULTI_LANE_DYNAMIC", "n",
+   "Select the lane for each fragment of a multi-lane protocol according to the\n"
+   "amount of data already queued on each interface, instead of splitting the\n"
+   "message by the static bandwidth ratio. Zero-copy fragments are counted on\n"
+   "their interface until the transport completes them. Data sent by copy is\n"
+   "estimated from its size and the interface bandwidth, and the estimate is\n"
+   "increased when the interface runs out of send resources. This allows a\n"
+   "message to bypass a congested lane.",
+   ucs_offsetof(ucp_context_config_t, multi_lane_dynamic), UCS_CONFIG_TYPE_BOOL},
+
   {"MAX_EAGER_LANES", NULL, "",
    ucs_offsetof(ucp_context_config_t, max_eager_lanes), UCS_CONFIG_TYPE_UINT},
 
@@ -242,6 +253,26 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "Segment size that is used to perform data transfer when doing RKEY PTR progress",
    ucs_offsetof(ucp_context_config_t, rkey_ptr_seg_size), UCS_CONFIG_TYPE_MEMUNITS},
 
+  {"SHM_HEAP_MAX_ALLOC", "0",
+   "Maximal size of a buffer allocated by ucp_mem_map() with UCP_MEM_MAP_ALLOCATE\n"
+   "flag, which is carved from a shared memory heap. The heap segments are\n"
+   "allocated according to ALLOC_PRIO, so by default they can be mapped by peers\n"
+   "on the same node, and rendezvous protocol may copy the data directly from the\n"
+   "send buffer. Larger buffers are allocated as separate segments.\n"
+   "The buffers carved from the same segment share its memory registration, so\n"
+   "a remote key of any of them exposes the whole segment to the peer. Do not\n"
+   "enable the heap if buffers allocated by ucp_mem_map() have to be isolated\n"
+   "from each other.\n"
+   "0 disables the shared memory heap, as well as the rendezvous lane which\n"
+   "copies from remote memory allocated by a shared memory transport.",
+   ucs_offsetof(ucp_context_config_t, shm_heap_max_alloc),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
+  {"SHM_HEAP_SEG_SIZE", "16m",
+   "Minimal size of a segment allocated by the shared memory heap.",
+   ucs_offsetof(ucp_context_config_t, shm_heap_seg_size),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
   {"ZCOPY_THRESH", "auto",
    "Threshold for switching from buffer copy to zero copy protocol",
    ucs_offsetof(ucp_context_config_t, zcopy_thresh), UCS_CONFIG_TYPE_MEMUNITS},
@@ -314,6 +345,15 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "cases (non-contig buffer, or sender wildcard).",
    ucs_offsetof(ucp_context_config_t, tm_force_thresh), UCS_CONFIG_TYPE_MEMUNITS},
 
+  {"TAG_SELF_BYPASS", "y",
+   "Deliver tag messages sent on an endpoint connected to the local worker\n"
+   "directly from the send buffer, without going through the \"self\"\n"
+   "transport: a message is copied once to a matching receive buffer. If no\n"
+   "receive is posted yet, a message which would be sent by rendezvous\n"
+   "protocol is queued by reference, and its send operation completes when it\n"
+   "is received.",
+   ucs_offsetof(ucp_context_config_t, tag_self_bypass), UCS_CONFIG_TYPE_BOOL},
+
   {"TM_SW_RNDV", "n",
    "Use software rendezvous protocol even when tag matching offload is enabled.\n"
    "In this case tag matching offload will be used for messages sent with eager\n"
@@ -349,6 +389,21 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "Use two stage pipeline rendezvous protocol for intra-node GPU to GPU transfers",
    ucs_offsetof(ucp_context_config_t, rndv_shm_ppln_enable), UCS_CONFIG_TYPE_BOOL},
 
+  {"RNDV_PIPELINE_INIT_FRAG_SIZE", "inf",
+   "Size of the first fragment sent by the rendezvous pipeline protocol. The\n"
+   "fragment size is doubled as long as the bandwidth observed on completed\n"
+   "fragments keeps improving, up to the maximal fragment size. \"inf\" means\n"
+   "always using the maximal fragment size.",
+   ucs_offsetof(ucp_context_config_t, rndv_ppln_init_frag_size),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
+  {"RNDV_PIPELINE_MAX_INFLIGHT", "inf",
+   "Maximal total size of rendezvous pipeline fragments in progress on a worker.\n"
+   "A pipeline request which exceeds the limit continues with a single fragment\n"
+   "at a time, and sends more fragments as the previous ones complete.",
+   ucs_offsetof(ucp_context_config_t, rndv_ppln_max_inflight),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
   {"FLUSH_WORKER_EPS", "y",
    "Enable flushing the worker by flushing its endpoints. Allows completing\n"
    "the flush operation in a bounded time even if there are new requests on\n"
@@ -390,11 +445,27 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "connected, useful for testing purposes only",
    ucs_offsetof(ucp_context_config_t, proto_request_reset), UCS_CONFIG_TYPE_BOOL},
 
+  {"ON_DEMAND_LANES", "n",
+   "Connect endpoint lanes which are not used for active messages, wireup or\n"
+   "keepalive only when a protocol sends on them for the first time. Applies to\n"
+   "lanes connected to a remote interface, of endpoints created from a remote\n"
+   "worker address. Reduces connection setup time and transport resources when\n"
+   "most peers use only a subset of the operations.",
+   ucs_offsetof(ucp_context_config_t, on_demand_lanes), UCS_CONFIG_TYPE_BOOL},
+
   {"KEEPALIVE_INTERVAL", "20s",
    "Time interval between keepalive rounds. Must be non-zero value.",
    ucs_offsetof(ucp_context_config_t, keepalive_interval),
    UCS_CONFIG_TYPE_TIME_UNITS},
 
+  {"WAIT_SPIN_TIME", "0",
+   "Maximal time ucp_worker_wait() progresses the worker in a busy loop before\n"
+   "it arms the worker and blocks. The actual spin time adapts to the recent\n"
+   "waiting times: it is about twice their average, and spinning is skipped if\n"
+   "events arrive less frequently than this value. 0 disables spinning.",
+   ucs_offsetof(ucp_context_config_t, wait_spin_time),
+   UCS_CONFIG_TYPE_TIME_UNITS},
+
   {"KEEPALIVE_NUM_EPS", "128",
    "Maximal number of endpoints to check on every keepalive round\n"
    "(inf - check all endpoints on every round, must be greater than 0)",
@@ -433,6 +504,14 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "dynamically allocated memory.",
    ucs_offsetof(ucp_context_config_t, rkey_mpool_max_md), UCS_CONFIG_TYPE_INT},
 
+  {"RKEY_CACHE_SIZE", "0",
+   "Maximal number of remote keys unpacked by ucp_ep_rkey_unpack() which are\n"
+   "kept in a per-worker cache. Unpacking the same remote key buffer on the\n"
+   "same endpoint again returns the cached remote key instead of unpacking\n"
+   "it from scratch. Least recently used remote keys are evicted when the\n"
+   "cache is full. 0 disables the cache.",
+   ucs_offsetof(ucp_context_config_t, rkey_cache_size), UCS_CONFIG_TYPE_UINT},
+
   {"ADDRESS_VERSION", "v1",
    "Defines UCP worker address format obtained with ucp_worker_get_address() or\n"
    "ucp_worker_query() routines.",
@@ -2210,6 +2289,11 @@ ucs_status_t ucp_init_version(unsigned api_major_version, unsigned api_minor_ver
         context->rcache = NULL;
     }
 
+    status = ucp_mem_shm_heap_init(context);
+    if (status != UCS_OK) {
+        goto err_rcache_cleanup;
+    }
+
     if (dfl_config != NULL) {
         ucp_config_release(dfl_config);
     }
@@ -2224,6 +2308,8 @@ ucs_status_t ucp_init_version(unsigned api_major_version, unsigned api_minor_ver
     *context_p = context;
     return UCS_OK;
 
+err_rcache_cleanup:
+    ucp_mem_rcache_cleanup(context);
 err_free_res:
     ucp_free_resources(context);
 err_thread_lock_finalize:
@@ -2242,6 +2328,7 @@ err:
 void ucp_cleanup(ucp_context_h context)
 {
     ucs_vfs_obj_remove(context);
+    ucp_mem_shm_heap_cleanup(context);
     ucp_mem_rcache_cleanup(context);
     ucp_free_resources(context);
     ucp_free_config(context);
@@ -19,6 +19,7 @@
 #include <uct/api/uct.h>
 #include <uct/api/v2/uct_v2.h>
 #include <ucs/datastruct/mpool.h>
+#include <ucs/datastruct/mpool_set.h>
 #include <ucs/datastruct/queue_types.h>
 #include <ucs/datastruct/bitmap.h>
 #include <ucs/datastruct/conn_match.h>
@@ -63,12 +64,18 @@ typedef struct ucp_context_config {
     double                                 multi_lane_max_ratio;
     /* Bandwidth efficiency ratio */
     double                                 multi_path_ratio;
+    /** Select multi-lane protocol lanes according to their queued data */
+    int                                    multi_lane_dynamic;
     /** Threshold for switching UCP to zero copy protocol */
     size_t                                 zcopy_thresh;
     /** Communication scheme in RNDV protocol */
     ucp_rndv_mode_t                        rndv_mode;
     /** RKEY PTR segment size */
     size_t                                 rkey_ptr_seg_size;
+    /** Maximal size of a buffer allocated from the shared memory heap */
+    size_t                                 shm_heap_max_alloc;
+    /** Minimal size of a shared memory heap segment */
+    size_t                                 shm_heap_seg_size;
     /** Estimation of bcopy bandwidth */
     double                                 bcopy_bw;
     /** Segment size in the worker pre-registered memory pool */
@@ -83,6 +90,10 @@ typedef struct ucp_context_config {
     size_t                                 rndv_pipeline_send_thresh;
     /** Enabling 2-stage pipeline rndv protocol */
     int                                    rndv_shm_ppln_enable;
+    /** Size of the first fragment of RNDV pipeline protocol */
+    size_t                                 rndv_ppln_init_frag_size;
+    /** Maximal size of RNDV pipeline fragments in progress on a worker */
+    size_t                                 rndv_ppln_max_inflight;
     /** Threshold for using tag matching offload capabilities. Smaller buffers
      *  will not be posted to the transport. */
     size_t                                 tm_thresh;
@@ -93,6 +104,9 @@ typedef struct ucp_context_config {
     size_t                                 tm_max_bb_size;
     /** Enabling SW rndv protocol with tag offload mode */
     ucs_ternary_auto_value_t               tm_sw_rndv;
+    /** Match tag messages sent to the local worker directly against the
+     *  receive requests, without going through a transport */
+    int                                    tag_self_bypass;
     /** Pack debug information in worker address */
     int                                    address_debug_info;
     /** Maximal size of worker address name for debugging */
@@ -131,8 +145,12 @@ typedef struct ucp_context_config {
     int                                    proto_enable;
     /** Force request reset after wireup */
     int                                    proto_request_reset;
+    /** Connect lanes which are not used for AM and wireup on first use */
+    int                                    on_demand_lanes;
     /** Time period between keepalive rounds */
     ucs_time_t                             keepalive_interval;
+    /** Maximal time to busy-poll in ucp_worker_wait before blocking */
+    ucs_time_t                             wait_spin_time;
     /** Maximal number of endpoints to check on every keepalive round
      * (0 - disabled, inf - check all endpoints on every round) */
     unsigned                               keepalive_num_eps;
@@ -152,6 +170,8 @@ typedef struct ucp_context_config {
     /** Remote keys with that many remote MDs or less would be allocated from a
       * memory pool.*/
     int                                    rkey_mpool_max_md;
+    /** Maximal number of unpacked remote keys cached by a worker */
+    unsigned                               rkey_cache_size;
     /** Worker address format version */
     ucp_object_version_t                   worker_addr_version;
     /** Threshold for enabling RNDV data split alignment */
@@ -323,6 +343,9 @@ typedef struct ucp_context {
     /* Hash of rcaches which contain imported memory handles got from peers */
     ucp_context_imported_mem_hash_t *imported_mem_hash;
 
+    /* Shared memory heap for buffers allocated by ucp_mem_map() */
+    ucs_mpool_set_t               shm_heap;
+
     struct {
 
         /* Bitmap of features supported by the context */
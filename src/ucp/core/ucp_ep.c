@@ -177,9 +177,53 @@ void ucp_ep_config_key_reset(ucp_ep_config_key_t *key)
     memset(key->amo_lanes,    UCP_NULL_LANE, sizeof(key->amo_lanes));
 }
 
+ucp_ep_ext_cold_t *ucp_ep_ext_cold_alloc(ucp_ep_ext_t *ep_ext)
+{
+    ucp_worker_h worker = ep_ext->ep->worker;
+    ucp_ep_ext_cold_t *cold;
+
+    ucs_assert(ep_ext->cold == NULL);
+
+    cold = ucs_mpool_get(&worker->ep_cold_mp);
+    if (cold == NULL) {
+        ucs_error("ep %p: failed to allocate endpoint cold section",
+                  ep_ext->ep);
+        return NULL;
+    }
+
+    cold->ep_ext                 = ep_ext;
+    cold->peer_mem               = NULL;
+    cold->stream.ready_list.prev = NULL;
+    cold->stream.ready_list.next = NULL;
+    ucs_queue_head_init(&cold->stream.match_q);
+    ucs_list_head_init(&cold->am.started_ams);
+    ucs_queue_head_init(&cold->am.mid_rdesc_q);
+    ucs_list_head_init(&cold->rkey_cache);
+
+    ep_ext->cold = cold;
+    return cold;
+}
+
+static void ucp_ep_ext_cold_free(ucp_ep_ext_t *ep_ext)
+{
+    ucp_ep_ext_cold_t *cold = ep_ext->cold;
+
+    if (cold == NULL) {
+        return;
+    }
+
+    ucs_assert(cold->peer_mem == NULL);
+    ucs_assert(cold->stream.ready_list.next == NULL);
+    ucs_assert(ucs_list_is_empty(&cold->rkey_cache));
+
+    ucs_mpool_put(cold);
+    ep_ext->cold = NULL;
+}
+
 static void ucp_ep_deallocate(ucp_ep_h ep)
 {
     UCS_STATS_NODE_FREE(ep->stats);
+    ucp_ep_ext_cold_free(ep->ext);
     ucs_free(ep->ext->uct_eps);
     ucs_free(ep->ext);
     ucs_strided_alloc_put(&ep->worker->ep_alloc, ep);
@@ -224,7 +268,7 @@ static ucp_ep_h ucp_ep_allocate(ucp_worker_h worker, const char *peer_name)
 #if UCS_ENABLE_ASSERT
     ep->ext->ka_last_round                = 0;
 #endif
-    ep->ext->peer_mem                     = NULL;
+    ep->ext->cold                         = NULL;
     ep->ext->uct_eps                      = NULL;
 
     UCS_STATIC_ASSERT(sizeof(ep->ext->ep_match) >=
@@ -288,7 +332,8 @@ ucp_ep_peer_mem_get(ucp_context_h context, ucp_ep_h ep, uint64_t address,
                     ucs_memory_type_t local_mem_type,
                     ucp_md_index_t rkey_ptr_md_index)
 {
-    khash_t(ucp_ep_peer_mem_hash) *peer_mem = ep->ext->peer_mem;
+    ucp_ep_ext_cold_t *cold;
+    khash_t(ucp_ep_peer_mem_hash) *peer_mem;
     ucp_lane_index_t mem_type_rma_lane;
     ucp_ep_peer_mem_data_t *data;
     ucp_ep_h mem_type_ep;
@@ -300,13 +345,19 @@ ucp_ep_peer_mem_get(ucp_context_h context, ucp_ep_h ep, uint64_t address,
 
     ucs_assert(local_mem_type != UCS_MEMORY_TYPE_UNKNOWN);
 
+    cold = ucp_ep_ext_cold_get(ep->ext);
+    if (ucs_unlikely(cold == NULL)) {
+        return NULL;
+    }
+
+    peer_mem = cold->peer_mem;
     if (ucs_unlikely(peer_mem == NULL)) {
-        ep->ext->peer_mem = peer_mem = kh_init(ucp_ep_peer_mem_hash);
+        cold->peer_mem = peer_mem = kh_init(ucp_ep_peer_mem_hash);
     }
 
     iter = kh_put(ucp_ep_peer_mem_hash, peer_mem, address, &ret);
     ucs_assert_always(ret != UCS_KH_PUT_FAILED);
-    data = &kh_val(ep->ext->peer_mem, iter);
+    data = &kh_val(peer_mem, iter);
 
     if (ucs_likely(ret == UCS_KH_PUT_KEY_PRESENT)) {
         if (ucs_likely(size <= data->size)) {
@@ -367,9 +418,6 @@ ucs_status_t ucp_ep_create_base(ucp_worker_h worker, unsigned ep_init_flags,
         goto err;
     }
 
-    ucp_stream_ep_init(ep);
-    ucp_am_ep_init(ep);
-
     if (ucp_ep_shall_use_indirect_id(ep->worker->context, ep_init_flags)) {
         ucp_ep_update_flags(ep, UCP_EP_FLAG_INDIRECT_ID, 0);
     }
@@ -501,6 +549,7 @@ void ucp_ep_destroy_base(ucp_ep_h ep)
     }
 
     ucp_worker_keepalive_remove_ep(ep);
+    ucp_rkey_cache_remove_ep(ep);
     ucp_ep_release_id(ep);
     ucs_list_del(&ep->ext->ep_list);
 
@@ -508,12 +557,13 @@ void ucp_ep_destroy_base(ucp_ep_h ep)
     ucs_callbackq_remove_oneshot(&worker->uct->progress_q, ep,
                                  ucp_ep_remove_filter, ep);
     UCS_STATS_NODE_FREE(ep->stats);
-    if (ep->ext->peer_mem != NULL) {
-        kh_foreach_value(ep->ext->peer_mem, data, {
+    if ((ep->ext->cold != NULL) && (ep->ext->cold->peer_mem != NULL)) {
+        kh_foreach_value(ep->ext->cold->peer_mem, data, {
             ucp_ep_peer_mem_destroy(worker->context, &data);
         });
 
-        kh_destroy(ucp_ep_peer_mem_hash, ep->ext->peer_mem);
+        kh_destroy(ucp_ep_peer_mem_hash, ep->ext->cold->peer_mem);
+        ep->ext->cold->peer_mem = NULL;
     }
     ucp_ep_deallocate(ep);
 }
@@ -1176,15 +1226,14 @@ static void ucp_ep_params_check_err_handling(ucp_ep_h ep,
              "keepalive and indirect id", ep);
 }
 
-ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
-                           ucp_ep_h *ep_p)
+static ucs_status_t
+ucp_ep_create_common(ucp_worker_h worker, const ucp_ep_params_t *params,
+                     ucp_ep_h *ep_p)
 {
     ucp_ep_h ep    = NULL;
     unsigned flags = UCP_PARAM_VALUE(EP, params, flags, FLAGS, 0);
     ucs_status_t status;
 
-    UCS_ASYNC_BLOCK(&worker->async);
-
     if (flags & UCP_EP_PARAMS_FLAGS_CLIENT_SERVER) {
         status = ucp_ep_create_to_sock_addr(worker, params, &ep);
     } else if (params->field_mask & UCP_EP_PARAM_FIELD_CONN_REQUEST) {
@@ -1214,6 +1263,56 @@ ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
     }
     ++worker->counters.ep_creations;
 
+    return status;
+}
+
+ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
+                           ucp_ep_h *ep_p)
+{
+    ucs_status_t status;
+
+    UCS_ASYNC_BLOCK(&worker->async);
+    status = ucp_ep_create_common(worker, params, ep_p);
+    UCS_ASYNC_UNBLOCK(&worker->async);
+
+    return status;
+}
+
+ucs_status_t ucp_ep_create_batch(ucp_worker_h worker, unsigned count,
+                                 const ucp_ep_params_t *params,
+                                 ucp_ep_h *ep_p)
+{
+    ucs_status_t status;
+    unsigned i;
+
+    for (i = 0; i < count; ++i) {
+        if (!(params[i].field_mask & UCP_EP_PARAM_FIELD_REMOTE_ADDRESS) ||
+            (params[i].field_mask & UCP_EP_PARAM_FIELD_CONN_REQUEST) ||
+            (UCP_PARAM_VALUE(EP, &params[i], flags, FLAGS, 0) &
+             UCP_EP_PARAMS_FLAGS_CLIENT_SERVER)) {
+            ucs_error("worker %p: endpoint %u in a batch must be created "
+                      "from a remote worker address", worker, i);
+            return UCS_ERR_INVALID_PARAM;
+        }
+    }
+
+    /* Every endpoint is created as by ucp_ep_create(), the batch only allows
+     * all-or-nothing creation */
+    UCS_ASYNC_BLOCK(&worker->async);
+    for (i = 0; i < count; ++i) {
+        status = ucp_ep_create_common(worker, &params[i], &ep_p[i]);
+        if (status != UCS_OK) {
+            goto err_destroy_eps;
+        }
+    }
+    UCS_ASYNC_UNBLOCK(&worker->async);
+
+    return UCS_OK;
+
+err_destroy_eps:
+    while (i-- > 0) {
+        ucp_ep_disconnected(ep_p[i], 1);
+    }
     UCS_ASYNC_UNBLOCK(&worker->async);
     return status;
 }
@@ -2535,6 +2634,7 @@ ucs_status_t ucp_ep_config_init(ucp_worker_h worker, ucp_ep_config_t *config,
         config->bcopy_thresh = context->config.ext.bcopy_thresh;
     }
     config->tag.lane                    = UCP_NULL_LANE;
+    config->tag.self_bypass             = 0;
     config->tag.proto                   = &ucp_tag_eager_proto;
     config->tag.sync_proto              = &ucp_tag_eager_sync_proto;
     config->tag.rndv.rma_thresh.remote  = SIZE_MAX;
@@ -2813,6 +2913,14 @@ ucs_status_t ucp_ep_config_init(ucp_worker_h worker, ucp_ep_config_t *config,
                 config->tag.rndv.am_thresh  = config->rndv.am_thresh;
                 config->tag.rndv.rma_thresh = config->rndv.rma_thresh;
 
+                /* The "self" transport delivers messages while they are sent,
+                 * so bypassing it does not reorder them */
+                config->tag.self_bypass     =
+                        context->config.ext.tag_self_bypass &&
+                        (config->key.flags & UCP_EP_CONFIG_KEY_FLAG_SELF) &&
+                        !strcmp(context->tl_rscs[rsc_index].tl_rsc.tl_name,
+                                "self");
+
                 /* Max Eager short has to be set after Zcopy and RNDV thresholds */
                 ucp_ep_config_set_memtype_thresh(&config->tag.max_eager_short,
                                                  config->tag.eager.max_short,
@@ -98,7 +98,7 @@ enum {
     UCP_EP_FLAG_CONNECT_REQ_QUEUED     = UCS_BIT(2), /* Connection request was queued */
     UCP_EP_FLAG_FAILED                 = UCS_BIT(3), /* EP is in failed state */
     UCP_EP_FLAG_USED                   = UCS_BIT(4), /* EP is in use by the user */
-    UCP_EP_FLAG_STREAM_HAS_DATA        = UCS_BIT(5), /* EP has data in the ext.stream.match_q */
+    UCP_EP_FLAG_STREAM_HAS_DATA        = UCS_BIT(5), /* EP has data in the ext.cold.stream.match_q */
     UCP_EP_FLAG_ON_MATCH_CTX           = UCS_BIT(6), /* EP is on match queue */
     UCP_EP_FLAG_REMOTE_ID              = UCS_BIT(7), /* remote ID is valid */
     UCP_EP_FLAG_BLOCK_FLUSH            = UCS_BIT(8), /* Flush ops have to be blocking
@@ -424,6 +424,10 @@ struct ucp_ep_config {
         /* Lane used for tag matching operations. */
         ucp_lane_index_t     lane;
 
+        /* Whether messages are delivered to the local worker directly,
+         * bypassing the "self" transport. */
+        int                  self_bypass;
+
         /* Maximal size for eager short. */
         ucp_memtype_thresh_t max_eager_short;
 
@@ -487,6 +491,35 @@ typedef struct {
 } ucp_ep_flush_state_t;
 
 
+/**
+ * Endpoint cold section, which holds the state of features that many endpoints
+ * never use. It is allocated from a per-worker memory pool on first use, so
+ * the memory footprint of an endpoint is proportional to the features it uses.
+ */
+typedef struct ucp_ep_ext_cold {
+    struct ucp_ep_ext             *ep_ext;       /* Back pointer to endpoint
+                                                    extension */
+    khash_t(ucp_ep_peer_mem_hash) *peer_mem;     /* Hash of remote memory segments
+                                                    used by 2-stage ppln rndv proto */
+
+    struct {
+        ucs_list_link_t           ready_list;     /* List entry in worker's EP list */
+        ucs_queue_head_t          match_q;        /* Queue of receive data or requests,
+                                                     depends on UCP_EP_FLAG_STREAM_HAS_DATA */
+    } stream;
+
+    struct {
+        ucs_list_link_t           started_ams;
+        ucs_queue_head_t          mid_rdesc_q;    /* Queue of middle fragments, which
+                                                     arrived before the first one */
+    } am;
+
+    ucs_list_link_t               rkey_cache;    /* Remote keys unpacked on this
+                                                    endpoint, which are in the
+                                                    worker cache */
+} ucp_ep_ext_cold_t;
+
+
 /**
  * Endpoint extension
  */
@@ -499,8 +532,8 @@ typedef struct ucp_ep_ext {
     ucs_ptr_map_key_t             remote_ep_id;  /* Remote EP ID */
     ucp_err_handler_cb_t          err_cb;        /* Error handler */
     ucp_request_t                 *close_req;    /* Close protocol request */
-    khash_t(ucp_ep_peer_mem_hash) *peer_mem;     /* Hash of remote memory segments
-                                                    used by 2-stage ppln rndv proto */
+    ucp_ep_ext_cold_t             *cold;         /* Cold section, allocated
+                                                    on demand */
     /* List of requests which are waiting for remote completion */
     ucs_hlist_head_t              proto_reqs;
 #if UCS_ENABLE_ASSERT
@@ -516,21 +549,10 @@ typedef struct ucp_ep_ext {
         ucp_ep_flush_state_t      flush_state;   /* Remote completion status */
     };
 
-    struct {
-        ucs_list_link_t           ready_list;     /* List entry in worker's EP list */
-        ucs_queue_head_t          match_q;        /* Queue of receive data or requests,
-                                                     depends on UCP_EP_FLAG_STREAM_HAS_DATA */
-    } stream;
-
-    struct {
-        ucs_list_link_t           started_ams;
-        ucs_queue_head_t          mid_rdesc_q;    /* Queue of middle fragments, which
-                                                     arrived before the first one */
-    } am;
-
     /**
-     * UCT endpoints for every slow-path lane that has no room in the base endpoint
-     * structure. TODO allocate this array dynamically.
+     * UCT endpoints for every slow-path lane that has no room in the base
+     * endpoint structure. Allocated according to the number of lanes in the
+     * endpoint configuration.
      */
     uct_ep_h                     *uct_eps;
 } ucp_ep_ext_t;
@@ -641,6 +663,7 @@ typedef struct ucp_conn_request {
     uct_device_addr_t           *remote_dev_addr;
     struct sockaddr_storage     client_address;
     ucp_ep_h                    ep; /* valid only if request is handled internally */
+    ucs_queue_elem_t            queue; /* element in listener's pending queue */
     /* sa_data and packed worker address follow */
 } ucp_conn_request_t;
 
@@ -674,6 +697,8 @@ void ucp_ep_flush_state_reset(ucp_ep_h ep);
 
 void ucp_ep_flush_state_invalidate(ucp_ep_h ep);
 
+ucp_ep_ext_cold_t *ucp_ep_ext_cold_alloc(ucp_ep_ext_t *ep_ext);
+
 void ucp_ep_release_id(ucp_ep_h ep);
 
 ucs_status_t
@@ -54,6 +54,22 @@ static UCS_F_ALWAYS_INLINE void ucp_ep_set_lane(ucp_ep_h ep, size_t lane_index,
     }
 }
 
+/**
+ * Get the cold section of the endpoint, and allocate it if this is its first
+ * use.
+ *
+ * @return Pointer to the cold section, or NULL if the allocation failed.
+ */
+static UCS_F_ALWAYS_INLINE ucp_ep_ext_cold_t *
+ucp_ep_ext_cold_get(ucp_ep_ext_t *ep_ext)
+{
+    if (ucs_likely(ep_ext->cold != NULL)) {
+        return ep_ext->cold;
+    }
+
+    return ucp_ep_ext_cold_alloc(ep_ext);
+}
+
 static inline ucp_lane_index_t ucp_ep_get_am_lane(ucp_ep_h ep)
 {
     return ep->am_lane;
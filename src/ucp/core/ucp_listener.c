@@ -326,7 +326,9 @@ ucs_status_t ucp_listener_create(ucp_worker_h worker,
 
     UCS_ASYNC_BLOCK(&worker->async);
 
-    listener->worker = worker;
+    listener->worker      = worker;
+    listener->destroyed_p = NULL;
+    ucs_queue_head_init(&listener->conn_req_q);
 
     if (params->field_mask & UCP_LISTENER_PARAM_FIELD_ACCEPT_HANDLER) {
         UCP_CHECK_PARAM_NON_NULL(params->accept_handler.cb, status,
@@ -362,9 +364,7 @@ void ucp_listener_destroy(ucp_listener_h listener)
 
     UCS_ASYNC_BLOCK(&worker->async);
     ucs_vfs_obj_remove(listener);
-    ucs_callbackq_remove_oneshot(&worker->uct->progress_q, listener,
-                                 ucp_cm_server_conn_request_progress_cb_pred,
-                                 listener);
+    ucp_cm_server_conn_requests_purge(listener);
     UCS_ASYNC_UNBLOCK(&worker->async);
 
     if (listener->conn_reqs != 0) {
@@ -36,6 +36,11 @@ typedef struct ucp_listener {
                                                  remote endpoint */
     int                            conn_reqs; /* count unprocessed connection
                                                  requests */
+    ucs_queue_head_t               conn_req_q;/* connection requests waiting
+                                                 to be handled from progress */
+    int                            *destroyed_p; /* set when the listener is
+                                                    destroyed while handling
+                                                    connection requests */
     void                           *arg;      /* User's arg for the accept
                                                  callback */
 } ucp_listener_t;
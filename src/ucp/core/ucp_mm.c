@@ -13,6 +13,7 @@
 #include "ucp_worker.h"
 #include "ucp_mm.inl"
 
+#include <ucs/datastruct/mpool_set.inl>
 #include <ucs/debug/log.h>
 #include <ucs/debug/memtrack_int.h>
 #include <ucs/sys/math.h>
@@ -397,6 +398,19 @@ static void ucp_memh_put_rcache(ucp_context_h context, ucp_mem_h memh)
     UCP_THREAD_CS_EXIT(&context->mt_lock);
 }
 
+static void ucp_memh_shm_heap_put(ucp_context_h context, ucp_mem_h memh)
+{
+    ucp_mem_desc_t *desc = (ucp_mem_desc_t*)ucp_memh_address(memh) - 1;
+
+    ucs_assert(desc->memh == memh->parent);
+
+    UCP_THREAD_CS_ENTER(&context->mt_lock);
+    ucs_mpool_set_put_inline(desc);
+    UCP_THREAD_CS_EXIT(&context->mt_lock);
+
+    ucs_free(memh);
+}
+
 static void ucp_memh_cleanup(ucp_context_h context, ucp_mem_h memh)
 {
     ucp_md_map_t md_map = memh->md_map;
@@ -407,6 +421,12 @@ static void ucp_memh_cleanup(ucp_context_h context, ucp_mem_h memh)
 
     ucs_assert(ucp_memh_is_user_memh(memh));
 
+    if (memh->flags & UCP_MEMH_FLAG_SHM_HEAP) {
+        ucp_memh_dereg(context, memh, md_map & ~memh->parent->md_map);
+        ucp_memh_shm_heap_put(context, memh);
+        return;
+    }
+
     mem.address = ucp_memh_address(memh);
     mem.length  = ucp_memh_length(memh);
     mem.method  = memh->alloc_method;
@@ -845,6 +865,51 @@ out:
     return status;
 }
 
+static ucs_status_t
+ucp_memh_shm_heap_alloc(ucp_context_h context, size_t length,
+                        ucs_memory_type_t mem_type, ucp_mem_h *memh_p)
+{
+    ucp_mem_desc_t *desc;
+    ucs_status_t status;
+    ucp_mem_h memh;
+
+    if ((length > context->config.ext.shm_heap_max_alloc) ||
+        (mem_type != UCS_MEMORY_TYPE_HOST)) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    UCP_THREAD_CS_ENTER(&context->mt_lock);
+    desc = ucs_mpool_set_get_inline(&context->shm_heap, length);
+    UCP_THREAD_CS_EXIT(&context->mt_lock);
+    if (desc == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    status = ucp_memh_create(context, desc + 1, length, mem_type,
+                             UCT_ALLOC_METHOD_LAST, UCP_MEMH_FLAG_SHM_HEAP,
+                             &memh);
+    if (status != UCS_OK) {
+        goto err_put;
+    }
+
+    /* The buffer is covered by the memory handles of the heap segment, so a
+     * remote key packed for it also grants the peer access to the other
+     * buffers carved from the same segment */
+    memh->parent = desc->memh;
+    ucp_memh_init_from_parent(memh, desc->memh->md_map);
+
+    ucs_trace("memh %p: allocated address %p length %zu from shared heap "
+              "segment memh %p", memh, desc + 1, length, desc->memh);
+    *memh_p = memh;
+    return UCS_OK;
+
+err_put:
+    UCP_THREAD_CS_ENTER(&context->mt_lock);
+    ucs_mpool_set_put_inline(desc);
+    UCP_THREAD_CS_EXIT(&context->mt_lock);
+    return status;
+}
+
 static ucs_status_t
 ucp_memh_import(ucp_context_h context, const void *export_mkey_buffer,
                 ucp_mem_h *memh_p);
@@ -947,8 +1012,18 @@ ucs_status_t ucp_mem_map(ucp_context_h context, const ucp_mem_map_params_t *para
     if (memh_flags & UCP_MEMH_FLAG_IMPORTED) {
         status = ucp_memh_import(context, exported_memh_buffer, &memh);
     } else if (flags & UCP_MEM_MAP_ALLOCATE) {
-        status = ucp_memh_alloc(context, address, length, mem_type, uct_flags,
-                                alloc_name, &memh);
+        /* Carve the buffer from the shared memory heap, unless the user
+         * requested a specific address */
+        status = UCS_ERR_UNSUPPORTED;
+        if ((address == NULL) &&
+            (context->config.ext.shm_heap_max_alloc > 0)) {
+            status = ucp_memh_shm_heap_alloc(context, length, mem_type, &memh);
+        }
+
+        if (status != UCS_OK) {
+            status = ucp_memh_alloc(context, address, length, mem_type,
+                                    uct_flags, alloc_name, &memh);
+        }
     } else {
         status = ucp_memh_create(context, address, length, mem_type,
                                  UCT_ALLOC_METHOD_LAST, 0, &memh);
@@ -1152,13 +1227,14 @@ ucp_mem_advise(ucp_context_h context, ucp_mem_h memh,
 }
 
 static ucs_status_t
-ucp_mpool_malloc(ucp_worker_h worker, ucs_mpool_t *mp, size_t *size_p, void **chunk_p)
+ucp_mpool_malloc(ucp_context_h context, ucs_mpool_t *mp, size_t *size_p,
+                 void **chunk_p)
 {
     ucp_mem_desc_t *chunk_hdr;
     ucp_mem_h memh;
     ucs_status_t status;
 
-    status = ucp_memh_alloc(worker->context, NULL,
+    status = ucp_memh_alloc(context, NULL,
                             *size_p + sizeof(*chunk_hdr), UCS_MEMORY_TYPE_HOST,
                             UCT_MD_MEM_ACCESS_RMA, ucs_mpool_name(mp), &memh);
     if (status != UCS_OK) {
@@ -1174,12 +1250,12 @@ out:
 }
 
 static void
-ucp_mpool_free(ucp_worker_h worker, ucs_mpool_t *mp, void *chunk)
+ucp_mpool_free(ucp_context_h context, ucs_mpool_t *mp, void *chunk)
 {
     ucp_mem_desc_t *chunk_hdr;
 
     chunk_hdr = (ucp_mem_desc_t*)chunk - 1;
-    ucp_memh_cleanup(worker->context, chunk_hdr->memh);
+    ucp_memh_cleanup(context, chunk_hdr->memh);
 }
 
 void ucp_mpool_obj_init(ucs_mpool_t *mp, void *obj, void *chunk)
@@ -1195,7 +1271,7 @@ ucp_rndv_frag_malloc_mpools(ucs_mpool_t *mp, size_t *size_p, void **chunk_p)
     ucp_rndv_mpool_priv_t *mpriv = ucs_mpool_priv(mp);
     ucp_context_h context        = mpriv->worker->context;
     ucs_memory_type_t mem_type   = mpriv->mem_type;
-    size_t frag_size             = context->config.ext.rndv_frag_size[mem_type];
+    size_t frag_size             = mpriv->frag_size;
     ucp_rndv_frag_mp_chunk_hdr_t *chunk_hdr;
     ucs_status_t status;
     unsigned num_elems;
@@ -1238,12 +1314,9 @@ void ucp_frag_mpool_obj_init(ucs_mpool_t *mp, void *obj, void *chunk)
     ucp_rndv_frag_mp_chunk_hdr_t *chunk_hdr = (ucp_rndv_frag_mp_chunk_hdr_t*)chunk - 1;
     void *next_frag_ptr                     = chunk_hdr->next_frag_ptr;
     ucp_rndv_mpool_priv_t *mpriv            = ucs_mpool_priv(mp);
-    ucs_memory_type_t mem_type              = mpriv->mem_type;
-    ucp_context_h context                   = mpriv->worker->context;
+    size_t frag_size                        = mpriv->frag_size;
     ucp_mem_desc_t *elem_hdr                = obj;
-    size_t frag_size;
 
-    frag_size                = context->config.ext.rndv_frag_size[mem_type];
     elem_hdr->memh           = chunk_hdr->memh;
     elem_hdr->ptr            = next_frag_ptr;
     chunk_hdr->next_frag_ptr = UCS_PTR_BYTE_OFFSET(next_frag_ptr, frag_size);
@@ -1253,14 +1326,14 @@ ucs_status_t ucp_reg_mpool_malloc(ucs_mpool_t *mp, size_t *size_p, void **chunk_
 {
     ucp_worker_h worker = ucs_container_of(mp, ucp_worker_t, reg_mp);
 
-    return ucp_mpool_malloc(worker, mp, size_p, chunk_p);
+    return ucp_mpool_malloc(worker->context, mp, size_p, chunk_p);
 }
 
 void ucp_reg_mpool_free(ucs_mpool_t *mp, void *chunk)
 {
     ucp_worker_h worker = ucs_container_of(mp, ucp_worker_t, reg_mp);
 
-    ucp_mpool_free(worker, mp, chunk);
+    ucp_mpool_free(worker->context, mp, chunk);
 }
 
 ucs_status_t ucp_frag_mpool_malloc(ucs_mpool_t *mp, size_t *size_p, void **chunk_p)
@@ -1273,6 +1346,86 @@ void ucp_frag_mpool_free(ucs_mpool_t *mp, void *chunk)
     ucp_rndv_frag_free_mpools(mp, chunk);
 }
 
+static ucs_status_t
+ucp_shm_heap_mpool_malloc(ucs_mpool_t *mp, size_t *size_p, void **chunk_p)
+{
+    ucp_context_h context = *(ucp_context_h*)ucs_mpool_priv(mp);
+
+    /* Allocate large segments to reduce the number of segments peers have to
+     * attach */
+    *size_p = ucs_max(*size_p, context->config.ext.shm_heap_seg_size);
+    return ucp_mpool_malloc(context, mp, size_p, chunk_p);
+}
+
+static void ucp_shm_heap_mpool_free(ucs_mpool_t *mp, void *chunk)
+{
+    ucp_context_h context = *(ucp_context_h*)ucs_mpool_priv(mp);
+
+    ucp_mpool_free(context, mp, chunk);
+}
+
+static ucs_mpool_ops_t ucp_shm_heap_mpool_ops = {
+    .chunk_alloc   = ucp_shm_heap_mpool_malloc,
+    .chunk_release = ucp_shm_heap_mpool_free,
+    .obj_init      = ucp_mpool_obj_init,
+    .obj_cleanup   = ucs_empty_function,
+    .obj_str       = NULL
+};
+
+ucs_status_t ucp_mem_shm_heap_init(ucp_context_h context)
+{
+    size_t max_alloc = context->config.ext.shm_heap_max_alloc;
+    size_t sizes[UCS_MPOOL_SET_SIZE];
+    unsigned i, num_sizes, num_mpools;
+    ucs_mpool_t *mpools;
+    ucs_status_t status;
+    size_t size;
+
+    if (max_alloc == 0) {
+        return UCS_OK;
+    }
+
+    if (max_alloc > UCS_MPOOL_SET_MAX_SIZE) {
+        ucs_error("shared memory heap maximal allocation size %zu exceeds %lu",
+                  max_alloc, UCS_MPOOL_SET_MAX_SIZE);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    num_sizes = 0;
+    size      = UCS_SYS_CACHE_LINE_SIZE;
+    do {
+        sizes[num_sizes++] = size;
+        size             <<= 1;
+    } while (size <= max_alloc);
+
+    status = ucs_mpool_set_init(&context->shm_heap, sizes, num_sizes,
+                                max_alloc, sizeof(ucp_context_h),
+                                sizeof(ucp_mem_desc_t), sizeof(ucp_mem_desc_t),
+                                UCS_SYS_CACHE_LINE_SIZE, 16, UINT_MAX,
+                                &ucp_shm_heap_mpool_ops, "ucp_shm_heap");
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    /* Memory pools of the set are stored at the beginning of its data */
+    mpools     = context->shm_heap.data;
+    num_mpools = ucs_popcount(context->shm_heap.bitmap);
+    for (i = 0; i < num_mpools; ++i) {
+        *(ucp_context_h*)ucs_mpool_priv(&mpools[i]) = context;
+    }
+
+    return UCS_OK;
+}
+
+void ucp_mem_shm_heap_cleanup(ucp_context_h context)
+{
+    if (context->config.ext.shm_heap_max_alloc == 0) {
+        return;
+    }
+
+    ucs_mpool_set_cleanup(&context->shm_heap, 1);
+}
+
 void ucp_mem_print_info(const char *mem_spec, ucp_context_h context,
                         FILE *stream)
 {
@@ -29,7 +29,13 @@ enum {
     /*
      * Memory handle was imported and points to some peer's memory buffer.
      */
-    UCP_MEMH_FLAG_IMPORTED  = UCS_BIT(0)
+    UCP_MEMH_FLAG_IMPORTED  = UCS_BIT(0),
+
+    /*
+     * Memory handle points to a buffer carved from the shared memory heap,
+     * its parent is the memory handle of the heap segment.
+     */
+    UCP_MEMH_FLAG_SHM_HEAP  = UCS_BIT(1)
 };
 
 
@@ -93,6 +99,7 @@ typedef struct ucp_rndv_frag_mp_chunk_hdr {
 typedef struct ucp_rndv_mpool_priv {
     ucp_worker_h        worker;
     ucs_memory_type_t   mem_type;
+    size_t              frag_size;
 } ucp_rndv_mpool_priv_t;
 
 
@@ -176,6 +183,10 @@ ucs_status_t ucp_mem_rcache_init(ucp_context_h context,
 
 void ucp_mem_rcache_cleanup(ucp_context_h context);
 
+ucs_status_t ucp_mem_shm_heap_init(ucp_context_h context);
+
+void ucp_mem_shm_heap_cleanup(ucp_context_h context);
+
 /**
  * Get memory domain index that is used to allocate host memory type.
  *
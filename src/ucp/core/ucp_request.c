@@ -15,6 +15,7 @@
 
 #include <ucp/proto/proto_am.h>
 #include <ucp/proto/proto_debug.h>
+#include <ucp/rma/rma.h>
 #include <ucp/tag/tag_rndv.h>
 #include <uct/api/v2/uct_v2.h>
 #include <ucs/datastruct/mpool.inl>
@@ -28,6 +29,7 @@ static const char *ucp_request_flag_names[] = {
     [ucs_ilog2(UCP_REQUEST_FLAG_COMPLETED)]             = "cpml",
     [ucs_ilog2(UCP_REQUEST_FLAG_RELEASED)]              = "rls",
     [ucs_ilog2(UCP_REQUEST_FLAG_PROTO_SEND)]            = "proto",
+    [ucs_ilog2(UCP_REQUEST_FLAG_RECV_STREAM)]           = "rcv_strm",
     [ucs_ilog2(UCP_REQUEST_FLAG_SYNC_LOCAL_COMPLETED)]  = "loc_cmpl",
     [ucs_ilog2(UCP_REQUEST_FLAG_SYNC_REMOTE_COMPLETED)] = "rm_cmpl",
     [ucs_ilog2(UCP_REQUEST_FLAG_CALLBACK)]              = "cb",
@@ -677,6 +679,9 @@ void ucp_request_send_state_ff(ucp_request_t *req, ucs_status_t status)
     } else if (req->send.uct.func == ucp_wireup_msg_progress) {
         ucs_free(req->send.buffer);
         ucp_request_mem_free(req);
+    } else if (req->send.uct.func == ucp_amo_sw_progress_reply_batch) {
+        ucs_free(req->send.buffer);
+        ucp_request_put(req);
     } else if (req->send.state.uct_comp.func == ucp_ep_flush_completion) {
         ucp_ep_flush_request_ff(req, status);
     } else if (req->send.uct.func == ucp_worker_discard_uct_ep_pending_cb) {
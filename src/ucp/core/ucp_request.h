@@ -37,6 +37,7 @@ enum {
     UCP_REQUEST_FLAG_COMPLETED             = UCS_BIT(0),
     UCP_REQUEST_FLAG_RELEASED              = UCS_BIT(1),
     UCP_REQUEST_FLAG_PROTO_SEND            = UCS_BIT(2),
+    UCP_REQUEST_FLAG_RECV_STREAM           = UCS_BIT(3),
     UCP_REQUEST_FLAG_SYNC_LOCAL_COMPLETED  = UCS_BIT(4),
     UCP_REQUEST_FLAG_SYNC_REMOTE_COMPLETED = UCS_BIT(5),
     UCP_REQUEST_FLAG_CALLBACK              = UCS_BIT(6),
@@ -53,6 +54,7 @@ enum {
     UCP_REQUEST_FLAG_RECV_TAG              = UCS_BIT(17),
     UCP_REQUEST_FLAG_RKEY_INUSE            = UCS_BIT(18),
     UCP_REQUEST_FLAG_USER_HEADER_COPIED    = UCS_BIT(19),
+    UCP_REQUEST_FLAG_MULTI_INFLIGHT        = UCS_BIT(23),
 #if UCS_ENABLE_ASSERT
     UCP_REQUEST_FLAG_STREAM_RECV           = UCS_BIT(20),
     UCP_REQUEST_DEBUG_FLAG_EXTERNAL        = UCS_BIT(21),
@@ -89,7 +91,7 @@ enum {
     UCP_RECV_DESC_FLAG_EAGER_LAST       = UCS_BIT(5), /* Last fragment of eager tag message.
                                                          Used by tag offload protocol. */
     UCP_RECV_DESC_FLAG_RNDV             = UCS_BIT(6), /* Rendezvous request */
-    UCP_RECV_DESC_FLAG_RECV_STARTED     = UCS_BIT(7), /* Used in two different flows:
+    UCP_RECV_DESC_FLAG_RECV_STARTED     = UCS_BIT(7), /* Used in three different flows:
                                                          1) AM: receive operation on this
                                                             descriptor was initiated by
                                                             ucp_am_recv_data_nbx
@@ -97,7 +99,9 @@ enum {
                                                             eager message is being received, but
                                                             not all fragments received yet. Once
                                                             all fragments arrive, this flag is cleared.
-                                                            Note: it is set for the first fragment only. */
+                                                            Note: it is set for the first fragment only.
+                                                         3) STREAM: the descriptor data is being
+                                                            fetched by rendezvous protocol. */
     UCP_RECV_DESC_FLAG_MALLOC           = UCS_BIT(8), /* Descriptor was allocated with malloc
                                                          and must be freed, not returned to the
                                                          memory pool or UCT */
@@ -105,8 +109,15 @@ enum {
                                                          because UCT AM callback is still in
                                                          the call stack and descriptor is not
                                                          initialized yet. */
-    UCP_RECV_DESC_FLAG_RELEASED         = UCS_BIT(10) /* Indicates that the descriptor was
-                                                         released and cannot be used. */
+    UCP_RECV_DESC_FLAG_RELEASED         = UCS_BIT(10), /* Indicates that the descriptor was
+                                                          released and cannot be used. */
+    UCP_RECV_DESC_FLAG_AM_MULTI_FRAG    = UCS_BIT(11), /* First fragment of multi-fragment AM,
+                                                         which is received directly to the
+                                                         user buffer, or the descriptor which
+                                                         tracks the remaining fragments. */
+    UCP_RECV_DESC_FLAG_SELF_REF         = UCS_BIT(12) /* Tag message sent to the local worker,
+                                                         the data is in the buffer of the send
+                                                         request. */
 };
 
 
@@ -250,6 +261,10 @@ struct ucp_request {
                         /* Pointer to packed RKEY, used only by rkey_ptr mtype
                          * protocol */
                         const void     *rkey_buffer;
+
+                        /* Time of last fragment completion, used by
+                         * rndv/ppln protocol */
+                        ucs_time_t     ppln_frag_time;
                     };
 
                     union {
@@ -292,7 +307,15 @@ struct ucp_request {
                                 /* Used by rndv/send/ppln and rndv/recv/ppln */
                                 struct {
                                     /* Size to send in ack message */
-                                    size_t ack_data_size;
+                                    size_t   ack_data_size;
+
+                                    /* Current fragment size, or 0 if it
+                                     * has reached the maximal size */
+                                    size_t   frag_size;
+
+                                    /* Bandwidth of the last completed
+                                     * fragment, in bytes per second */
+                                    float    frag_bw;
                                 } ppln;
 
                                 /* Used by rndv/rkey_ptr */
@@ -376,6 +399,9 @@ struct ucp_request {
                 ucp_lane_index_t  multi_lane_idx;  /* Index of the lane with multi-send */
                 ucp_lane_map_t    lanes_map_avail; /* Used lanes map */
             };
+            /* Fragments in flight per interface, valid if
+             * UCP_REQUEST_FLAG_MULTI_INFLIGHT is set */
+            struct ucp_proto_multi_inflight *multi_inflight;
             uint8_t               mem_type;        /* Memory type, values are
                                                     * ucs_memory_type_t */
             ucp_lane_index_t      pending_lane;    /* Lane on which request was moved
@@ -439,11 +465,17 @@ struct ucp_request {
                     ucp_stream_recv_nbx_callback_t cb;     /* Completion callback */
                     size_t                         elem_size;
                     size_t                         length; /* Completion info to fill */
+                    ucp_recv_desc_t                *rdesc; /* Descriptor fetched by
+                                                              rendezvous, or NULL if
+                                                              receiving to the user
+                                                              buffer */
                 } stream;
 
                  struct {
                     ucp_am_recv_data_nbx_callback_t cb;    /* Completion callback */
-                    ucp_recv_desc_t                 *desc; /* Receive desc */
+                    ucp_recv_desc_t                 *desc; /* Receive desc, or NULL
+                                                              if it was already
+                                                              released */
                 } am;
             };
         } recv;
@@ -39,7 +39,7 @@ UCS_PTR_MAP_IMPL(request, 0);
     (((_flags) & UCP_REQUEST_FLAG_SYNC)            ? 's' : '-')
 
 #define UCP_RECV_DESC_FMT \
-    "rdesc %p %c%c%c%c%c%c len %u+%u"
+    "rdesc %p %c%c%c%c%c%c%c len %u+%u"
 
 #define UCP_RECV_DESC_ARG(_rdesc) \
     (_rdesc), \
@@ -49,6 +49,7 @@ UCS_PTR_MAP_IMPL(request, 0);
     (((_rdesc)->flags & UCP_RECV_DESC_FLAG_EAGER_SYNC)    ? 's' : '-'), \
     (((_rdesc)->flags & UCP_RECV_DESC_FLAG_EAGER_OFFLOAD) ? 'f' : '-'), \
     (((_rdesc)->flags & UCP_RECV_DESC_FLAG_RNDV)          ? 'r' : '-'), \
+    (((_rdesc)->flags & UCP_RECV_DESC_FLAG_SELF_REF)      ? 'l' : '-'), \
     (_rdesc)->payload_offset, \
     ((_rdesc)->length - (_rdesc)->payload_offset)
 
@@ -678,7 +679,9 @@ ucp_request_complete_am_recv(ucp_request_t *req, ucs_status_t status)
                   req->recv.dt_iter.length, ucs_status_string(status));
     UCS_PROFILE_REQUEST_EVENT(req, "complete_am_recv", status);
 
-    if (req->recv.am.desc->flags & UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS) {
+    if (req->recv.am.desc == NULL) {
+        /* Multi-fragment eager message, the descriptor is already released */
+    } else if (req->recv.am.desc->flags & UCP_RECV_DESC_FLAG_AM_CB_INPROGRESS) {
         /* Descriptor is not initialized by UCT yet, therefore can not call
          * ucp_recv_desc_release() for it. Clear the flag to let UCT AM
          * callback know that this descriptor is not needed anymore.
@@ -15,6 +15,7 @@
 #include <ucp/core/ucp_mm.inl>
 #include <ucp/rma/rma.h>
 #include <ucp/proto/proto_debug.h>
+#include <ucs/algorithm/crc.h>
 #include <ucs/datastruct/mpool.inl>
 #include <ucs/profile/profile.h>
 #include <ucs/type/float8.h>
@@ -791,16 +792,21 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_rkey_proto_resolve,
                                       &rkey->cfg_index);
 }
 
-UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
-                 (ep, buffer, length, unpack_md_map, skip_md_map, rkey_p),
-                 ucp_ep_h ep, const void *buffer, size_t length,
-                 ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
-                 ucp_rkey_h *rkey_p)
+/*
+ * Unpack a remote key. If cache_packed_size is nonzero, the remote key is
+ * allocated as part of a cache entry, followed by cache_packed_size bytes for
+ * a copy of the packed buffer.
+ */
+static ucs_status_t
+ucp_ep_rkey_unpack_common(ucp_ep_h ep, const void *buffer, size_t length,
+                          ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
+                          size_t cache_packed_size, ucp_rkey_h *rkey_p)
 {
     ucp_worker_h worker              = ep->worker;
     const ucp_ep_config_t *ep_config = ucp_ep_config(ep);
     const void *p                    = buffer;
     ucp_md_map_t md_map, remote_md_map, unreachable_md_map;
+    ucp_rkey_cache_entry_t *cache_entry;
     ucp_rsc_index_t cmpt_index;
     unsigned remote_md_index;
     const void *tl_rkey_buf;
@@ -830,7 +836,19 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
      * allocations are done from a memory pool.
      * We keep all of them to handle a future transport switch.
      */
-    if (md_count <= worker->context->config.ext.rkey_mpool_max_md) {
+    if (cache_packed_size != 0) {
+        cache_entry = ucs_malloc(sizeof(*cache_entry) +
+                                 (sizeof(rkey->tl_rkey[0]) * md_count) +
+                                 cache_packed_size,
+                                 "ucp_rkey_cache_entry");
+        if (cache_entry != NULL) {
+            cache_entry->packed = &cache_entry->rkey.tl_rkey[md_count];
+            rkey                = &cache_entry->rkey;
+        } else {
+            rkey                = NULL;
+        }
+        flags = UCP_RKEY_DESC_FLAG_CACHED;
+    } else if (md_count <= worker->context->config.ext.rkey_mpool_max_md) {
         rkey  = ucs_mpool_get_inline(&worker->rkey_mp);
         flags = UCP_RKEY_DESC_FLAG_POOL;
     } else {
@@ -922,19 +940,208 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
     goto out;
 
 err_destroy:
-    ucp_rkey_destroy(rkey);
+    ucp_rkey_release(rkey);
 out:
     ucs_log_indent(-1);
     return status;
 }
 
+UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
+                 (ep, buffer, length, unpack_md_map, skip_md_map, rkey_p),
+                 ucp_ep_h ep, const void *buffer, size_t length,
+                 ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
+                 ucp_rkey_h *rkey_p)
+{
+    return ucp_ep_rkey_unpack_common(ep, buffer, length, unpack_md_map,
+                                     skip_md_map, 0, rkey_p);
+}
+
+/* Size of the packed remote key, without the optional distance information */
+static size_t ucp_rkey_packed_md_size(const void *buffer)
+{
+    const void *p = buffer;
+    ucp_md_map_t md_map;
+    unsigned md_index;
+    uint8_t tl_rkey_size;
+
+    md_map = *ucs_serialize_next(&p, const ucp_md_map_t);
+    ucs_serialize_next(&p, const uint8_t); /* mem_type */
+    ucs_for_each_bit(md_index, md_map) {
+        tl_rkey_size = *ucs_serialize_next(&p, const uint8_t);
+        ucs_serialize_next_raw(&p, const void, tl_rkey_size);
+    }
+
+    return UCS_PTR_BYTE_DIFF(buffer, p);
+}
+
+static void ucp_rkey_cache_put(ucp_rkey_cache_entry_t *entry)
+{
+    ucs_assert(entry->refcount > 0);
+    if (--entry->refcount == 0) {
+        ucp_rkey_release(&entry->rkey);
+    }
+}
+
+static void
+ucp_rkey_cache_remove(ucp_worker_h worker, ucp_rkey_cache_entry_t *entry)
+{
+    khiter_t iter;
+
+    ucs_trace("ep %p: removing rkey %p from cache", entry->ep, &entry->rkey);
+
+    iter = kh_get(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash,
+                  entry->hash);
+    ucs_assert(iter != kh_end(&worker->rkey_cache_hash));
+    kh_del(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash, iter);
+    ucs_lru_remove(worker->rkey_cache_lru, entry);
+    ucs_list_del(&entry->ep_list);
+
+    entry->ep = NULL;
+    ucp_rkey_cache_put(entry);
+}
+
+/*
+ * Unpack a remote key through the worker cache. The cache holds one reference
+ * to every remote key in it, and every ucp_ep_rkey_unpack() call which returns
+ * the key holds another one, released by ucp_rkey_destroy().
+ */
+static ucs_status_t
+ucp_rkey_cache_unpack(ucp_ep_h ep, const void *buffer, ucp_rkey_h *rkey_p)
+{
+    ucp_worker_h worker = ep->worker;
+    size_t length       = ucp_rkey_packed_md_size(buffer);
+    ucp_rkey_cache_entry_t *entry;
+    ucp_ep_ext_cold_t *cold;
+    ucs_status_t status;
+    ucp_rkey_h rkey;
+    uint64_t hash;
+    khiter_t iter;
+    int ret;
+
+    hash = ((uint64_t)length << 32) |
+           ucs_crc32(ucs_crc32(0, &ep, sizeof(ep)), buffer, length);
+    iter = kh_get(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash, hash);
+    if (iter != kh_end(&worker->rkey_cache_hash)) {
+        entry = kh_val(&worker->rkey_cache_hash, iter);
+        if ((entry->ep != ep) || (entry->packed_size != length) ||
+            memcmp(entry->packed, buffer, length)) {
+            /* Hash collision, do not cache */
+            return ucp_ep_rkey_unpack_reachable(ep, buffer, 0, rkey_p);
+        }
+
+        if (entry->ep_cfg_index == ep->cfg_index) {
+            ucs_trace("ep %p: found rkey %p in cache", ep, &entry->rkey);
+            ++entry->refcount;
+            ucs_lru_push(worker->rkey_cache_lru, entry);
+            *rkey_p = &entry->rkey;
+            return UCS_OK;
+        }
+
+        /* Endpoint was reconfigured since the key was unpacked */
+        ucp_rkey_cache_remove(worker, entry);
+    }
+
+    status = ucp_ep_rkey_unpack_common(ep, buffer, 0,
+                                       ucp_ep_config(ep)->key.reachable_md_map,
+                                       0, length, &rkey);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    entry               = ucs_container_of(rkey, ucp_rkey_cache_entry_t, rkey);
+    entry->worker       = worker;
+    entry->ep           = ep;
+    entry->hash         = hash;
+    entry->refcount     = 2;
+    entry->ep_cfg_index = ep->cfg_index;
+    entry->packed_size  = length;
+    memcpy(entry->packed, buffer, length);
+
+    if (kh_size(&worker->rkey_cache_hash) >=
+        worker->rkey_cache_lru->capacity) {
+        ucp_rkey_cache_remove(worker, ucs_lru_tail(worker->rkey_cache_lru));
+    }
+
+    /* The endpoint keeps a list of its cached keys, to remove them when it
+     * is destroyed */
+    cold = ucp_ep_ext_cold_get(ep->ext);
+    if (cold == NULL) {
+        ret = UCS_KH_PUT_FAILED;
+    } else {
+        iter = kh_put(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash,
+                      hash, &ret);
+    }
+
+    if (ret == UCS_KH_PUT_FAILED) {
+        /* Return the key without caching it */
+        entry->ep       = NULL;
+        entry->refcount = 1;
+    } else {
+        kh_val(&worker->rkey_cache_hash, iter) = entry;
+        ucs_lru_push(worker->rkey_cache_lru, entry);
+        ucs_list_add_tail(&cold->rkey_cache, &entry->ep_list);
+    }
+
+    *rkey_p = rkey;
+    return UCS_OK;
+}
+
+ucs_status_t ucp_rkey_cache_init(ucp_worker_h worker)
+{
+    unsigned size = worker->context->config.ext.rkey_cache_size;
+
+    kh_init_inplace(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash);
+    if (size == 0) {
+        worker->rkey_cache_lru = NULL;
+        return UCS_OK;
+    }
+
+    return ucs_lru_create(size, &worker->rkey_cache_lru);
+}
+
+void ucp_rkey_cache_remove_ep(ucp_ep_h ep)
+{
+    ucp_rkey_cache_entry_t *entry, *tmp;
+
+    if (ep->ext->cold == NULL) {
+        return;
+    }
+
+    ucs_list_for_each_safe(entry, tmp, &ep->ext->cold->rkey_cache, ep_list) {
+        ucs_assert(entry->ep == ep);
+        ucp_rkey_cache_remove(ep->worker, entry);
+    }
+}
+
+void ucp_rkey_cache_cleanup(ucp_worker_h worker)
+{
+    ucp_rkey_cache_entry_t *entry;
+
+    if (worker->rkey_cache_lru != NULL) {
+        kh_foreach_value(&worker->rkey_cache_hash, entry, {
+            if (entry->refcount > 1) {
+                ucs_warn("worker %p: rkey %p was not destroyed", worker,
+                         &entry->rkey);
+            }
+            ucp_rkey_cache_remove(worker, entry);
+        });
+        ucs_lru_destroy(worker->rkey_cache_lru);
+    }
+
+    kh_destroy_inplace(ucp_worker_rkey_cache_hash, &worker->rkey_cache_hash);
+}
+
 ucs_status_t ucp_ep_rkey_unpack(ucp_ep_h ep, const void *rkey_buffer,
                                 ucp_rkey_h *rkey_p)
 {
     ucs_status_t status;
 
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(ep->worker);
-    status = ucp_ep_rkey_unpack_reachable(ep, rkey_buffer, 0, rkey_p);
+    if (ep->worker->rkey_cache_lru != NULL) {
+        status = ucp_rkey_cache_unpack(ep, rkey_buffer, rkey_p);
+    } else {
+        status = ucp_ep_rkey_unpack_reachable(ep, rkey_buffer, 0, rkey_p);
+    }
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(ep->worker);
 
     return status;
@@ -1003,7 +1210,7 @@ ucs_status_t ucp_rkey_ptr(ucp_rkey_h rkey, uint64_t raddr, void **addr_p)
     return UCS_ERR_UNREACHABLE;
 }
 
-void ucp_rkey_destroy(ucp_rkey_h rkey)
+void ucp_rkey_release(ucp_rkey_h rkey)
 {
     unsigned remote_md_index, rkey_index;
     ucp_worker_h UCS_V_UNUSED worker;
@@ -1023,11 +1230,30 @@ void ucp_rkey_destroy(ucp_rkey_h rkey)
         UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
         ucs_mpool_put_inline(rkey);
         UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+    } else if (rkey->flags & UCP_RKEY_DESC_FLAG_CACHED) {
+        ucs_free(ucs_container_of(rkey, ucp_rkey_cache_entry_t, rkey));
     } else {
         ucs_free(rkey);
     }
 }
 
+void ucp_rkey_destroy(ucp_rkey_h rkey)
+{
+    ucp_worker_h UCS_V_UNUSED worker;
+    ucp_rkey_cache_entry_t *entry;
+
+    if (!(rkey->flags & UCP_RKEY_DESC_FLAG_CACHED)) {
+        ucp_rkey_release(rkey);
+        return;
+    }
+
+    entry  = ucs_container_of(rkey, ucp_rkey_cache_entry_t, rkey);
+    worker = entry->worker;
+    UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+    ucp_rkey_cache_put(entry);
+    UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+}
+
 ucp_lane_index_t ucp_rkey_find_rma_lane(ucp_context_h context,
                                         const ucp_ep_config_t *config,
                                         ucs_memory_type_t mem_type,
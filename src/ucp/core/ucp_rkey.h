@@ -38,8 +38,10 @@ typedef struct ucp_tl_rkey {
  * Rkey flags
  */
 enum {
-    UCP_RKEY_DESC_FLAG_POOL       = UCS_BIT(0)  /* Descriptor was allocated from pool
+    UCP_RKEY_DESC_FLAG_POOL       = UCS_BIT(0), /* Descriptor was allocated from pool
                                                    and must be returned to pool, not free */
+    UCP_RKEY_DESC_FLAG_CACHED     = UCS_BIT(1)  /* Descriptor is part of a worker rkey
+                                                   cache entry, and is reference counted */
 };
 
 
@@ -120,6 +122,27 @@ typedef struct ucp_rkey {
 } ucp_rkey_t;
 
 
+/**
+ * Worker cache entry of a remote key unpacked by @ref ucp_ep_rkey_unpack.
+ */
+struct ucp_rkey_cache_entry {
+    ucp_worker_h                      worker;       /* Worker which owns the cache */
+    ucp_ep_h                          ep;           /* Endpoint the key was unpacked on,
+                                                       NULL if not in the cache */
+    ucs_list_link_t                   ep_list;      /* Entry in the endpoint's list of
+                                                       cached keys */
+    uint64_t                          hash;         /* Hash of the endpoint and the
+                                                       packed key */
+    unsigned                          refcount;     /* Number of references, including
+                                                       the one held by the cache */
+    ucp_worker_cfg_index_t            ep_cfg_index; /* Endpoint configuration when the
+                                                       key was unpacked */
+    size_t                            packed_size;  /* Size of the packed key */
+    void                              *packed;      /* Copy of the packed key */
+    ucp_rkey_t                        rkey;         /* Unpacked key, must be last */
+};
+
+
 typedef struct ucp_unpacked_exported_tl_mkey {
     ucp_md_index_t md_index;     /* Index of MD which owns TL mkey */
     const void     *tl_mkey_buf; /* Packed TL mkey buffer */
@@ -222,6 +245,18 @@ ucp_ep_rkey_unpack_internal(ucp_ep_h ep, const void *buffer, size_t length,
                             ucp_md_map_t skip_md_map, ucp_rkey_h *rkey_p);
 
 
+void ucp_rkey_release(ucp_rkey_h rkey);
+
+
+ucs_status_t ucp_rkey_cache_init(ucp_worker_h worker);
+
+
+void ucp_rkey_cache_remove_ep(ucp_ep_h ep);
+
+
+void ucp_rkey_cache_cleanup(ucp_worker_h worker);
+
+
 void ucp_rkey_dump_packed(const void *buffer, size_t length,
                           ucs_string_buffer_t *strb);
 
@@ -67,12 +67,16 @@ typedef struct ucp_recv_desc          ucp_recv_desc_t;
 typedef struct ucp_address_iface_attr ucp_address_iface_attr_t;
 typedef struct ucp_address_entry      ucp_address_entry_t;
 typedef struct ucp_unpacked_address   ucp_unpacked_address_t;
+typedef struct ucp_address_dict       ucp_address_dict_t;
+typedef struct ucp_wireup_lane_cache_entry ucp_wireup_lane_cache_entry_t;
+typedef struct ucp_rkey_cache_entry   ucp_rkey_cache_entry_t;
 typedef struct ucp_wireup_ep          ucp_wireup_ep_t;
 typedef struct ucp_request_send_proto ucp_request_send_proto_t;
 typedef struct ucp_worker_iface       ucp_worker_iface_t;
 typedef struct ucp_worker_cm          ucp_worker_cm_t;
 typedef struct ucp_rma_proto          ucp_rma_proto_t;
 typedef struct ucp_amo_proto          ucp_amo_proto_t;
+typedef struct ucp_amo_sw_op          ucp_amo_sw_op_t;
 typedef struct ucp_ep_config          ucp_ep_config_t;
 typedef struct ucp_ep_config_key      ucp_ep_config_key_t;
 typedef struct ucp_rkey_config_key    ucp_rkey_config_key_t;
@@ -202,6 +206,8 @@ typedef enum {
                                           defined AM */
     UCP_AM_ID_AM_SINGLE_REPLY   =  26, /* Single fragment user defined AM
                                           carrying remote ep for reply */
+    UCP_AM_ID_ATOMIC_REP_BATCH  =  27, /* Batch of remote memory atomic
+                                          replies and completions */
     UCP_AM_ID_LAST
 } ucp_am_id_t;
 
@@ -123,6 +123,14 @@ static ucs_mpool_ops_t ucp_rkey_mpool_ops = {
     .obj_str       = NULL
 };
 
+static ucs_mpool_ops_t ucp_ep_cold_mpool_ops = {
+    .chunk_alloc   = ucs_mpool_chunk_malloc,
+    .chunk_release = ucs_mpool_chunk_free,
+    .obj_init      = NULL,
+    .obj_cleanup   = NULL,
+    .obj_str       = NULL
+};
+
 #define ucp_worker_discard_uct_ep_hash_key(_uct_ep) \
     kh_int64_hash_func((uintptr_t)(_uct_ep))
 
@@ -1327,6 +1335,8 @@ ucs_status_t ucp_worker_iface_open(ucp_worker_h worker, ucp_rsc_index_t tl_id,
     wiface->check_events_id  = UCS_CALLBACKQ_ID_NULL;
     wiface->proxy_recv_count = 0;
     wiface->post_count       = 0;
+    wiface->tx_ready_time    = 0;
+    wiface->tx_inflight      = 0;
     wiface->flags            = 0;
 
     /* Read interface or md configuration */
@@ -1975,6 +1985,17 @@ static ucs_status_t ucp_worker_init_mpools(ucp_worker_h worker)
         goto err_rkey_mp_cleanup;
     }
 
+    ucs_mpool_params_reset(&mp_params);
+    mp_params.elem_size       = sizeof(ucp_ep_ext_cold_t);
+    mp_params.elems_per_chunk = 128;
+    mp_params.ops             = &ucp_ep_cold_mpool_ops;
+    mp_params.name            = "ucp_ep_cold";
+    /* Create memory pool for endpoint sections which are allocated on demand */
+    status = ucs_mpool_init(&mp_params, &worker->ep_cold_mp);
+    if (status != UCS_OK) {
+        goto err_reg_mp_cleanup;
+    }
+
     if (max_mp_entry_size > 0) {
         /* Create memory pool for incoming UCT messages without a UCT descriptor */
         status = ucs_mpool_set_init(&worker->am_mps,
@@ -1985,13 +2006,15 @@ static ucs_status_t ucp_worker_init_mpools(ucp_worker_h worker)
                                     0, UCS_SYS_CACHE_LINE_SIZE, 128, UINT_MAX,
                                     &ucp_am_mpool_ops, "ucp_am_bufs");
         if (status != UCS_OK) {
-            goto err_reg_mp_cleanup;
+            goto err_ep_cold_mp_cleanup;
         }
         worker->flags |= UCP_WORKER_FLAG_AM_MPOOL_INITIALIZED;
     }
 
     return UCS_OK;
 
+err_ep_cold_mp_cleanup:
+    ucs_mpool_cleanup(&worker->ep_cold_mp, 0);
 err_reg_mp_cleanup:
     ucs_mpool_cleanup(&worker->reg_mp, 0);
 err_rkey_mp_cleanup:
@@ -2013,10 +2036,12 @@ static void ucp_worker_destroy_mpools(ucp_worker_h worker)
         if (!kh_exist(&worker->mpool_hash, iter)) {
             continue;
         }
-        ucs_mpool_cleanup(&kh_val(&worker->mpool_hash, iter), 1);
+        ucs_mpool_cleanup(kh_val(&worker->mpool_hash, iter), 1);
+        ucs_free(kh_val(&worker->mpool_hash, iter));
     }
 
     kh_destroy_inplace(ucp_worker_mpool_hash, &worker->mpool_hash);
+    ucs_mpool_cleanup(&worker->ep_cold_mp, 1);
     ucs_mpool_cleanup(&worker->reg_mp, 1);
     if (worker->flags & UCP_WORKER_FLAG_AM_MPOOL_INITIALIZED) {
         ucs_mpool_set_cleanup(&worker->am_mps, 1);
@@ -2365,6 +2390,12 @@ void ucp_worker_create_vfs(ucp_context_h context, ucp_worker_h worker)
     ucs_vfs_obj_add_ro_file(worker, ucp_worker_vfs_show_primitive,
                             &worker->counters.ep_failures, UCS_VFS_TYPE_ULONG,
                             "counters/ep_failures");
+    ucs_vfs_obj_add_ro_file(worker, ucp_worker_vfs_show_primitive,
+                            &worker->counters.wait_spin_hits,
+                            UCS_VFS_TYPE_ULONG, "counters/wait_spin_hits");
+    ucs_vfs_obj_add_ro_file(worker, ucp_worker_vfs_show_primitive,
+                            &worker->counters.wait_sleeps, UCS_VFS_TYPE_ULONG,
+                            "counters/wait_sleeps");
 }
 
 static void ucp_worker_set_max_am_header(ucp_worker_h worker)
@@ -2436,19 +2467,27 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
     worker->num_ifaces           = 0;
     worker->am_message_id        = ucs_generate_uuid(0);
     worker->rkey_ptr_cb_id       = UCS_CALLBACKQ_ID_NULL;
+    worker->amo_sw_cb_id         = UCS_CALLBACKQ_ID_NULL;
+    worker->rndv_ppln_inflight   = 0;
+    worker->rndv_ppln_req        = NULL;
     worker->num_all_eps          = 0;
     ucp_worker_keepalive_reset(worker);
     ucs_queue_head_init(&worker->rkey_ptr_reqs);
+    ucs_array_init_dynamic(&worker->amo_sw_ops);
     ucs_list_head_init(&worker->arm_ifaces);
     ucs_list_head_init(&worker->stream_ready_eps);
     ucs_list_head_init(&worker->all_eps);
     ucs_list_head_init(&worker->internal_eps);
     kh_init_inplace(ucp_worker_rkey_config, &worker->rkey_config_hash);
     kh_init_inplace(ucp_worker_discard_uct_ep_hash, &worker->discard_uct_ep_hash);
+    kh_init_inplace(ucp_worker_addr_dict_hash, &worker->addr_dict_hash);
     worker->counters.ep_creations         = 0;
     worker->counters.ep_creation_failures = 0;
     worker->counters.ep_closures          = 0;
     worker->counters.ep_failures          = 0;
+    worker->counters.wait_spin_hits       = 0;
+    worker->counters.wait_sleeps          = 0;
+    worker->wait.avg_time                 = 0;
 
     /* Copy user flags, and mask-out unsupported flags for compatibility */
     worker->flags = UCP_PARAM_VALUE(WORKER, params, flags, FLAGS, 0) &
@@ -2588,10 +2627,22 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
         goto err_destroy_memtype_eps;
     }
 
+    /* Initialize the cache of unpacked remote keys */
+    status = ucp_rkey_cache_init(worker);
+    if (status != UCS_OK) {
+        goto err_destroy_mpools;
+    }
+
+    /* Initialize the cache of lane selection results */
+    status = ucp_wireup_lane_cache_init(worker);
+    if (status != UCS_OK) {
+        goto err_rkey_cache_cleanup;
+    }
+
     /* Initialize tag matching */
     status = ucp_tag_match_init(&worker->tm);
     if (status != UCS_OK) {
-        goto err_destroy_mpools;
+        goto err_lane_cache_cleanup;
     }
 
     /* Initialize UCP AMs */
@@ -2620,6 +2671,10 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
 
 err_tag_match_cleanup:
     ucp_tag_match_cleanup(&worker->tm);
+err_lane_cache_cleanup:
+    ucp_wireup_lane_cache_cleanup(worker);
+err_rkey_cache_cleanup:
+    ucp_rkey_cache_cleanup(worker);
 err_destroy_mpools:
     ucp_worker_destroy_mpools(worker);
 err_destroy_memtype_eps:
@@ -2648,6 +2703,7 @@ err_free:
     kh_destroy_inplace(ucp_worker_discard_uct_ep_hash,
                        &worker->discard_uct_ep_hash);
     kh_destroy_inplace(ucp_worker_rkey_config, &worker->rkey_config_hash);
+    kh_destroy_inplace(ucp_worker_addr_dict_hash, &worker->addr_dict_hash);
     ucp_worker_destroy_configs(worker);
     ucs_free(worker);
     return status;
@@ -2847,6 +2903,7 @@ void ucp_worker_destroy(ucp_worker_h worker)
 
     UCS_ASYNC_BLOCK(&worker->async);
     uct_worker_progress_unregister_safe(worker->uct, &worker->keepalive.cb_id);
+    uct_worker_progress_unregister_safe(worker->uct, &worker->amo_sw_cb_id);
     ucp_worker_discard_uct_ep_cleanup(worker);
     ucp_worker_destroy_eps(worker, &worker->all_eps, "all");
     ucp_worker_destroy_eps(worker, &worker->internal_eps, "internal");
@@ -2882,6 +2939,7 @@ void ucp_worker_destroy(ucp_worker_h worker)
 
     ucs_vfs_obj_remove(worker);
     ucp_tag_match_cleanup(&worker->tm);
+    ucp_rkey_cache_cleanup(worker);
     ucp_worker_destroy_mpools(worker);
     ucp_worker_close_cms(worker);
     ucp_worker_close_ifaces(worker);
@@ -2893,10 +2951,13 @@ void ucp_worker_destroy(ucp_worker_h worker)
     UCS_STATS_NODE_FREE(worker->stats);
     UCS_PTR_MAP_DESTROY(request, &worker->request_map);
     UCS_PTR_MAP_DESTROY(ep, &worker->ep_map);
+    ucs_array_cleanup_dynamic(&worker->amo_sw_ops);
     ucs_strided_alloc_cleanup(&worker->ep_alloc);
     kh_destroy_inplace(ucp_worker_discard_uct_ep_hash,
                        &worker->discard_uct_ep_hash);
     kh_destroy_inplace(ucp_worker_rkey_config, &worker->rkey_config_hash);
+    ucp_address_dicts_cleanup(worker);
+    ucp_wireup_lane_cache_cleanup(worker);
     ucp_worker_destroy_configs(worker);
     ucs_free(worker);
 }
@@ -2928,6 +2989,12 @@ static ucs_status_t ucp_worker_address_pack(ucp_worker_h worker,
         UCS_BITMAP_SET_ALL(tl_bitmap);
     }
 
+    if (address_flags & UCP_WORKER_ADDRESS_FLAG_COMPACT) {
+        flags |= UCP_ADDRESS_PACK_FLAG_COMPACT;
+    } else if (address_flags & UCP_WORKER_ADDRESS_FLAG_DICT) {
+        flags |= UCP_ADDRESS_PACK_FLAG_DICT;
+    }
+
     return ucp_address_pack(worker, NULL, &tl_bitmap, flags,
                             context->config.ext.worker_addr_version, NULL,
                             UINT_MAX, address_length_p, (void**)address_p);
@@ -3134,8 +3201,64 @@ void ucp_worker_wait_mem(ucp_worker_h worker, void *address)
     ucs_arch_wait_mem(address);
 }
 
+/*
+ * Spin about twice the average recent waiting time, so most events which
+ * arrive at the recent rate are caught without blocking. Do not spin if events
+ * arrive less frequently than the configured spin time.
+ */
+static ucs_time_t ucp_worker_wait_spin_time(ucp_worker_h worker)
+{
+    ucs_time_t max_spin_time = worker->context->config.ext.wait_spin_time;
+    ucs_time_t avg_time      = worker->wait.avg_time;
+
+    if ((max_spin_time == 0) || (avg_time > max_spin_time)) {
+        return 0;
+    } else if (avg_time == 0) {
+        /* No history yet */
+        return max_spin_time;
+    }
+
+    return ucs_min(avg_time * 2, max_spin_time);
+}
+
+static void ucp_worker_wait_update(ucp_worker_h worker, ucs_time_t start_time)
+{
+    ucs_time_t wait_time = ucs_get_time() - start_time;
+
+    if (worker->context->config.ext.wait_spin_time == 0) {
+        return;
+    }
+
+    /* Exponential moving average with weight 1/4 for the new sample */
+    if (worker->wait.avg_time == 0) {
+        worker->wait.avg_time = ucs_max(wait_time, 1);
+    } else {
+        worker->wait.avg_time = ucs_max((3 * worker->wait.avg_time +
+                                         wait_time) / 4, 1);
+    }
+}
+
+/* Return nonzero if the worker had any events while spinning */
+static int ucp_worker_wait_spin(ucp_worker_h worker, ucs_time_t start_time)
+{
+    ucs_time_t spin_time = ucp_worker_wait_spin_time(worker);
+
+    if (spin_time == 0) {
+        return 0;
+    }
+
+    do {
+        if (ucp_worker_progress(worker) > 0) {
+            return 1;
+        }
+    } while ((ucs_get_time() - start_time) < spin_time);
+
+    return 0;
+}
+
 ucs_status_t ucp_worker_wait(ucp_worker_h worker)
 {
+    ucs_time_t start_time = ucs_get_time();
     ucp_worker_iface_t *wiface;
     struct pollfd *pfd;
     ucs_status_t status;
@@ -3147,10 +3270,19 @@ ucs_status_t ucp_worker_wait(ucp_worker_h worker)
     UCP_CONTEXT_CHECK_FEATURE_FLAGS(worker->context, UCP_FEATURE_WAKEUP,
                                     return UCS_ERR_INVALID_PARAM);
 
+    if (ucp_worker_wait_spin(worker, start_time)) {
+        UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+        ++worker->counters.wait_spin_hits;
+        ucp_worker_wait_update(worker, start_time);
+        UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+        return UCS_OK;
+    }
+
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
 
     status = ucp_worker_arm(worker);
     if (status == UCS_ERR_BUSY) { /* if UCS_ERR_BUSY returned - no poll() must called */
+        ucp_worker_wait_update(worker, start_time);
         status = UCS_OK;
         goto out_unlock;
     } else if (status != UCS_OK) {
@@ -3188,6 +3320,10 @@ ucs_status_t ucp_worker_wait(ucp_worker_h worker)
         ret = poll(pfd, nfds, -1);
         if (ret >= 0) {
             ucs_assertv(ret == 1, "ret=%d", ret);
+            UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+            ++worker->counters.wait_sleeps;
+            ucp_worker_wait_update(worker, start_time);
+            UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
             status = UCS_OK;
             goto out;
         } else {
@@ -20,6 +20,7 @@
 #include <ucs/datastruct/queue_types.h>
 #include <ucs/datastruct/strided_alloc.h>
 #include <ucs/datastruct/conn_match.h>
+#include <ucs/datastruct/lru.h>
 #include <ucs/datastruct/ptr_map.h>
 #include <ucs/arch/bitops.h>
 
@@ -214,15 +215,33 @@ KHASH_TYPE(ucp_worker_discard_uct_ep_hash, uct_ep_h, ucp_request_t*);
 typedef khash_t(ucp_worker_discard_uct_ep_hash) ucp_worker_discard_uct_ep_hash_t;
 
 
+/* Hash map of remote address dictionaries, by dictionary id */
+KHASH_TYPE(ucp_worker_addr_dict_hash, uint64_t, ucp_address_dict_t*);
+typedef khash_t(ucp_worker_addr_dict_hash) ucp_worker_addr_dict_hash_t;
+
+
+/* Hash map of cached lane selection results, by remote address shape */
+KHASH_TYPE(ucp_worker_lane_cache_hash, uint64_t,
+           ucp_wireup_lane_cache_entry_t*);
+typedef khash_t(ucp_worker_lane_cache_hash) ucp_worker_lane_cache_hash_t;
+
+
+/* Hash map of cached unpacked remote keys, by endpoint and packed key */
+KHASH_TYPE(ucp_worker_rkey_cache_hash, uint64_t, ucp_rkey_cache_entry_t*);
+typedef khash_t(ucp_worker_rkey_cache_hash) ucp_worker_rkey_cache_hash_t;
+
+
 typedef struct ucp_worker_mpool_key {
     ucs_memory_type_t mem_type;  /* memory type of the buffer pool */
     ucs_sys_device_t  sys_dev;   /* identifier for the device,
                                     UINT_MAX for default device */
+    size_t            frag_size; /* size of each buffer in the pool */
 } ucp_worker_mpool_key_t;
 
 
-/* Hash map to find mpool by mpool key */
-KHASH_TYPE(ucp_worker_mpool_hash, ucp_worker_mpool_key_t, ucs_mpool_t);
+/* Hash map to find mpool by mpool key. The memory pools are allocated
+ * separately, since they must not move when the hash is resized. */
+KHASH_TYPE(ucp_worker_mpool_hash, ucp_worker_mpool_key_t, ucs_mpool_t*);
 typedef khash_t(ucp_worker_mpool_hash) ucp_worker_mpool_hash_t;
 
 
@@ -248,6 +267,11 @@ struct ucp_worker_iface {
     unsigned                      proxy_recv_count;/* Counts active messages on proxy handler */
     unsigned                      post_count;    /* Counts uncompleted requests which are
                                                     offloaded to the transport */
+    ucs_time_t                    tx_ready_time; /* Estimated time when data queued by
+                                                    multi-lane protocols is sent */
+    size_t                        tx_inflight;   /* Bytes of multi-lane zero-copy
+                                                    fragments which are not
+                                                    completed yet */
     uint8_t                       flags;         /* Interface flags */
 };
 
@@ -297,6 +321,8 @@ typedef struct ucp_worker {
 
     void                             *user_data;          /* User-defined data */
     ucs_strided_alloc_t              ep_alloc;            /* Endpoint allocator */
+    ucs_mpool_t                      ep_cold_mp;          /* Pool of endpoint cold
+                                                           * sections */
     ucs_list_link_t                  stream_ready_eps;    /* List of EPs with received stream data */
     unsigned                         num_all_eps;         /* Number of all endpoints (except internal
                                                            * endpoints) */
@@ -316,6 +342,14 @@ typedef struct ucp_worker {
     ucs_queue_head_t                 rkey_ptr_reqs;       /* Queue of submitted RKEY PTR requests that
                                                            * are in-progress */
     uct_worker_cb_id_t               rkey_ptr_cb_id;      /* RKEY PTR worker callback queue ID */
+    ucs_array_s(unsigned, ucp_amo_sw_op_t) amo_sw_ops;    /* Software atomic requests
+                                                           * waiting for reply    */
+    uct_worker_cb_id_t               amo_sw_cb_id;        /* Software atomics worker
+                                                           * callback queue ID */
+    size_t                           rndv_ppln_inflight;  /* Total size of RNDV pipeline
+                                                           * fragments in progress */
+    ucp_request_t                    *rndv_ppln_req;      /* RNDV pipeline request which
+                                                           * is sending fragments now */
     ucp_tag_match_t                  tm;                  /* Tag-matching queues and offload info */
     ucp_am_info_t                    am;                  /* Array of AM callbacks and their data */
     uint64_t                         am_message_id;       /* For matching long AMs */
@@ -332,6 +366,18 @@ typedef struct ucp_worker {
 
     ucp_worker_rkey_config_hash_t    rkey_config_hash;    /* RKEY config key -> index */
     ucp_worker_discard_uct_ep_hash_t discard_uct_ep_hash; /* Hash of discarded UCT EPs */
+    ucp_worker_addr_dict_hash_t      addr_dict_hash;      /* Hash of remote address
+                                                           * dictionaries */
+    ucp_worker_lane_cache_hash_t     lane_cache_hash;     /* Hash of lane selection
+                                                           * results */
+    ucs_lru_h                        lane_cache_lru;      /* Usage order of cached
+                                                           * lane selection
+                                                           * results */
+    ucp_worker_rkey_cache_hash_t     rkey_cache_hash;     /* Hash of cached
+                                                           * remote keys */
+    ucs_lru_h                        rkey_cache_lru;      /* Usage order of cached
+                                                           * remote keys, NULL if
+                                                           * the cache is disabled */
     UCS_PTR_MAP_T(ep)                ep_map;              /* UCP ep key to ptr
                                                              mapping */
     UCS_PTR_MAP_T(request)           request_map;         /* UCP requests key to
@@ -363,7 +409,16 @@ typedef struct ucp_worker {
         uint64_t                     ep_closures;
         /* Number of failed endpoints */
         uint64_t                     ep_failures;
+        /* Number of ucp_worker_wait calls which found events while spinning */
+        uint64_t                     wait_spin_hits;
+        /* Number of ucp_worker_wait calls which blocked */
+        uint64_t                     wait_sleeps;
     } counters;
+
+    struct {
+        /* Moving average of the time ucp_worker_wait waited for events */
+        ucs_time_t                   avg_time;
+    } wait;
 } ucp_worker_t;
 
 
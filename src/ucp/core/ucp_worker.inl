@@ -21,6 +21,16 @@ KHASH_IMPL(ucp_worker_rkey_config, ucp_rkey_config_key_t,
            ucp_worker_cfg_index_t, 1, ucp_rkey_config_hash_func,
            ucp_rkey_config_is_equal);
 
+KHASH_IMPL(ucp_worker_addr_dict_hash, uint64_t, ucp_address_dict_t*, 1,
+           kh_int64_hash_func, kh_int64_hash_equal);
+
+KHASH_IMPL(ucp_worker_lane_cache_hash, uint64_t,
+           ucp_wireup_lane_cache_entry_t*, 1, kh_int64_hash_func,
+           kh_int64_hash_equal);
+
+KHASH_IMPL(ucp_worker_rkey_cache_hash, uint64_t, ucp_rkey_cache_entry_t*, 1,
+           kh_int64_hash_func, kh_int64_hash_equal);
+
 /**
  * Resolve remote key configuration key to a remote key configuration index.
  *
@@ -46,7 +56,8 @@ static UCS_F_ALWAYS_INLINE ucs_status_t ucp_worker_rkey_config_get(
 static UCS_F_ALWAYS_INLINE khint_t
 ucp_worker_mpool_hash_func(ucp_worker_mpool_key_t mpool_key)
 {
-    return (khint_t)mpool_key.mem_type ^ (mpool_key.sys_dev << 8);
+    return (khint_t)mpool_key.mem_type ^ (mpool_key.sys_dev << 8) ^
+           kh_int64_hash_func(mpool_key.frag_size);
 }
 
 static UCS_F_ALWAYS_INLINE int
@@ -54,10 +65,11 @@ ucp_worker_mpool_key_is_equal(ucp_worker_mpool_key_t mpool_key1,
                               ucp_worker_mpool_key_t mpool_key2)
 {
     return (mpool_key1.sys_dev == mpool_key2.sys_dev) &&
-           (mpool_key1.mem_type == mpool_key2.mem_type);
+           (mpool_key1.mem_type == mpool_key2.mem_type) &&
+           (mpool_key1.frag_size == mpool_key2.frag_size);
 }
 
-KHASH_IMPL(ucp_worker_mpool_hash, ucp_worker_mpool_key_t, ucs_mpool_t,
+KHASH_IMPL(ucp_worker_mpool_hash, ucp_worker_mpool_key_t, ucs_mpool_t*,
            1, ucp_worker_mpool_hash_func, ucp_worker_mpool_key_is_equal);
 
 
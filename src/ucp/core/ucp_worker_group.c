@@ -0,0 +1,363 @@
+/**
+* Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+*
+* See file LICENSE for terms.
+*/
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ucp_worker_group.h"
+#include "ucp_context.h"
+
+#include <ucs/debug/log.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/sys/sys.h>
+#include <ucs/type/serialize.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/* Longest time an idle progress thread sleeps, if it cannot wait for events */
+#define UCP_WORKER_GROUP_IDLE_SLEEP_MAX_USEC 1000
+
+
+static void *ucp_worker_group_progress_thread(void *arg)
+{
+    ucp_worker_group_member_t *member = arg;
+    ucp_worker_h worker               = member->worker;
+    int wakeup = worker->context->config.features & UCP_FEATURE_WAKEUP;
+    unsigned sleep_usec               = 0;
+    ucs_sys_cpuset_t cpuset;
+    ucs_status_t status;
+
+    CPU_ZERO(&cpuset);
+    CPU_SET(member->cpu, &cpuset);
+    if (ucs_sys_setaffinity(&cpuset) == -1) {
+        ucs_diag("worker %p: failed to bind progress thread to cpu %d: %m",
+                 member->worker, member->cpu);
+    }
+
+    while (!member->group->stop) {
+        if (ucp_worker_progress(worker) != 0) {
+            sleep_usec = 0;
+            continue;
+        }
+
+        if (wakeup) {
+            /* Block until there are events to progress, or the group is
+             * destroyed and signals the worker */
+            status = ucp_worker_arm(worker);
+            if (status == UCS_OK) {
+                ucp_worker_wait(worker);
+            } else if (status != UCS_ERR_BUSY) {
+                ucs_error("worker %p: failed to arm: %s", worker,
+                          ucs_status_string(status));
+                wakeup = 0;
+            }
+        } else {
+            /* Without events, back off exponentially while there is no
+             * communication to progress */
+            sleep_usec = ucs_min(ucs_max(sleep_usec * 2, 1),
+                                 UCP_WORKER_GROUP_IDLE_SLEEP_MAX_USEC);
+            usleep(sleep_usec);
+        }
+    }
+
+    return NULL;
+}
+
+static unsigned ucp_worker_group_get_cpus(int *cpus, unsigned max_cpus)
+{
+    unsigned num_cpus = 0;
+    ucs_sys_cpuset_t cpuset;
+    long cpu, max_cpu;
+
+    max_cpu = ucs_sys_get_num_cpus();
+    if ((max_cpu <= 0) || (ucs_sys_getaffinity(&cpuset) != 0)) {
+        cpus[0] = 0;
+        return 1;
+    }
+
+    for (cpu = 0; (cpu < max_cpu) && (num_cpus < max_cpus); ++cpu) {
+        if (CPU_ISSET(cpu, &cpuset)) {
+            cpus[num_cpus++] = cpu;
+        }
+    }
+
+    if (num_cpus == 0) {
+        cpus[num_cpus++] = 0;
+    }
+
+    return num_cpus;
+}
+
+static void ucp_worker_group_stop_threads(ucp_worker_group_h group,
+                                          unsigned num_threads)
+{
+    unsigned i;
+
+    group->stop = 1;
+    for (i = 0; i < num_threads; ++i) {
+        if (group->context->config.features & UCP_FEATURE_WAKEUP) {
+            /* Wake up the thread if it is waiting for events */
+            ucp_worker_signal(group->members[i].worker);
+        }
+        pthread_join(group->members[i].thread, NULL);
+    }
+}
+
+static void ucp_worker_group_destroy_workers(ucp_worker_group_h group,
+                                             unsigned num_workers)
+{
+    unsigned i;
+
+    for (i = 0; i < num_workers; ++i) {
+        ucp_worker_destroy(group->members[i].worker);
+    }
+}
+
+ucs_status_t ucp_worker_group_create(ucp_context_h context,
+                                     const ucp_worker_group_params_t *params,
+                                     ucp_worker_group_h *group_p)
+{
+    ucp_worker_params_t worker_params = {0};
+    ucp_worker_attr_t worker_attr;
+    ucp_worker_group_h group;
+    unsigned num_workers, num_cpus, num_threads, i;
+    ucs_status_t status;
+    int *cpus;
+
+    cpus = ucs_malloc(sizeof(*cpus) * UCS_CPU_SETSIZE, "worker_group_cpus");
+    if (cpus == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    num_cpus    = ucp_worker_group_get_cpus(cpus, UCS_CPU_SETSIZE);
+    num_workers = UCP_PARAM_VALUE(WORKER_GROUP, params, num_workers,
+                                  NUM_WORKERS, num_cpus);
+    if (num_workers == 0) {
+        ucs_error("worker group must have at least one worker");
+        status = UCS_ERR_INVALID_PARAM;
+        goto err_free_cpus;
+    }
+
+    group = ucs_calloc(1, sizeof(*group) +
+                       (num_workers * sizeof(*group->members)),
+                       "ucp_worker_group");
+    if (group == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_cpus;
+    }
+
+    group->context     = context;
+    group->uuid        = ucs_generate_uuid((uintptr_t)group);
+    group->flags       = UCP_PARAM_VALUE(WORKER_GROUP, params, flags, FLAGS,
+                                         0);
+    group->stop        = 0;
+    group->num_workers = num_workers;
+
+    if (params->field_mask & UCP_WORKER_GROUP_PARAM_FIELD_WORKER_PARAMS) {
+        worker_params = *params->worker_params;
+    }
+
+    if (group->flags & UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD) {
+        /* The application posts operations concurrently with the thread */
+        worker_params.field_mask |= UCP_WORKER_PARAM_FIELD_THREAD_MODE;
+        worker_params.thread_mode = UCS_THREAD_MODE_MULTI;
+    }
+
+    for (i = 0; i < num_workers; ++i) {
+        group->members[i].group = group;
+        group->members[i].cpu   = cpus[i % num_cpus];
+        status = ucp_worker_create(context, &worker_params,
+                                   &group->members[i].worker);
+        if (status != UCS_OK) {
+            goto err_destroy_workers;
+        }
+    }
+
+    if (group->flags & UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD) {
+        worker_attr.field_mask = UCP_WORKER_ATTR_FIELD_THREAD_MODE;
+        status = ucp_worker_query(group->members[0].worker, &worker_attr);
+        if (status != UCS_OK) {
+            goto err_destroy_workers;
+        }
+
+        if (worker_attr.thread_mode != UCS_THREAD_MODE_MULTI) {
+            ucs_error("worker group progress thread requires multi-thread "
+                      "support");
+            status = UCS_ERR_UNSUPPORTED;
+            goto err_destroy_workers;
+        }
+
+        for (num_threads = 0; num_threads < num_workers; ++num_threads) {
+            status = ucs_pthread_create(&group->members[num_threads].thread,
+                                        ucp_worker_group_progress_thread,
+                                        &group->members[num_threads],
+                                        "ucp_wgrp@%d",
+                                        group->members[num_threads].cpu);
+            if (status != UCS_OK) {
+                goto err_stop_threads;
+            }
+        }
+    }
+
+    ucs_debug("created worker group %p with %u workers on %u cpus", group,
+              num_workers, num_cpus);
+    ucs_free(cpus);
+    *group_p = group;
+    return UCS_OK;
+
+err_stop_threads:
+    ucp_worker_group_stop_threads(group, num_threads);
+err_destroy_workers:
+    /* All workers were created if the failure happened after the loop */
+    ucp_worker_group_destroy_workers(group, i);
+    ucs_free(group);
+err_free_cpus:
+    ucs_free(cpus);
+    return status;
+}
+
+void ucp_worker_group_destroy(ucp_worker_group_h group)
+{
+    ucs_debug("destroy worker group %p", group);
+
+    if (group->flags & UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD) {
+        ucp_worker_group_stop_threads(group, group->num_workers);
+    }
+
+    ucp_worker_group_destroy_workers(group, group->num_workers);
+    ucs_free(group);
+}
+
+unsigned ucp_worker_group_get_num_workers(ucp_worker_group_h group)
+{
+    return group->num_workers;
+}
+
+ucp_worker_h ucp_worker_group_get_worker(ucp_worker_group_h group,
+                                         unsigned index)
+{
+    ucs_assert(index < group->num_workers);
+    return group->members[index].worker;
+}
+
+ucs_status_t ucp_worker_group_get_address(ucp_worker_group_h group,
+                                          ucp_address_t **address_p,
+                                          size_t *address_length_p)
+{
+    ucp_worker_group_address_hdr_t *hdr;
+    ucp_worker_attr_t worker_attr;
+    ucs_status_t status;
+    size_t length;
+    void *buffer, *p;
+    unsigned i;
+
+    length = sizeof(*hdr);
+    buffer = ucs_malloc(length, "worker_group_address");
+    if (buffer == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    for (i = 0; i < group->num_workers; ++i) {
+        worker_attr.field_mask = UCP_WORKER_ATTR_FIELD_ADDRESS;
+        status = ucp_worker_query(group->members[i].worker, &worker_attr);
+        if (status != UCS_OK) {
+            goto err_free;
+        }
+
+        p = ucs_realloc(buffer,
+                        length + sizeof(uint32_t) + worker_attr.address_length,
+                        "worker_group_address");
+        if (p == NULL) {
+            ucp_worker_release_address(group->members[i].worker,
+                                       worker_attr.address);
+            status = UCS_ERR_NO_MEMORY;
+            goto err_free;
+        }
+
+        buffer = p;
+        p      = UCS_PTR_BYTE_OFFSET(buffer, length);
+        *ucs_serialize_next(&p, uint32_t) = worker_attr.address_length;
+        memcpy(p, worker_attr.address, worker_attr.address_length);
+        length += sizeof(uint32_t) + worker_attr.address_length;
+
+        ucp_worker_release_address(group->members[i].worker,
+                                   worker_attr.address);
+    }
+
+    hdr              = buffer;
+    hdr->uuid        = group->uuid;
+    hdr->num_workers = group->num_workers;
+
+    *address_p        = buffer;
+    *address_length_p = length;
+    return UCS_OK;
+
+err_free:
+    ucs_free(buffer);
+    return status;
+}
+
+void ucp_worker_group_release_address(ucp_worker_group_h group,
+                                      ucp_address_t *address)
+{
+    ucs_free(address);
+}
+
+unsigned ucp_worker_group_progress(ucp_worker_group_h group)
+{
+    unsigned count = 0;
+    unsigned i;
+
+    for (i = 0; i < group->num_workers; ++i) {
+        count += ucp_worker_progress(group->members[i].worker);
+    }
+
+    return count;
+}
+
+ucs_status_t ucp_worker_group_ep_create(ucp_worker_group_h group,
+                                        const ucp_ep_params_t *params,
+                                        ucp_ep_h *ep_p)
+{
+    const ucp_worker_group_address_hdr_t *hdr;
+    unsigned local_index, remote_index, i;
+    ucp_ep_params_t ep_params;
+    const void *p;
+    uint32_t length;
+
+    if (!(params->field_mask & UCP_EP_PARAM_FIELD_REMOTE_ADDRESS)) {
+        ucs_error("worker group endpoint requires a remote group address");
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    p   = params->address;
+    hdr = ucs_serialize_next(&p, const ucp_worker_group_address_hdr_t);
+    if (hdr->num_workers == 0) {
+        ucs_error("invalid worker group address %p", params->address);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    /* Each side selects its own member by the identity of the peer group, so
+     * the endpoints created by both groups connect the same pair of workers */
+    local_index  = hdr->uuid % group->num_workers;
+    remote_index = group->uuid % hdr->num_workers;
+
+    for (i = 0; i < remote_index; ++i) {
+        length = *ucs_serialize_next(&p, const uint32_t);
+        ucs_serialize_next_raw(&p, const void, length);
+    }
+    ucs_serialize_next(&p, const uint32_t);
+
+    ucs_trace("worker group %p: connecting member %u to remote member %u/%u",
+              group, local_index, remote_index, hdr->num_workers);
+
+    ep_params         = *params;
+    ep_params.address = p;
+    return ucp_ep_create(group->members[local_index].worker, &ep_params,
+                         ep_p);
+}
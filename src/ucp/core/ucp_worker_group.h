@@ -0,0 +1,50 @@
+/**
+* Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+*
+* See file LICENSE for terms.
+*/
+
+
+#ifndef UCP_WORKER_GROUP_H_
+#define UCP_WORKER_GROUP_H_
+
+#include "ucp_worker.h"
+
+#include <pthread.h>
+
+
+/**
+ * Member of a worker group
+ */
+typedef struct ucp_worker_group_member {
+    ucp_worker_group_h   group;      /* Group this member belongs to */
+    ucp_worker_h         worker;     /* Member worker */
+    int                  cpu;        /* CPU to bind the progress thread to */
+    pthread_t            thread;     /* Progress thread */
+} ucp_worker_group_member_t;
+
+
+/**
+ * UCP worker group
+ */
+typedef struct ucp_worker_group {
+    ucp_context_h             context;
+    uint64_t                  uuid;        /* Selects the members which
+                                              communicate with remote groups */
+    uint64_t                  flags;       /* Group creation flags */
+    volatile int              stop;        /* Progress threads should exit */
+    unsigned                  num_workers; /* Number of member workers */
+    ucp_worker_group_member_t members[0];  /* Member workers */
+} ucp_worker_group_t;
+
+
+/**
+ * Packed worker group address header, followed by the length and the address
+ * of every member worker
+ */
+typedef struct {
+    uint64_t                  uuid;
+    uint32_t                  num_workers;
+} UCS_S_PACKED ucp_worker_group_address_hdr_t;
+
+#endif
@@ -131,6 +131,9 @@ ucs_status_t ucp_proto_multi_init(const ucp_proto_multi_init_params_t *params,
     mpriv->reg_md_map   = reg_md_map | params->initial_reg_md_map;
     mpriv->lane_map     = lane_map;
     mpriv->num_lanes    = 0;
+    /* Single-lane protocols also account for their data, which is seen by
+     * multi-lane protocols of other endpoints using the same interface */
+    mpriv->dynamic      = context->config.ext.multi_lane_dynamic;
     mpriv->min_frag     = 0;
     mpriv->max_frag_sum = 0;
     mpriv->align_thresh = 1;
@@ -208,6 +211,7 @@ ucs_status_t ucp_proto_multi_init(const ucp_proto_multi_init_params_t *params,
         lpriv->weight_sum    = weight_sum;
         lpriv->max_frag_sum  = mpriv->max_frag_sum;
         lpriv->opt_align     = ucp_proto_multi_get_lane_opt_align(params, lane);
+        lpriv->bandwidth     = lane_perf->bandwidth;
         mpriv->align_thresh  = ucs_max(mpriv->align_thresh,
                                        lpriv->opt_align);
     }
@@ -280,6 +284,10 @@ void ucp_proto_multi_query_config(const ucp_proto_query_params_t *params,
                     (cfg_lane->path_index == cfg_lane0->path_index);
     }
 
+    if (mpriv->dynamic && (mpriv->num_lanes > 1)) {
+        ucs_string_buffer_appendf(&strb, "dynamic ");
+    }
+
     if (same_rsc) {
         ucp_proto_common_lane_priv_str(params, &mpriv->lanes[0].super, 1,
                                        same_path, &strb);
@@ -320,3 +328,126 @@ void ucp_proto_multi_query(const ucp_proto_query_params_t *params,
     ucp_proto_default_query(params, attr);
     ucp_proto_multi_query_config(params, attr);
 }
+
+static ucp_worker_iface_t *
+ucp_proto_multi_lane_wiface(ucp_request_t *req, ucp_lane_index_t lane)
+{
+    ucp_ep_h ep = req->send.ep;
+
+    return ucp_worker_iface(ep->worker, ucp_ep_get_rsc_index(ep, lane));
+}
+
+ucp_lane_index_t
+ucp_proto_multi_dynamic_lane_idx(ucp_request_t *req,
+                                 const ucp_proto_multi_priv_t *mpriv,
+                                 ucp_lane_map_t exclude_map)
+{
+    size_t remaining         = req->send.state.dt_iter.length -
+                               req->send.state.dt_iter.offset;
+    ucs_time_t now           = ucs_get_time();
+    ucs_time_t min_done_time = UCS_TIME_INFINITY;
+    ucp_lane_index_t best    = 0;
+    const ucp_proto_multi_lane_priv_t *lpriv;
+    ucp_worker_iface_t *wiface;
+    ucs_time_t done_time;
+    ucp_lane_index_t i;
+
+    /* The first fragment is always sent on the first lane, which may have
+       different capabilities than the rest */
+    if ((req->send.state.dt_iter.offset == 0) || (mpriv->num_lanes == 1)) {
+        return 0;
+    }
+
+    for (i = 0; i < mpriv->num_lanes; ++i) {
+        if (exclude_map & UCS_BIT(i)) {
+            continue;
+        }
+
+        lpriv     = &mpriv->lanes[i];
+        wiface    = ucp_proto_multi_lane_wiface(req, lpriv->super.lane);
+        done_time = ucs_max(now, wiface->tx_ready_time) +
+                    ucs_time_from_sec((wiface->tx_inflight +
+                                       ucs_min(remaining, lpriv->max_frag)) /
+                                      lpriv->bandwidth);
+        if (done_time < min_done_time) {
+            min_done_time = done_time;
+            best          = i;
+        }
+    }
+
+    return best;
+}
+
+void ucp_proto_multi_dynamic_lane_update(ucp_request_t *req,
+                                         const ucp_proto_multi_lane_priv_t *lpriv,
+                                         size_t length)
+{
+    ucp_worker_iface_t *wiface = ucp_proto_multi_lane_wiface(req,
+                                                             lpriv->super.lane);
+
+    wiface->tx_ready_time = ucs_max(ucs_get_time(), wiface->tx_ready_time) +
+                            ucs_time_from_sec(length / lpriv->bandwidth);
+}
+
+static void ucp_proto_multi_dynamic_inflight_completion(uct_completion_t *self)
+{
+    ucp_request_t *req = ucs_container_of(self, ucp_request_t,
+                                          send.state.uct_comp);
+    ucp_proto_multi_inflight_t *inflight = req->send.multi_inflight;
+    unsigned i;
+
+    for (i = 0; i < inflight->num_ifaces; ++i) {
+        ucs_assert(inflight->ifaces[i].wiface->tx_inflight >=
+                   inflight->ifaces[i].length);
+        inflight->ifaces[i].wiface->tx_inflight -= inflight->ifaces[i].length;
+    }
+
+    req->flags &= ~UCP_REQUEST_FLAG_MULTI_INFLIGHT;
+    self->func  = inflight->func;
+    ucs_free(inflight);
+    self->func(self);
+}
+
+void ucp_proto_multi_dynamic_inflight_add(ucp_request_t *req,
+                                          const ucp_proto_multi_lane_priv_t *lpriv,
+                                          size_t length)
+{
+    ucp_worker_iface_t *wiface = ucp_proto_multi_lane_wiface(req,
+                                                             lpriv->super.lane);
+    ucp_proto_multi_inflight_t *inflight;
+    unsigned i;
+
+    if (!(req->flags & UCP_REQUEST_FLAG_MULTI_INFLIGHT)) {
+        inflight = ucs_malloc(sizeof(*inflight), "ucp_proto_multi_inflight");
+        if (inflight == NULL) {
+            /* Fall back to estimating the time to send the fragment */
+            ucp_proto_multi_dynamic_lane_update(req, lpriv, length);
+            return;
+        }
+
+        /* Release the fragments when all of them are completed */
+        inflight->func                = req->send.state.uct_comp.func;
+        inflight->num_ifaces          = 0;
+        req->send.state.uct_comp.func =
+                ucp_proto_multi_dynamic_inflight_completion;
+        req->send.multi_inflight      = inflight;
+        req->flags                   |= UCP_REQUEST_FLAG_MULTI_INFLIGHT;
+    }
+
+    inflight = req->send.multi_inflight;
+    for (i = 0; i < inflight->num_ifaces; ++i) {
+        if (inflight->ifaces[i].wiface == wiface) {
+            break;
+        }
+    }
+
+    if (i == inflight->num_ifaces) {
+        ucs_assert(i < UCP_PROTO_MAX_LANES);
+        inflight->ifaces[i].wiface = wiface;
+        inflight->ifaces[i].length = 0;
+        ++inflight->num_ifaces;
+    }
+
+    inflight->ifaces[i].length += length;
+    wiface->tx_inflight        += length;
+}
@@ -51,9 +51,27 @@ typedef struct {
 
     /* Optimal alignment for zero-copy buffer address */
     size_t                       opt_align;
+
+    /* Lane bandwidth, used to estimate the time to send queued data */
+    double                       bandwidth;
 } ucp_proto_multi_lane_priv_t;
 
 
+/*
+ * Zero-copy fragments of a request which were posted by dynamic lane selection
+ * and are not completed yet
+ */
+typedef struct ucp_proto_multi_inflight {
+    uct_completion_callback_t   func;         /* Completion callback of the
+                                                 request */
+    unsigned                    num_ifaces;   /* Number of used interfaces */
+    struct {
+        ucp_worker_iface_t      *wiface;      /* Interface of the lane */
+        size_t                  length;       /* Bytes posted on it */
+    } ifaces[UCP_PROTO_MAX_LANES];
+} ucp_proto_multi_inflight_t;
+
+
 /*
  * Base class for protocols with fragmentation
  */
@@ -63,6 +81,9 @@ typedef struct {
     size_t                      max_frag_sum; /* 'max_frag' sum of all lanes */
     ucp_lane_map_t              lane_map;     /* Map of used lanes */
     ucp_lane_index_t            num_lanes;    /* Number of lanes to use */
+    uint8_t                     dynamic;      /* Whether to select the lane
+                                                 of each fragment according
+                                                 to its queued data */
     size_t                      align_thresh; /* Cached value of threshold for
                                                  enabling data split alignment */
     ucp_proto_multi_lane_priv_t lanes[0];     /* Array of lanes */
@@ -137,4 +158,37 @@ void ucp_proto_multi_query_config(const ucp_proto_query_params_t *params,
 void ucp_proto_multi_query(const ucp_proto_query_params_t *params,
                            ucp_proto_query_attr_t *attr);
 
+
+/**
+ * Select the lane which is expected to complete sending the next fragment
+ * first, according to the data already queued on each lane.
+ *
+ * @param [in] req          Request to send.
+ * @param [in] mpriv        Multi-lane protocol private data.
+ * @param [in] exclude_map  Map of lane indexes which should not be selected.
+ *
+ * @return Index of the selected lane in @a mpriv->lanes.
+ */
+ucp_lane_index_t
+ucp_proto_multi_dynamic_lane_idx(ucp_request_t *req,
+                                 const ucp_proto_multi_priv_t *mpriv,
+                                 ucp_lane_map_t exclude_map);
+
+
+/**
+ * Account for @a length bytes queued for sending on the lane of @a lpriv.
+ */
+void ucp_proto_multi_dynamic_lane_update(ucp_request_t *req,
+                                         const ucp_proto_multi_lane_priv_t *lpriv,
+                                         size_t length);
+
+
+/**
+ * Account for a zero-copy fragment of @a length bytes posted on the lane of
+ * @a lpriv, until the UCT completion of @a req is called.
+ */
+void ucp_proto_multi_dynamic_inflight_add(ucp_request_t *req,
+                                          const ucp_proto_multi_lane_priv_t *lpriv,
+                                          size_t length);
+
 #endif
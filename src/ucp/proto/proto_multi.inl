@@ -160,18 +160,27 @@ ucp_proto_multi_progress(ucp_request_t *req,
                          ucp_proto_complete_cb_t complete_func,
                          unsigned dt_mask)
 {
-    ucp_lane_index_t lane_shift = 1;
+    ucp_lane_map_t busy_map = 0;
     const ucp_proto_multi_lane_priv_t *lpriv;
+    ucp_lane_index_t lane_shift;
     ucp_datatype_iter_t next_iter;
     ucp_lane_index_t lane_idx;
     ucs_status_t status;
+    size_t length;
 
     ucs_assertv(req->send.multi_lane_idx < mpriv->num_lanes,
                 "lane_idx=%d num_lanes=%d", req->send.multi_lane_idx,
                 mpriv->num_lanes);
 
     lane_idx = req->send.multi_lane_idx;
-    lpriv    = &mpriv->lanes[lane_idx];
+
+retry:
+    if (ucs_unlikely(mpriv->dynamic)) {
+        lane_idx = ucp_proto_multi_dynamic_lane_idx(req, mpriv, busy_map);
+    }
+
+    lpriv      = &mpriv->lanes[lane_idx];
+    lane_shift = 1;
 
     /* send the next fragment */
     status = send_func(req, lpriv, &next_iter, &lane_shift);
@@ -181,10 +190,29 @@ ucp_proto_multi_progress(ucp_request_t *req,
         /* operation started and completion will be called later */
         ++req->send.state.uct_comp.count;
     } else {
+        if (ucs_unlikely(mpriv->dynamic) && (status == UCS_ERR_NO_RESOURCE) &&
+            (req->send.state.dt_iter.offset != 0)) {
+            /* the lane is busy, so try the next best lane */
+            ucp_proto_multi_dynamic_lane_update(req, lpriv, lpriv->max_frag);
+            busy_map |= UCS_BIT(lane_idx);
+            if (busy_map != UCS_MASK(mpriv->num_lanes)) {
+                goto retry;
+            }
+        }
+
         return ucp_proto_multi_handle_send_error(req, lpriv->super.lane,
                                                  status);
     }
 
+    if (ucs_unlikely(mpriv->dynamic)) {
+        length = next_iter.offset - req->send.state.dt_iter.offset;
+        if (status == UCS_INPROGRESS) {
+            ucp_proto_multi_dynamic_inflight_add(req, lpriv, length);
+        } else {
+            ucp_proto_multi_dynamic_lane_update(req, lpriv, length);
+        }
+    }
+
     /* advance position in send buffer */
     ucp_datatype_iter_copy_position(&req->send.state.dt_iter, &next_iter,
                                     dt_mask);
@@ -52,7 +52,11 @@ static size_t ucp_amo_sw_pack(void *dest, ucp_request_t *req, int fetch,
         }
     }
 
-    return length;
+    /* Capabilities of the origin follow the operands, and are ignored by
+     * targets which do not support them */
+    *(uint8_t*)UCS_PTR_BYTE_OFFSET(atomich, length) =
+            UCP_ATOMIC_REQ_CAP_REP_BATCH;
+    return length + sizeof(uint8_t);
 }
 
 static size_t ucp_amo_sw_post_pack_cb(void *dest, void *arg)
@@ -157,13 +161,41 @@ static ucs_status_t ucp_progress_atomic_reply(uct_pending_req_t *self)
     return UCS_OK;
 }
 
+static size_t ucp_amo_sw_pack_reply_batch(void *dest, void *arg)
+{
+    ucp_request_t *req = arg;
+
+    memcpy(dest, req->send.buffer, req->send.length);
+    return req->send.length;
+}
+
+ucs_status_t ucp_amo_sw_progress_reply_batch(uct_pending_req_t *self)
+{
+    ucp_request_t *req = ucs_container_of(self, ucp_request_t, send.uct);
+    ucp_ep_t *ep       = req->send.ep;
+    ssize_t packed_len;
+
+    req->send.lane = ucp_ep_get_am_lane(ep);
+    packed_len     = uct_ep_am_bcopy(ucp_ep_get_fast_lane(ep, req->send.lane),
+                                     UCP_AM_ID_ATOMIC_REP_BATCH,
+                                     ucp_amo_sw_pack_reply_batch, req, 0);
+    if (packed_len < 0) {
+        return (ucs_status_t)packed_len;
+    }
+
+    ucs_assert(packed_len == req->send.length);
+    ucs_free(req->send.buffer);
+    ucp_request_put(req);
+    return UCS_OK;
+}
+
 #define DEFINE_AMO_SW_OP(_bits) \
-    static void ucp_amo_sw_do_op##_bits(const ucp_atomic_req_hdr_t *atomicreqh) \
+    static void ucp_amo_sw_do_op##_bits(const ucp_amo_sw_op_t *op) \
     { \
-        uint##_bits##_t *ptr  = (void*)atomicreqh->address; \
-        uint##_bits##_t *args = (void*)(atomicreqh + 1); \
+        uint##_bits##_t *ptr        = (void*)op->hdr.address; \
+        const uint##_bits##_t *args = (const void*)op->args; \
         \
-       switch (atomicreqh->opcode) { \
+        switch (op->hdr.opcode) { \
         case UCT_ATOMIC_OP_ADD: \
             ucs_atomic_add##_bits(ptr, args[0]); \
             break; \
@@ -177,18 +209,18 @@ static ucs_status_t ucp_progress_atomic_reply(uct_pending_req_t *self)
             ucs_atomic_xor##_bits(ptr, args[0]); \
             break; \
         default: \
-            ucs_fatal("invalid opcode: %d", atomicreqh->opcode); \
+            ucs_fatal("invalid opcode: %d", op->hdr.opcode); \
         } \
     }
 
 #define DEFINE_AMO_SW_FOP(_bits) \
-    static void ucp_amo_sw_do_fop##_bits(const ucp_atomic_req_hdr_t *atomicreqh, \
-                                         ucp_atomic_reply_t *result) \
+    static void ucp_amo_sw_do_fop##_bits(ucp_amo_sw_op_t *op) \
     { \
-        uint##_bits##_t *ptr  = (void*)atomicreqh->address; \
-        uint##_bits##_t *args = (void*)(atomicreqh + 1); \
+        uint##_bits##_t *ptr        = (void*)op->hdr.address; \
+        const uint##_bits##_t *args = (const void*)op->args; \
+        ucp_atomic_reply_t *result  = &op->result; \
         \
-        switch (atomicreqh->opcode) { \
+        switch (op->hdr.opcode) { \
         case UCT_ATOMIC_OP_ADD: \
             result->reply##_bits = ucs_atomic_fadd##_bits(ptr, args[0]); \
             break; \
@@ -208,7 +240,7 @@ static ucs_status_t ucp_progress_atomic_reply(uct_pending_req_t *self)
             result->reply##_bits = ucs_atomic_cswap##_bits(ptr, args[0], args[1]); \
             break; \
         default: \
-            ucs_fatal("invalid opcode: %d", atomicreqh->opcode); \
+            ucs_fatal("invalid opcode: %d", op->hdr.opcode); \
         } \
     }
 
@@ -217,20 +249,207 @@ DEFINE_AMO_SW_OP(64)
 DEFINE_AMO_SW_FOP(32)
 DEFINE_AMO_SW_FOP(64)
 
+static UCS_F_ALWAYS_INLINE int ucp_amo_sw_op_is_fetch(const ucp_amo_sw_op_t *op)
+{
+    return op->hdr.req.req_id != UCS_PTR_MAP_KEY_INVALID;
+}
+
+/* Execute the given operation, and keep the fetched value in it */
+static void ucp_amo_sw_execute(ucp_amo_sw_op_t *op)
+{
+    if (ucp_amo_sw_op_is_fetch(op)) {
+        if (op->hdr.length == sizeof(uint32_t)) {
+            ucp_amo_sw_do_fop32(op);
+        } else {
+            ucp_amo_sw_do_fop64(op);
+        }
+    } else {
+        if (op->hdr.length == sizeof(uint32_t)) {
+            ucp_amo_sw_do_op32(op);
+        } else {
+            ucp_amo_sw_do_op64(op);
+        }
+    }
+}
+
+static void ucp_amo_sw_send_reply(ucp_ep_h ep, const ucp_amo_sw_op_t *op)
+{
+    ucp_request_t *req;
+
+    req = ucp_request_get(ep->worker);
+    if (req == NULL) {
+        ucs_error("failed to allocate atomic reply");
+        return;
+    }
+
+    ucp_request_send_state_init(req, ucp_dt_make_contig(1), op->hdr.length);
+
+    req->flags                           = 0;
+    req->send.ep                         = ep;
+    req->send.atomic_reply.remote_req_id = op->hdr.req.req_id;
+    req->send.atomic_reply.data          = op->result;
+    req->send.length                     = op->hdr.length;
+    req->send.uct.func                   = ucp_progress_atomic_reply;
+    ucp_request_send(req);
+}
+
+static void ucp_amo_sw_drop_replies(ucp_amo_sw_op_t *ops, unsigned num_ops,
+                                    uint64_t ep_id)
+{
+    unsigned i;
+
+    for (i = 0; i < num_ops; ++i) {
+        if (ops[i].hdr.req.ep_id == ep_id) {
+            ops[i].hdr.req.ep_id = UCS_PTR_MAP_KEY_INVALID;
+        }
+    }
+}
+
+/*
+ * Send the completions and the fetch results of the executed operations which
+ * came from the same origin as the first operation in the given array. They
+ * are packed to a single message, as long as the replies fit the bcopy size of
+ * the AM lane. The handled operations are marked by resetting their endpoint
+ * ID, the rest are left for the next call.
+ */
+static void ucp_amo_sw_send_replies(ucp_worker_h worker, ucp_amo_sw_op_t *ops,
+                                    unsigned num_ops)
+{
+    const size_t max_entry_size = sizeof(ucp_atomic_rep_entry_t) +
+                                  sizeof(uint64_t);
+    uint64_t ep_id              = ops[0].hdr.req.ep_id;
+    unsigned num_cmpl           = 0;
+    unsigned num_replies        = 0;
+    ucp_atomic_rep_batch_hdr_t *hdr;
+    ucp_atomic_rep_entry_t *entry;
+    unsigned i, max_replies;
+    ucp_amo_sw_op_t *op;
+    ucp_request_t *req;
+    ucp_ep_h ep;
+
+    /* allow getting closed EP to be used for sending a completion or AMO data
+     * to enable flush on a peer
+     */
+    UCP_WORKER_GET_EP_BY_ID(&ep, worker, ep_id,
+                            ucp_amo_sw_drop_replies(ops, num_ops, ep_id);
+                            return, "SW AMO request");
+
+    for (i = 1; (i < num_ops) && (ops[i].hdr.req.ep_id != ep_id); ++i);
+    if ((i == num_ops) || !(ops[0].caps & UCP_ATOMIC_REQ_CAP_REP_BATCH)) {
+        /* A single reply, or a reply to an origin which does not support
+         * batches, is sent in the same way as without batching */
+        if (ucp_amo_sw_op_is_fetch(&ops[0])) {
+            ucp_amo_sw_send_reply(ep, &ops[0]);
+        } else {
+            ucp_rma_sw_send_cmpl(ep);
+        }
+        ops[0].hdr.req.ep_id = UCS_PTR_MAP_KEY_INVALID;
+        return;
+    }
+
+    max_replies = (ucp_ep_config(ep)->am.max_bcopy - sizeof(*hdr)) /
+                  max_entry_size;
+    max_replies = ucs_min(max_replies, num_ops);
+    max_replies = ucs_min(max_replies, UINT16_MAX);
+    ucs_assert(max_replies > 0);
+
+    hdr = ucs_malloc(sizeof(*hdr) + (max_replies * max_entry_size),
+                     "ucp_amo_sw_reply_batch");
+    if (hdr == NULL) {
+        ucs_error("failed to allocate atomic reply batch");
+        ucp_amo_sw_drop_replies(ops, num_ops, ep_id);
+        return;
+    }
+
+    entry = (ucp_atomic_rep_entry_t*)(hdr + 1);
+    for (i = 0; i < num_ops; ++i) {
+        op = &ops[i];
+        if (op->hdr.req.ep_id != ep_id) {
+            continue;
+        }
+
+        if (!ucp_amo_sw_op_is_fetch(op)) {
+            ++num_cmpl;
+        } else if (num_replies < max_replies) {
+            entry->req_id = op->hdr.req.req_id;
+            entry->length = op->hdr.length;
+            memcpy(entry + 1, &op->result, op->hdr.length);
+            entry = UCS_PTR_BYTE_OFFSET(entry + 1, op->hdr.length);
+            ++num_replies;
+        } else {
+            continue;
+        }
+
+        op->hdr.req.ep_id = UCS_PTR_MAP_KEY_INVALID;
+    }
+
+    hdr->ep_id       = ucp_ep_remote_id(ep);
+    hdr->num_cmpl    = num_cmpl;
+    hdr->num_replies = num_replies;
+
+    req = ucp_request_get(worker);
+    if (req == NULL) {
+        ucs_error("failed to allocate atomic reply");
+        ucs_free(hdr);
+        return;
+    }
+
+    ucp_request_send_state_init(req, ucp_dt_make_contig(1),
+                                UCS_PTR_BYTE_DIFF(hdr, entry));
+
+    req->flags         = 0;
+    req->send.ep       = ep;
+    req->send.buffer   = hdr;
+    req->send.length   = UCS_PTR_BYTE_DIFF(hdr, entry);
+    req->send.uct.func = ucp_amo_sw_progress_reply_batch;
+    ucp_request_send(req);
+}
+
+/*
+ * Reply to every origin of the software atomic requests which were executed
+ * since the last call, with as few messages as possible.
+ */
+static unsigned ucp_amo_sw_progress_replies(void *arg)
+{
+    ucp_worker_h worker                      = arg;
+    ucs_typeof(worker->amo_sw_ops) ops_array = worker->amo_sw_ops;
+    ucp_amo_sw_op_t *ops                     = ucs_array_begin(&ops_array);
+    unsigned num_ops                         = ucs_array_length(&ops_array);
+    unsigned i;
+
+    /* Sending the replies may receive new requests, for example over a
+     * loopback transport, so they are queued to a new array */
+    ucs_array_init_dynamic(&worker->amo_sw_ops);
+
+    for (i = 0; i < num_ops; ++i) {
+        if (ops[i].hdr.req.ep_id != UCS_PTR_MAP_KEY_INVALID) {
+            ucp_amo_sw_send_replies(worker, &ops[i], num_ops - i);
+        }
+    }
+
+    if (!ucs_array_is_empty(&worker->amo_sw_ops)) {
+        /* Keep the callback registered for the new requests */
+        ucs_array_cleanup_dynamic(&ops_array);
+        return num_ops;
+    }
+
+    /* Reuse the buffer for the next requests */
+    ucs_array_cleanup_dynamic(&worker->amo_sw_ops);
+    ucs_array_set_length(&ops_array, 0);
+    worker->amo_sw_ops = ops_array;
+    uct_worker_progress_unregister_safe(worker->uct, &worker->amo_sw_cb_id);
+    return num_ops;
+}
+
 UCS_PROFILE_FUNC(ucs_status_t, ucp_atomic_req_handler, (arg, data, length, am_flags),
                  void *arg, void *data, size_t length, unsigned am_flags)
 {
     ucp_atomic_req_hdr_t *atomicreqh = data;
     ucp_worker_h worker              = arg;
     ucp_rsc_index_t amo_rsc_idx      = UCS_BITMAP_FFS(worker->atomic_tls);
-    ucp_request_t *req;
-    ucp_ep_h ep;
+    size_t args_length;
+    ucp_amo_sw_op_t *op;
 
-    /* allow getting closed EP to be used for sending a completion or AMO data to
-     * enable flush on a peer
-     */
-    UCP_WORKER_GET_EP_BY_ID(&ep, worker, atomicreqh->req.ep_id, return UCS_OK,
-                            "SW AMO request");
     if (ucs_unlikely((amo_rsc_idx != UCP_MAX_RESOURCES) &&
                      (ucp_worker_iface_get_attr(worker,
                                                 amo_rsc_idx)->cap.flags &
@@ -243,74 +462,92 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_atomic_req_handler, (arg, data, length, am_fl
          *       EP and continue SW AMO protocol */
     }
 
-    if (atomicreqh->req.req_id == UCS_PTR_MAP_KEY_INVALID) {
-        /* atomic operation without result */
-        switch (atomicreqh->length) {
-        case sizeof(uint32_t):
-            ucp_amo_sw_do_op32(atomicreqh);
-            break;
-        case sizeof(uint64_t):
-            ucp_amo_sw_do_op64(atomicreqh);
-            break;
-        default:
-            ucs_fatal("invalid atomic length: %u", atomicreqh->length);
-        }
-        ucp_rma_sw_send_cmpl(ep);
-    } else {
-        /* atomic operation with result */
-        req = ucp_request_get(worker);
-        if (req == NULL) {
-            ucs_error("failed to allocate atomic reply");
-            return UCS_OK;
-        }
-
-        switch (atomicreqh->length) {
-        case sizeof(uint32_t):
-            ucp_amo_sw_do_fop32(atomicreqh, &req->send.atomic_reply.data);
-            break;
-        case sizeof(uint64_t):
-            ucp_amo_sw_do_fop64(atomicreqh, &req->send.atomic_reply.data);
-            break;
-        default:
-            ucs_fatal("invalid atomic length: %u", atomicreqh->length);
-        }
-
-        ucp_request_send_state_init(req, ucp_dt_make_contig(1),
-                                    atomicreqh->length);
-
-        req->flags                           = 0;
-        req->send.ep                         = ep;
-        req->send.atomic_reply.remote_req_id = atomicreqh->req.req_id;
-        req->send.length                     = atomicreqh->length;
-        req->send.uct.func                   = ucp_progress_atomic_reply;
-        ucp_request_send(req);
+    if ((atomicreqh->length != sizeof(uint32_t)) &&
+        (atomicreqh->length != sizeof(uint64_t))) {
+        ucs_fatal("invalid atomic length: %u", atomicreqh->length);
     }
 
+    /* The request is executed right away, to keep the order with other
+     * remote memory operations, but the reply is sent from the progress
+     * callback together with the replies to all other requests received
+     * during the same worker progress */
+    op = ucs_array_append(&worker->amo_sw_ops,
+                          ucs_error("failed to queue atomic request");
+                          return UCS_OK);
+    args_length = atomicreqh->length *
+                  ((atomicreqh->opcode == UCT_ATOMIC_OP_CSWAP) ? 2 : 1);
+    ucs_assert(length >= (sizeof(*atomicreqh) + args_length));
+    op->hdr = *atomicreqh;
+    memcpy(op->args, atomicreqh + 1, args_length);
+    op->caps = (length > (sizeof(*atomicreqh) + args_length)) ?
+               *(uint8_t*)UCS_PTR_BYTE_OFFSET(atomicreqh + 1, args_length) : 0;
+    ucp_amo_sw_execute(op);
+
+    uct_worker_progress_register_safe(worker->uct, ucp_amo_sw_progress_replies,
+                                      worker, 0, &worker->amo_sw_cb_id);
     return UCS_OK;
 }
 
-UCS_PROFILE_FUNC(ucs_status_t, ucp_atomic_rep_handler, (arg, data, length, am_flags),
-                 void *arg, void *data, size_t length, unsigned am_flags)
+static UCS_F_ALWAYS_INLINE void
+ucp_amo_sw_reply_recv(ucp_worker_h worker, uint64_t req_id, const void *data,
+                      size_t length)
 {
-    ucp_worker_h worker    = arg;
-    ucp_rma_rep_hdr_t *hdr = data;
-    size_t frag_length     = length - sizeof(*hdr);
     ucp_request_t *req;
     ucp_ep_h ep;
 
-    UCP_SEND_REQUEST_GET_BY_ID(&req, worker, hdr->req_id, 1, return UCS_OK,
-                               "ATOMIC_REP %p", hdr);
+    UCP_SEND_REQUEST_GET_BY_ID(&req, worker, req_id, 1, return,
+                               "ATOMIC_REP %p", data);
 
     if (worker->context->config.ext.proto_enable) {
-        ucp_dt_contig_unpack(worker, req->send.amo.reply_buffer, hdr + 1,
-                             frag_length, ucp_amo_request_reply_mem_type(req));
+        ucp_dt_contig_unpack(worker, req->send.amo.reply_buffer, data, length,
+                             ucp_amo_request_reply_mem_type(req));
     } else {
-        memcpy(req->send.buffer, hdr + 1, frag_length);
+        memcpy(req->send.buffer, data, length);
     }
 
     ep = req->send.ep;
     ucp_request_complete_send(req, UCS_OK);
     ucp_ep_rma_remote_request_completed(ep);
+}
+
+UCS_PROFILE_FUNC(ucs_status_t, ucp_atomic_rep_handler, (arg, data, length, am_flags),
+                 void *arg, void *data, size_t length, unsigned am_flags)
+{
+    ucp_rma_rep_hdr_t *hdr = data;
+
+    ucp_amo_sw_reply_recv(arg, hdr->req_id, hdr + 1, length - sizeof(*hdr));
+    return UCS_OK;
+}
+
+UCS_PROFILE_FUNC(ucs_status_t, ucp_atomic_rep_batch_handler,
+                 (arg, data, length, am_flags), void *arg, void *data,
+                 size_t length, unsigned am_flags)
+{
+    ucp_worker_h worker             = arg;
+    ucp_atomic_rep_batch_hdr_t *hdr = data;
+    ucp_atomic_rep_entry_t *entry   = (ucp_atomic_rep_entry_t*)(hdr + 1);
+    unsigned i;
+    ucp_ep_h ep;
+
+    for (i = 0; i < hdr->num_replies; ++i) {
+        ucp_amo_sw_reply_recv(worker, entry->req_id, entry + 1, entry->length);
+        entry = UCS_PTR_BYTE_OFFSET(entry + 1, entry->length);
+    }
+
+    ucs_assert(UCS_PTR_BYTE_DIFF(data, entry) == length);
+
+    if (hdr->num_cmpl == 0) {
+        return UCS_OK;
+    }
+
+    /* allow getting closed EP to be used for handling a completion to enable
+     * flush on a peer
+     */
+    UCP_WORKER_GET_EP_BY_ID(&ep, worker, hdr->ep_id, return UCS_OK,
+                            "SW AMO completion");
+    for (i = 0; i < hdr->num_cmpl; ++i) {
+        ucp_ep_rma_remote_request_completed(ep);
+    }
 
     return UCS_OK;
 }
@@ -320,6 +557,7 @@ static void ucp_amo_sw_dump_packet(ucp_worker_h worker, uct_am_trace_type_t type
                                    char *buffer, size_t max)
 {
     const ucp_atomic_req_hdr_t *atomich;
+    const ucp_atomic_rep_batch_hdr_t *batchh;
     const ucp_rma_rep_hdr_t *reph;
     size_t header_len;
     char *p;
@@ -339,6 +577,13 @@ static void ucp_amo_sw_dump_packet(ucp_worker_h worker, uct_am_trace_type_t type
         snprintf(buffer, max, "ATOMIC_REP [req_id 0x%"PRIu64"]", reph->req_id);
         header_len = sizeof(*reph);
         break;
+    case UCP_AM_ID_ATOMIC_REP_BATCH:
+        batchh = data;
+        snprintf(buffer, max,
+                 "ATOMIC_REP_BATCH [ep_id 0x%"PRIx64" cmpl %u replies %u]",
+                 batchh->ep_id, batchh->num_cmpl, batchh->num_replies);
+        header_len = sizeof(*batchh);
+        break;
     default:
         return;
     }
@@ -353,6 +598,9 @@ UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_AMO, UCP_AM_ID_ATOMIC_REQ,
                          ucp_atomic_req_handler, ucp_amo_sw_dump_packet, 0);
 UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_AMO, UCP_AM_ID_ATOMIC_REP,
                          ucp_atomic_rep_handler, ucp_amo_sw_dump_packet, 0);
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_AMO, UCP_AM_ID_ATOMIC_REP_BATCH,
+                         ucp_atomic_rep_batch_handler, ucp_amo_sw_dump_packet,
+                         0);
 
 static size_t ucp_proto_amo_sw_post_pack_cb(void *dest, void *arg)
 {
@@ -91,6 +91,44 @@ typedef struct {
 } UCS_S_PACKED ucp_atomic_req_hdr_t;
 
 
+/**
+ * Capabilities of the origin of a software atomic request, packed after the
+ * request operands
+ */
+enum {
+    /* The origin can handle UCP_AM_ID_ATOMIC_REP_BATCH */
+    UCP_ATOMIC_REQ_CAP_REP_BATCH = UCS_BIT(0)
+};
+
+
+typedef struct {
+    uint64_t                  ep_id;       /* Origin endpoint ID */
+    uint32_t                  num_cmpl;    /* Number of completed operations
+                                              without result */
+    uint16_t                  num_replies; /* Number of reply entries which
+                                              follow the header */
+} UCS_S_PACKED ucp_atomic_rep_batch_hdr_t;
+
+
+typedef struct {
+    uint64_t                  req_id;
+    uint8_t                   length;  /* Length of the reply data which
+                                          follows the entry */
+} UCS_S_PACKED ucp_atomic_rep_entry_t;
+
+
+/**
+ * Software atomic request which was executed by the target and is waiting for
+ * its reply to be sent from the worker progress
+ */
+struct ucp_amo_sw_op {
+    ucp_atomic_req_hdr_t      hdr;
+    uint64_t                  args[2]; /* Operands, in wire format */
+    ucp_atomic_reply_t        result;  /* Fetched value */
+    uint8_t                   caps;    /* Origin capabilities */
+};
+
+
 extern ucp_rma_proto_t ucp_rma_basic_proto;
 extern ucp_rma_proto_t ucp_rma_sw_proto;
 extern ucp_amo_proto_t ucp_amo_basic_proto;
@@ -109,4 +147,6 @@ void ucp_ep_flush_remote_completed(ucp_request_t *req);
 
 void ucp_rma_sw_send_cmpl(ucp_ep_h ep);
 
+ucs_status_t ucp_amo_sw_progress_reply_batch(uct_pending_req_t *self);
+
 #endif
@@ -95,6 +95,38 @@ ucp_proto_rndv_ctrl_get_md_map(const ucp_proto_rndv_ctrl_init_params_t *params,
     }
 }
 
+static ucp_md_map_t
+ucp_proto_rndv_ctrl_get_alloc_md_map(
+        const ucp_proto_rndv_ctrl_init_params_t *params)
+{
+    ucp_context_h context                    = params->super.super.worker->context;
+    const ucp_ep_config_key_t *ep_config_key = params->super.super.ep_config_key;
+    ucp_lane_index_t lane                    = ep_config_key->rkey_ptr_lane;
+    const uct_md_attr_v2_t *md_attr;
+    ucp_md_index_t md_index;
+
+    if ((lane == UCP_NULL_LANE) ||
+        (params->remote_op_id != UCP_OP_ID_RNDV_RECV) ||
+        (params->super.super.select_param->dt_class != UCP_DATATYPE_CONTIG) ||
+        (params->mem_info.type != UCS_MEMORY_TYPE_HOST)) {
+        return 0;
+    }
+
+    /* The remote peer can obtain a pointer to the send buffer if it was
+     * allocated by the memory domain of rkey_ptr lane, even if this memory
+     * domain is not able to register arbitrary memory (e.g posix or sysv)
+     */
+    md_index = ucp_proto_common_get_md_index(&params->super.super, lane);
+    md_attr  = &context->tl_mds[md_index].attr;
+    if (!ucs_test_all_flags(md_attr->flags,
+                            UCT_MD_FLAG_ALLOC | UCT_MD_FLAG_NEED_RKEY) ||
+        (context->reg_md_map[params->mem_info.type] & UCS_BIT(md_index))) {
+        return 0;
+    }
+
+    return UCS_BIT(md_index);
+}
+
 static ucp_md_map_t
 ucp_proto_rndv_md_map_to_remote(const ucp_proto_rndv_ctrl_init_params_t *params,
                                 ucp_md_map_t md_map)
@@ -247,6 +279,8 @@ ucp_proto_rndv_ctrl_init_priv(const ucp_proto_rndv_ctrl_init_params_t *params,
     /* Initialize estimated memory registration map */
     ucp_proto_rndv_ctrl_get_md_map(params, &rpriv->md_map, &rpriv->sys_dev_map,
                                    rpriv->sys_dev_distance);
+    rpriv->alloc_md_map = ucp_proto_rndv_ctrl_get_alloc_md_map(params) &
+                          ~rpriv->md_map;
 
     /* Construct select parameter for the remote protocol */
     if (init_params->rkey_config_key == NULL) {
@@ -271,7 +305,9 @@ ucp_proto_rndv_ctrl_init_priv(const ucp_proto_rndv_ctrl_init_params_t *params,
         rpriv->md_map &= ~init_params->rkey_config_key->unreachable_md_map;
     }
 
-    rpriv->packed_rkey_size = ucp_rkey_packed_size(context, rpriv->md_map,
+    rpriv->packed_rkey_size = ucp_rkey_packed_size(context,
+                                                   rpriv->md_map |
+                                                   rpriv->alloc_md_map,
                                                    select_param->sys_dev,
                                                    rpriv->sys_dev_map);
 
@@ -35,6 +35,10 @@ typedef struct {
     /* Memory domains to send remote keys */
     ucp_md_map_t            md_map;
 
+    /* Memory domains which can expose only memory allocated by themselves;
+       their remote keys are sent only if the buffer was allocated by them */
+    ucp_md_map_t            alloc_md_map;
+
     /* System devices used for communication, used to pack distance in rkey */
     ucp_sys_dev_map_t       sys_dev_map;
 
@@ -15,6 +15,7 @@
 #include <ucp/proto/proto_single.inl>
 #include <ucp/proto/proto_multi.inl>
 #include <ucp/tag/offload.h>
+#include <ucp/stream/stream.h>
 
 
 static UCS_F_ALWAYS_INLINE size_t
@@ -100,6 +101,8 @@ static UCS_F_ALWAYS_INLINE size_t ucp_proto_rndv_rts_pack(
 {
     void *rkey_buffer = UCS_PTR_BYTE_OFFSET(rts, hdr_len);
     const ucp_proto_rndv_ctrl_priv_t *rpriv;
+    ucp_md_map_t md_map;
+    ucp_mem_h memh;
     size_t rkey_size;
 
     rts->sreq.req_id = ucp_send_request_get_id(req);
@@ -113,8 +116,16 @@ static UCS_F_ALWAYS_INLINE size_t ucp_proto_rndv_rts_pack(
         rkey_size    = 0;
     } else {
         rts->address = (uintptr_t)req->send.state.dt_iter.type.contig.buffer;
+        memh         = req->send.state.dt_iter.type.contig.memh;
+        md_map       = rpriv->md_map;
+        if (ucs_unlikely(rpriv->alloc_md_map != 0) && (memh != NULL)) {
+            /* Buffer allocated by a memory domain which is able to expose it
+             * to the peer */
+            md_map |= memh->md_map & rpriv->alloc_md_map;
+        }
+
         rkey_size    = UCS_PROFILE_CALL(ucp_proto_request_pack_rkey, req,
-                                        rpriv->md_map, rpriv->sys_dev_map,
+                                        md_map, rpriv->sys_dev_map,
                                         rpriv->sys_dev_distance, rkey_buffer);
     }
 
@@ -245,7 +256,14 @@ ucp_proto_rndv_bulk_max_payload(ucp_request_t *req,
     size_t max_frag_sum = rpriv->mpriv.max_frag_sum;
     size_t lane_offset, max_payload, scaled_length;
 
-    if (ucs_likely(total_length < max_frag_sum)) {
+    if (ucs_unlikely(rpriv->mpriv.dynamic)) {
+        /* The lane is selected per fragment, so the fragment size does not
+           depend on the position in the buffer */
+        max_payload = ucs_min(ucp_proto_multi_scaled_length(lpriv->weight,
+                                                            total_length),
+                              lpriv->max_frag);
+        max_payload = ucs_max(max_payload, 1);
+    } else if (ucs_likely(total_length < max_frag_sum)) {
         /* Each lane sends less than its maximal fragment size */
         scaled_length = ucp_proto_multi_scaled_length(lpriv->weight_sum,
                                                       total_length);
@@ -352,6 +370,8 @@ ucp_proto_rndv_recv_req_complete(ucp_request_t *recv_req, ucs_status_t status)
 
     if (recv_req->flags & UCP_REQUEST_FLAG_RECV_AM) {
         ucp_request_complete_am_recv(recv_req, status);
+    } else if (recv_req->flags & UCP_REQUEST_FLAG_RECV_STREAM) {
+        ucp_stream_rndv_recv_complete(recv_req, status);
     } else {
         ucs_assert(recv_req->flags & UCP_REQUEST_FLAG_RECV_TAG);
         ucp_request_complete_tag_recv(recv_req, status);
@@ -17,6 +17,7 @@
 #include <ucp/tag/tag_rndv.h>
 #include <ucp/tag/tag_match.inl>
 #include <ucp/tag/offload.h>
+#include <ucp/stream/stream.h>
 #include <ucp/proto/proto_am.inl>
 #include <ucs/datastruct/queue.h>
 
@@ -1108,9 +1109,31 @@ ucs_mpool_ops_t ucp_frag_mpool_ops = {
     .obj_cleanup   = ucs_empty_function
 };
 
+/*
+ * Round up the fragment length to the smallest size class which can hold it.
+ * Size classes are the configured fragment size divided by powers of 2.
+ */
+static size_t ucp_rndv_frag_size_class(ucp_context_h context,
+                                       ucs_memory_type_t mem_type,
+                                       size_t length)
+{
+    size_t frag_size = context->config.ext.rndv_frag_size[mem_type];
+    unsigned i;
+
+    for (i = 1; i < UCP_RNDV_FRAG_SIZE_CLASSES; ++i) {
+        if ((frag_size / 2) < length) {
+            break;
+        }
+
+        frag_size /= 2;
+    }
+
+    return frag_size;
+}
+
 ucp_mem_desc_t *
 ucp_rndv_mpool_get(ucp_worker_h worker, ucs_memory_type_t mem_type,
-                   ucs_sys_device_t sys_dev)
+                   ucs_sys_device_t sys_dev, size_t length)
 {
     ucp_rndv_mpool_priv_t *mpriv;
     ucp_worker_mpool_key_t key;
@@ -1121,23 +1144,22 @@ ucp_rndv_mpool_get(ucp_worker_h worker, ucs_memory_type_t mem_type,
     int khret;
     ucs_mpool_params_t mp_params;
 
-    key.sys_dev  = sys_dev;
-    key.mem_type = mem_type;
+    key.sys_dev   = sys_dev;
+    key.mem_type  = mem_type;
+    key.frag_size = ucp_rndv_frag_size_class(worker->context, mem_type,
+                                             length);
 
     khiter = kh_get(ucp_worker_mpool_hash, &worker->mpool_hash, key);
     if (ucs_likely(khiter != kh_end(&worker->mpool_hash))) {
-        mpool = &kh_val(&worker->mpool_hash, khiter);
+        mpool = kh_val(&worker->mpool_hash, khiter);
         goto out_mp_get;
     }
 
-    khiter = kh_put(ucp_worker_mpool_hash, &worker->mpool_hash, key, &khret);
-    if (khret == UCS_KH_PUT_FAILED) {
+    mpool = ucs_malloc(sizeof(*mpool), "ucp_rndv_frags_mpool");
+    if (mpool == NULL) {
         return NULL;
     }
 
-    ucs_assert_always(khret != UCS_KH_PUT_KEY_PRESENT);
-
-    mpool     = &kh_value(&worker->mpool_hash, khiter);
     num_frags = worker->context->config.ext.rndv_num_frags[key.mem_type];
 
     ucs_mpool_params_reset(&mp_params);
@@ -1149,15 +1171,30 @@ ucp_rndv_mpool_get(ucp_worker_h worker, ucs_memory_type_t mem_type,
     mp_params.name            = "ucp_rndv_frags";
     status = ucs_mpool_init(&mp_params, mpool);
     if (status != UCS_OK) {
-        return NULL;
+        goto err_free_mpool;
     }
 
     mpriv            = ucs_mpool_priv(mpool);
     mpriv->worker    = worker;
     mpriv->mem_type  = key.mem_type;
+    mpriv->frag_size = key.frag_size;
+
+    khiter = kh_put(ucp_worker_mpool_hash, &worker->mpool_hash, key, &khret);
+    if (khret == UCS_KH_PUT_FAILED) {
+        goto err_mpool_cleanup;
+    }
+
+    ucs_assert_always(khret != UCS_KH_PUT_KEY_PRESENT);
+    kh_value(&worker->mpool_hash, khiter) = mpool;
 
 out_mp_get:
     return ucp_worker_mpool_get(mpool);
+
+err_mpool_cleanup:
+    ucs_mpool_cleanup(mpool, 1);
+err_free_mpool:
+    ucs_free(mpool);
+    return NULL;
 }
 
 static void ucp_rndv_send_frag_get_mem_type(ucp_request_t *sreq, size_t length,
@@ -1181,7 +1218,9 @@ static void ucp_rndv_send_frag_get_mem_type(ucp_request_t *sreq, size_t length,
     }
 
     mdesc = ucp_rndv_mpool_get(worker, frag_mem_type,
-                               UCS_SYS_DEVICE_ID_UNKNOWN);
+                               UCS_SYS_DEVICE_ID_UNKNOWN,
+                               worker->context->config.ext.rndv_frag_size[
+                                       frag_mem_type]);
     if (ucs_unlikely(mdesc == NULL)) {
         ucs_fatal("failed to allocate fragment memory desc");
     }
@@ -1358,7 +1397,7 @@ static void ucp_rndv_send_frag_rtr(ucp_worker_h worker, ucp_request_t *rndv_req,
 
         /* allocate fragment recv buffer desc*/
         mdesc = ucp_rndv_mpool_get(worker, frag_mem_type,
-                                   UCS_SYS_DEVICE_ID_UNKNOWN);
+                                   UCS_SYS_DEVICE_ID_UNKNOWN, max_frag_size);
         if (mdesc == NULL) {
             ucs_fatal("failed to allocate fragment memory buffer");
         }
@@ -1734,6 +1773,8 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_rndv_rts_handler,
 
     if (ucp_rndv_rts_is_am(rts_hdr)) {
         return ucp_am_rndv_process_rts(arg, data, length, tl_flags);
+    } else if (ucp_rndv_rts_is_stream(rts_hdr)) {
+        return ucp_stream_rndv_process_rts(worker, rts_hdr, length);
     } else {
         ucs_assert(ucp_rndv_rts_is_tag(rts_hdr));
         return ucp_tag_rndv_process_rts(worker, rts_hdr, length, tl_flags);
@@ -2484,13 +2525,18 @@ static void ucp_rndv_dump(ucp_worker_h worker, uct_am_trace_type_t type,
     }
 }
 
-UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM, UCP_AM_ID_RNDV_RTS,
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM,
+                         UCP_AM_ID_RNDV_RTS,
                          ucp_rndv_rts_handler, ucp_rndv_dump, 0);
-UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM, UCP_AM_ID_RNDV_ATS,
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM,
+                         UCP_AM_ID_RNDV_ATS,
                          ucp_rndv_ats_handler, ucp_rndv_dump, 0);
-UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM, UCP_AM_ID_RNDV_ATP,
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM,
+                         UCP_AM_ID_RNDV_ATP,
                          ucp_rndv_atp_handler, ucp_rndv_dump, 0);
-UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM, UCP_AM_ID_RNDV_RTR,
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM,
+                         UCP_AM_ID_RNDV_RTR,
                          ucp_rndv_rtr_handler, ucp_rndv_dump, 0);
-UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM, UCP_AM_ID_RNDV_DATA,
+UCP_DEFINE_AM_WITH_PROXY(UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM,
+                         UCP_AM_ID_RNDV_DATA,
                          ucp_rndv_data_handler, ucp_rndv_dump, 0);
@@ -12,12 +12,19 @@
 #include <ucs/datastruct/ptr_map.h>
 
 
+/* Number of buffer size classes for rendezvous staging fragments, each one
+ * half the size of the previous, starting from the configured fragment size */
+#define UCP_RNDV_FRAG_SIZE_CLASSES 4
+
+
 typedef enum {
     /* RNDV TAG operation with status UCS_OK (kept for wire compatibility with
      * the previous UCP versions) */
     UCP_RNDV_RTS_TAG_OK       = UCS_OK,
     /* RNDV AM operation */
-    UCP_RNDV_RTS_AM           = 1
+    UCP_RNDV_RTS_AM           = 1,
+    /* RNDV STREAM operation */
+    UCP_RNDV_RTS_STREAM       = 2
 } UCS_S_PACKED ucp_rndv_rts_opcode_t;
 
 
@@ -95,7 +102,7 @@ ucp_rndv_reg_send_buffer(ucp_request_t *sreq, const ucp_request_param_t *param);
 
 ucp_mem_desc_t *
 ucp_rndv_mpool_get(ucp_worker_h worker, ucs_memory_type_t mem_type,
-                   ucs_sys_device_t sys_dev);
+                   ucs_sys_device_t sys_dev, size_t length);
 
 void ucp_rndv_receive(ucp_worker_h worker, ucp_request_t *rreq,
                       const ucp_rndv_rts_hdr_t *rndv_rts_hdr,
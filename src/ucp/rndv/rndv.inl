@@ -17,6 +17,12 @@ ucp_rndv_rts_is_am(const ucp_rndv_rts_hdr_t *rts_hdr)
     return rts_hdr->opcode == UCP_RNDV_RTS_AM;
 }
 
+static UCS_F_ALWAYS_INLINE int
+ucp_rndv_rts_is_stream(const ucp_rndv_rts_hdr_t *rts_hdr)
+{
+    return rts_hdr->opcode == UCP_RNDV_RTS_STREAM;
+}
+
 static UCS_F_ALWAYS_INLINE int
 ucp_rndv_rts_is_tag(const ucp_rndv_rts_hdr_t *rts_hdr)
 {
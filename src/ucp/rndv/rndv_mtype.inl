@@ -37,7 +37,8 @@ ucp_proto_rndv_mtype_request_init(ucp_request_t *req)
     ucp_worker_h worker = req->send.ep->worker;
 
     req->send.rndv.mdesc = ucp_rndv_mpool_get(worker, UCS_MEMORY_TYPE_HOST,
-                                              UCS_SYS_DEVICE_ID_UNKNOWN);
+                                              UCS_SYS_DEVICE_ID_UNKNOWN,
+                                              req->send.state.dt_iter.length);
     if (req->send.rndv.mdesc == NULL) {
         return UCS_ERR_NO_MEMORY;
     }
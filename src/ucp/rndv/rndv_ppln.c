@@ -26,17 +26,23 @@ enum {
 
 /* Private data for pipeline protocol */
 typedef struct {
-    ucp_proto_rndv_ack_priv_t ack;        /* Ack configuration */
-    size_t                    frag_size;  /* Fragment size */
-    ucp_proto_select_elem_t   frag_proto; /* Protocol for fragments */
+    ucp_proto_rndv_ack_priv_t ack;            /* Ack configuration */
+    size_t                    frag_size;      /* Fragment size */
+    size_t                    init_frag_size; /* Size of the first fragment */
+    ucp_proto_select_elem_t   frag_proto;     /* Protocol for fragments */
 } ucp_proto_rndv_ppln_priv_t;
 
 
+/* Minimal bandwidth improvement to keep growing the fragment size */
+static const double ucp_proto_rndv_ppln_bw_gain = 1.1;
+
+
 static ucs_status_t
 ucp_proto_rndv_ppln_init(const ucp_proto_init_params_t *init_params)
 {
     static const double frag_overhead            = 30e-9;
     ucp_worker_h worker                          = init_params->worker;
+    ucp_context_h context                        = worker->context;
     ucp_proto_rndv_ppln_priv_t *rpriv            = init_params->priv;
     const ucp_proto_select_param_t *select_param = init_params->select_param;
     ucp_proto_common_init_params_t err_params    = {
@@ -113,6 +119,13 @@ ucp_proto_rndv_ppln_init(const ucp_proto_init_params_t *init_params)
     *init_params->priv_size = sizeof(*rpriv);
     rpriv->frag_proto       = *select_elem;
     rpriv->frag_size        = frag_max_length;
+    rpriv->init_frag_size   = ucs_max(frag_min_length, 1);
+    rpriv->init_frag_size   = ucs_max(
+            rpriv->init_frag_size, context->config.ext.rndv_ppln_init_frag_size);
+    if (rpriv->init_frag_size >= frag_max_length) {
+        /* Growing the fragment size is disabled */
+        rpriv->init_frag_size = frag_max_length;
+    }
 
     /* Add ATS overhead */
     ppln_overhead = ucs_linear_func_make(frag_overhead,
@@ -152,18 +165,91 @@ static void ucp_proto_rndv_ppln_query(const ucp_proto_query_params_t *params,
     attr->lane_map |= UCS_BIT(rpriv->ack.lane);
 }
 
+static UCS_F_ALWAYS_INLINE size_t
+ucp_proto_rndv_ppln_frag_size(ucp_request_t *req,
+                              const ucp_proto_rndv_ppln_priv_t *rpriv)
+{
+    /* Zero fragment size means it has grown to the maximal one */
+    return (req->send.rndv.ppln.frag_size == 0) ?
+                   rpriv->frag_size : req->send.rndv.ppln.frag_size;
+}
+
+/* @return Nonzero if the request may send one more fragment */
+static UCS_F_ALWAYS_INLINE int
+ucp_proto_rndv_ppln_can_send(ucp_request_t *req)
+{
+    ucp_worker_h worker = req->send.ep->worker;
+
+    /* Always keep at least one fragment in progress for each request */
+    return (req->send.state.completed_size ==
+            req->send.state.dt_iter.offset) ||
+           (worker->rndv_ppln_inflight <
+            worker->context->config.ext.rndv_ppln_max_inflight);
+}
+
+/*
+ * Double the fragment size if the bandwidth observed on the completed fragment
+ * has improved compared to the previous fragment.
+ */
+static void ucp_proto_rndv_ppln_frag_update(ucp_request_t *req,
+                                            size_t frag_length)
+{
+    const ucp_proto_rndv_ppln_priv_t *rpriv = req->send.proto_config->priv;
+    ucs_time_t now                          = ucs_get_time();
+    ucs_time_t elapsed                      = now -
+                                              req->send.rndv.ppln_frag_time;
+    size_t frag_size;
+    double bw;
+
+    req->send.rndv.ppln_frag_time = now;
+
+    frag_size = req->send.rndv.ppln.frag_size;
+    if ((frag_size == 0) || (frag_length != frag_size) || (elapsed == 0)) {
+        /* Fragment size is maximal already, or the fragment was sent before
+           the last update, or the time is too short to measure */
+        return;
+    }
+
+    bw = frag_length / ucs_time_to_sec(elapsed);
+    if (bw > (req->send.rndv.ppln.frag_bw * ucp_proto_rndv_ppln_bw_gain)) {
+        frag_size *= 2;
+        req->send.rndv.ppln.frag_size = (frag_size < rpriv->frag_size) ?
+                                        frag_size : 0;
+        ucp_trace_req(req, "ppln bw %.2f MB/s, fragment size %zu",
+                      bw / UCS_MBYTE,
+                      ucp_proto_rndv_ppln_frag_size(req, rpriv));
+    }
+
+    req->send.rndv.ppln.frag_bw = bw;
+}
+
+static void ucp_proto_rndv_ppln_send_frags(ucp_request_t *req);
+
 static void
 ucp_proto_rndv_ppln_frag_complete(ucp_request_t *freq, int send_ack, int abort,
                                   ucp_proto_complete_cb_t complete_func,
                                   const char *title)
 {
-    ucp_request_t *req = ucp_request_get_super(freq);
+    ucp_request_t *req  = ucp_request_get_super(freq);
+    ucp_worker_h worker = req->send.ep->worker;
+    size_t frag_length  = freq->send.state.dt_iter.length;
+
+    ucs_assert(worker->rndv_ppln_inflight >= frag_length);
+    worker->rndv_ppln_inflight -= frag_length;
 
     if (send_ack) {
-        req->send.rndv.ppln.ack_data_size += freq->send.state.dt_iter.length;
+        req->send.rndv.ppln.ack_data_size += frag_length;
     }
 
     if (!ucp_proto_rndv_frag_complete(req, freq, title) && !abort) {
+        ucp_proto_rndv_ppln_frag_update(req, frag_length);
+
+        /* Send more fragments, unless called from the sending loop of this
+           request */
+        if ((worker->rndv_ppln_req != req) &&
+            !ucp_datatype_iter_is_end(&req->send.state.dt_iter)) {
+            ucp_proto_rndv_ppln_send_frags(req);
+        }
         return;
     }
 
@@ -192,7 +278,8 @@ static ucs_status_t ucp_proto_rndv_recv_ppln_reset(ucp_request_t *req)
 {
     ucs_assert(req->send.rndv.ppln.ack_data_size == 0);
 
-    if (!ucp_proto_common_multi_frag_is_completed(req)) {
+    /* Wait for all fragments which were sent to complete */
+    if (req->send.state.completed_size != req->send.state.dt_iter.offset) {
         return UCS_OK;
     }
 
@@ -220,35 +307,30 @@ void ucp_proto_rndv_ppln_recv_frag_complete(ucp_request_t *freq, int send_ack,
                                       "ppln_recv");
 }
 
-static ucs_status_t ucp_proto_rndv_ppln_progress(uct_pending_req_t *uct_req)
+static void ucp_proto_rndv_ppln_send_frags(ucp_request_t *req)
 {
-    ucp_request_t *req  = ucs_container_of(uct_req, ucp_request_t, send.uct);
-    ucp_worker_h worker = req->send.ep->worker;
+    ucp_worker_h worker              = req->send.ep->worker;
+    ucp_request_t *prev_req          = worker->rndv_ppln_req;
     const ucp_proto_rndv_ppln_priv_t *rpriv;
     ucp_datatype_iter_t next_iter;
     ucs_status_t status;
     ucp_request_t *freq;
     uint8_t sg_count;
 
-    /* Nested pipeline is prevented during protocol selection */
-    ucs_assert(!(req->flags & UCP_REQUEST_FLAG_RNDV_FRAG));
-
-    /* Zero-length is not supported */
-    ucs_assert(req->send.state.dt_iter.length > 0);
+    rpriv                 = req->send.proto_config->priv;
+    worker->rndv_ppln_req = req;
 
-    req->send.state.completed_size    = 0;
-    req->send.rndv.ppln.ack_data_size = 0;
-    rpriv                             = req->send.proto_config->priv;
-
-    while (!ucp_datatype_iter_is_end(&req->send.state.dt_iter)) {
+    do {
         status = ucp_proto_rndv_frag_request_alloc(worker, req, &freq);
         if (status != UCS_OK) {
+            worker->rndv_ppln_req = prev_req;
             ucp_proto_request_abort(req, status);
-            return UCS_OK;
+            return;
         }
 
         /* Initialize datatype for the fragment */
-        ucp_datatype_iter_next_slice(&req->send.state.dt_iter, rpriv->frag_size,
+        ucp_datatype_iter_next_slice(&req->send.state.dt_iter,
+                                     ucp_proto_rndv_ppln_frag_size(req, rpriv),
                                      &freq->send.state.dt_iter, &next_iter,
                                      &sg_count);
 
@@ -267,12 +349,46 @@ static ucs_status_t ucp_proto_rndv_ppln_progress(uct_pending_req_t *uct_req)
 
         ucp_trace_req(req, "send freq %p offset %zu size %zu", freq,
                       freq->send.rndv.offset, freq->send.state.dt_iter.length);
-        UCS_PROFILE_CALL_VOID_ALWAYS(ucp_request_send, freq);
 
+        /* Advance the position before sending, since the fragment may
+           complete immediately */
         ucp_datatype_iter_copy_position(&req->send.state.dt_iter, &next_iter,
                                         UCS_BIT(UCP_DATATYPE_CONTIG));
-    }
+        worker->rndv_ppln_inflight += freq->send.state.dt_iter.length;
+
+        if (ucp_datatype_iter_is_end(&req->send.state.dt_iter)) {
+            /* The request may be released after the last fragment is sent */
+            worker->rndv_ppln_req = prev_req;
+            UCS_PROFILE_CALL_VOID_ALWAYS(ucp_request_send, freq);
+            return;
+        }
+
+        UCS_PROFILE_CALL_VOID_ALWAYS(ucp_request_send, freq);
+    } while (ucp_proto_rndv_ppln_can_send(req));
+
+    worker->rndv_ppln_req = prev_req;
+}
+
+static ucs_status_t ucp_proto_rndv_ppln_progress(uct_pending_req_t *uct_req)
+{
+    ucp_request_t *req = ucs_container_of(uct_req, ucp_request_t, send.uct);
+    const ucp_proto_rndv_ppln_priv_t *rpriv = req->send.proto_config->priv;
+
+    /* Nested pipeline is prevented during protocol selection */
+    ucs_assert(!(req->flags & UCP_REQUEST_FLAG_RNDV_FRAG));
+
+    /* Zero-length is not supported */
+    ucs_assert(req->send.state.dt_iter.length > 0);
+
+    req->send.state.completed_size    = 0;
+    req->send.rndv.ppln.ack_data_size = 0;
+    req->send.rndv.ppln_frag_time     = ucs_get_time();
+    req->send.rndv.ppln.frag_bw       = 0;
+    req->send.rndv.ppln.frag_size     =
+            (rpriv->init_frag_size < rpriv->frag_size) ?
+            rpriv->init_frag_size : 0;
 
+    ucp_proto_rndv_ppln_send_frags(req);
     return UCS_OK;
 }
 
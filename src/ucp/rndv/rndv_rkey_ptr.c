@@ -315,6 +315,13 @@ ucp_proto_rndv_rkey_ptr_mtype_copy_progress(uct_pending_req_t *uct_req)
                                     req->send.state.dt_iter.length,
                                     rkey_buffer, local_mem_type,
                                     rpriv->dst_md_index);
+    if (ppln_data == NULL) {
+        ucs_error("ep %p: failed to allocate peer memory data for address 0x%"
+                  PRIx64, req->send.ep, remote_address);
+        ucp_proto_request_abort(req, UCS_ERR_NO_MEMORY);
+        return UCS_OK;
+    }
+
     if (ppln_data->rkey == NULL) {
         ucs_error("ep %p: failed to get local ptr for address 0x%" PRIx64
                   " length %zu mem_type %s on md_index %u",
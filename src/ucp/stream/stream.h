@@ -10,6 +10,7 @@
 #include <ucp/core/ucp_ep.h>
 #include <ucp/core/ucp_ep.inl>
 #include <ucp/core/ucp_worker.h>
+#include <ucp/rndv/rndv.h>
 
 
 typedef struct {
@@ -25,16 +26,21 @@ typedef struct {
 } ucp_stream_am_data_t;
 
 
-void ucp_stream_ep_init(ucp_ep_h ep);
-
 void ucp_stream_ep_cleanup(ucp_ep_h ep, ucs_status_t status);
 
 void ucp_stream_ep_activate(ucp_ep_h ep);
 
+ucs_status_t ucp_stream_rndv_process_rts(ucp_worker_h worker,
+                                         const ucp_rndv_rts_hdr_t *rts,
+                                         size_t length);
+
+void ucp_stream_rndv_recv_complete(ucp_request_t *req, ucs_status_t status);
+
 
 static UCS_F_ALWAYS_INLINE int ucp_stream_ep_is_queued(ucp_ep_ext_t *ep_ext)
 {
-    return ep_ext->stream.ready_list.next != NULL;
+    return (ep_ext->cold != NULL) &&
+           (ep_ext->cold->stream.ready_list.next != NULL);
 }
 
 static UCS_F_ALWAYS_INLINE int ucp_stream_ep_has_data(ucp_ep_ext_t *ep_ext)
@@ -46,22 +52,24 @@ static UCS_F_ALWAYS_INLINE
 void ucp_stream_ep_enqueue(ucp_ep_ext_t *ep_ext, ucp_worker_h worker)
 {
     ucs_assert(!ucp_stream_ep_is_queued(ep_ext));
-    ucs_list_add_tail(&worker->stream_ready_eps, &ep_ext->stream.ready_list);
+    ucs_list_add_tail(&worker->stream_ready_eps,
+                      &ep_ext->cold->stream.ready_list);
 }
 
 static UCS_F_ALWAYS_INLINE void ucp_stream_ep_dequeue(ucp_ep_ext_t *ep_ext)
 {
-    ucs_list_del(&ep_ext->stream.ready_list);
-    ep_ext->stream.ready_list.next = NULL;
+    ucs_list_del(&ep_ext->cold->stream.ready_list);
+    ep_ext->cold->stream.ready_list.next = NULL;
 }
 
 static UCS_F_ALWAYS_INLINE ucp_ep_ext_t *
 ucp_stream_worker_dequeue_ep_head(ucp_worker_h worker)
 {
     ucp_ep_ext_t *ep_ext = ucs_list_head(&worker->stream_ready_eps,
-                                         ucp_ep_ext_t, stream.ready_list);
+                                         ucp_ep_ext_cold_t,
+                                         stream.ready_list)->ep_ext;
 
-    ucs_assert(ep_ext->stream.ready_list.next != NULL);
+    ucs_assert(ep_ext->cold->stream.ready_list.next != NULL);
     ucp_stream_ep_dequeue(ep_ext);
     return ep_ext;
 }
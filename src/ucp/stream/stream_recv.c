@@ -14,6 +14,7 @@
 #include <ucp/core/ucp_request.h>
 #include <ucp/core/ucp_request.inl>
 #include <ucp/stream/stream.h>
+#include <ucp/rndv/proto_rndv.h>
 
 #include <ucs/datastruct/mpool.inl>
 #include <ucs/profile/profile.h>
@@ -43,11 +44,22 @@
  *                'ucp_recv_desc_t *' inside @ref ucp_stream_release_data after
  *                the buffer was returned to user by
  *                @ref ucp_stream_recv_data_nb as a pointer to 'payload'
+ *
+ * A rendezvous message which can't be received directly to a posted user
+ * buffer is fetched to a descriptor allocated with malloc, which has a
+ * @ref ucp_stream_rndv_desc_t between ucp_recv_desc_t and am_header.
  */
 
 
-#define ucp_stream_rdesc_payload(_rdesc)                                      \
-    (UCS_PTR_BYTE_OFFSET((_rdesc), (_rdesc)->payload_offset))
+/* Private part of a stream descriptor fetched by rendezvous. Its length and
+ * payload offset replace the 32-bit fields of ucp_recv_desc_t, since a
+ * rendezvous message may be larger than 4GB. */
+typedef struct {
+    ucs_queue_head_t parked_q;       /* Receive requests waiting for the data */
+    ucp_ep_ext_t     *ep_ext;        /* Endpoint, or NULL if it was closed */
+    size_t           length;         /* Data length which was not consumed */
+    size_t           payload_offset; /* Offset of the data from the rdesc */
+} ucp_stream_rndv_desc_t;
 
 
 #define ucp_stream_rdesc_am_data(_rdesc)                                      \
@@ -60,14 +72,55 @@
     ((ucp_stream_am_data_t *)_data - 1)->rdesc
 
 
+#define ucp_stream_rdesc_rndv(_rdesc)                                         \
+    ((ucp_stream_rndv_desc_t*)((_rdesc) + 1))
+
+
+static UCS_F_ALWAYS_INLINE size_t
+ucp_stream_rdesc_length(const ucp_recv_desc_t *rdesc)
+{
+    if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_MALLOC)) {
+        return ucp_stream_rdesc_rndv(rdesc)->length;
+    }
+
+    return rdesc->length;
+}
+
+static UCS_F_ALWAYS_INLINE void *
+ucp_stream_rdesc_payload(ucp_recv_desc_t *rdesc)
+{
+    if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_MALLOC)) {
+        return UCS_PTR_BYTE_OFFSET(rdesc,
+                                   ucp_stream_rdesc_rndv(rdesc)->payload_offset);
+    }
+
+    return UCS_PTR_BYTE_OFFSET(rdesc, rdesc->payload_offset);
+}
+
+
+static UCS_F_ALWAYS_INLINE int
+ucp_stream_rdesc_has_data(const ucp_recv_desc_t *rdesc)
+{
+    return !(rdesc->flags & UCP_RECV_DESC_FLAG_RECV_STARTED);
+}
+
+static UCS_F_ALWAYS_INLINE void ucp_stream_rdesc_release(ucp_recv_desc_t *rdesc)
+{
+    if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_MALLOC)) {
+        ucs_free(rdesc);
+    } else {
+        ucp_recv_desc_release(rdesc);
+    }
+}
+
+
 static UCS_F_ALWAYS_INLINE ucp_recv_desc_t *
 ucp_stream_rdesc_dequeue(ucp_ep_ext_t *ep_ext)
 {
-    ucp_recv_desc_t *rdesc = ucs_queue_pull_elem_non_empty(&ep_ext->stream.match_q,
-                                                           ucp_recv_desc_t,
-                                                           stream_queue);
+    ucp_recv_desc_t *rdesc = ucs_queue_pull_elem_non_empty(
+            &ep_ext->cold->stream.match_q, ucp_recv_desc_t, stream_queue);
     ucs_assert(ucp_stream_ep_has_data(ep_ext));
-    if (ucs_unlikely(ucs_queue_is_empty(&ep_ext->stream.match_q))) {
+    if (ucs_unlikely(ucs_queue_is_empty(&ep_ext->cold->stream.match_q))) {
         ep_ext->ep->flags &= ~UCP_EP_FLAG_STREAM_HAS_DATA;
         if (ucp_stream_ep_is_queued(ep_ext)) {
             ucp_stream_ep_dequeue(ep_ext);
@@ -80,17 +133,87 @@ ucp_stream_rdesc_dequeue(ucp_ep_ext_t *ep_ext)
 static UCS_F_ALWAYS_INLINE ucp_recv_desc_t *
 ucp_stream_rdesc_get(ucp_ep_ext_t *ep_ext)
 {
-    ucp_recv_desc_t *rdesc = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
-                                                           ucp_recv_desc_t,
-                                                           stream_queue);
+    ucp_recv_desc_t *rdesc = ucs_queue_head_elem_non_empty(
+            &ep_ext->cold->stream.match_q, ucp_recv_desc_t, stream_queue);
 
     ucs_assert(ucp_stream_ep_has_data(ep_ext));
-    ucs_trace_data("ep %p, rdesc %p with %u stream bytes", ep_ext->ep, rdesc,
-                   rdesc->length);
+    ucs_trace_data("ep %p, rdesc %p with %zu stream bytes", ep_ext->ep, rdesc,
+                   ucp_stream_rdesc_length(rdesc));
 
     return rdesc;
 }
 
+static void ucp_stream_rndv_recv_zcopy(ucp_request_t *req,
+                                       const ucp_rndv_rts_hdr_t *rts,
+                                       size_t rkey_length)
+{
+    ucs_trace_req("stream receive request %p receives %zu bytes by rendezvous",
+                  req, rts->size);
+
+    req->flags             |= UCP_REQUEST_FLAG_RECV_STREAM;
+    req->recv.stream.rdesc  = NULL;
+    req->recv.stream.length = rts->size;
+    ucp_proto_rndv_receive_start(req->recv.worker, req, rts, rts + 1,
+                                 rkey_length);
+}
+
+/*
+ * Allocate a descriptor for fetching the data of a rendezvous message, and a
+ * request to receive it. The caller should put the descriptor to the queue
+ * before starting the receive.
+ */
+static ucs_status_t
+ucp_stream_rndv_fetch_init(ucp_ep_ext_t *ep_ext, const ucp_rndv_rts_hdr_t *rts,
+                           ucp_recv_desc_t **rdesc_p, ucp_request_t **req_p)
+{
+    ucp_worker_h worker   = ep_ext->ep->worker;
+    size_t payload_offset = sizeof(ucp_recv_desc_t) +
+                            sizeof(ucp_stream_rndv_desc_t) +
+                            sizeof(ucp_stream_am_data_t);
+    ucp_stream_rndv_desc_t *rndv_desc;
+    ucp_recv_desc_t *rdesc;
+    ucp_request_t *req;
+    uint8_t sg_count;
+
+    rdesc = ucs_malloc(payload_offset + rts->size, "stream_rndv_rdesc");
+    if (rdesc == NULL) {
+        ucs_error("failed to allocate stream rendezvous descriptor");
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    req = ucp_request_get(worker);
+    if (req == NULL) {
+        ucs_error("failed to allocate stream rendezvous receive request");
+        ucs_free(rdesc);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    rdesc->length              = 0;
+    rdesc->payload_offset      = 0;
+    rdesc->flags               = UCP_RECV_DESC_FLAG_MALLOC |
+                                 UCP_RECV_DESC_FLAG_RECV_STARTED;
+    rdesc->release_desc_offset = 0;
+    ucp_recv_desc_set_name(rdesc, "stream_rndv_fetch");
+
+    rndv_desc         = ucp_stream_rdesc_rndv(rdesc);
+    rndv_desc->ep_ext         = ep_ext;
+    rndv_desc->length         = rts->size;
+    rndv_desc->payload_offset = payload_offset;
+    ucs_queue_head_init(&rndv_desc->parked_q);
+
+    req->flags             = UCP_REQUEST_FLAG_STREAM_RECV |
+                             UCP_REQUEST_FLAG_RECV_STREAM;
+    req->recv.worker       = worker;
+    req->recv.op_attr      = 0;
+    req->recv.stream.rdesc = rdesc;
+    ucp_datatype_iter_init_null(&req->recv.dt_iter, rts->size, &sg_count);
+    req->recv.dt_iter.type.contig.buffer = ucp_stream_rdesc_payload(rdesc);
+
+    *rdesc_p = rdesc;
+    *req_p   = req;
+    return UCS_OK;
+}
+
 static UCS_F_ALWAYS_INLINE ucs_status_ptr_t
 ucp_stream_recv_data_nb_nolock(ucp_ep_h ep, size_t *length)
 {
@@ -102,9 +225,15 @@ ucp_stream_recv_data_nb_nolock(ucp_ep_h ep, size_t *length)
         return UCS_STATUS_PTR(UCS_OK);
     }
 
+    rdesc = ucp_stream_rdesc_get(ep_ext);
+    if (ucs_unlikely(!ucp_stream_rdesc_has_data(rdesc))) {
+        /* Rendezvous data was not fetched yet */
+        return UCS_STATUS_PTR(UCS_OK);
+    }
+
     rdesc = ucp_stream_rdesc_dequeue(ep_ext);
 
-    *length         = rdesc->length;
+    *length         = ucp_stream_rdesc_length(rdesc);
     am_data         = ucp_stream_rdesc_am_data(rdesc);
     am_data->rdesc  = rdesc;
     return am_data + 1;
@@ -130,11 +259,11 @@ ucp_stream_rdesc_dequeue_and_release(ucp_recv_desc_t *rdesc,
                                      ucp_ep_ext_t *ep_ext)
 {
     ucs_assert(ucp_stream_ep_has_data(ep_ext));
-    ucs_assert(rdesc == ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
-                                                      ucp_recv_desc_t,
-                                                      stream_queue));
+    ucs_assert(rdesc ==
+               ucs_queue_head_elem_non_empty(&ep_ext->cold->stream.match_q,
+                                             ucp_recv_desc_t, stream_queue));
     ucp_stream_rdesc_dequeue(ep_ext);
-    ucp_recv_desc_release(rdesc);
+    ucp_stream_rdesc_release(rdesc);
 }
 
 UCS_PROFILE_FUNC_VOID(ucp_stream_data_release, (ep, data),
@@ -144,7 +273,7 @@ UCS_PROFILE_FUNC_VOID(ucp_stream_data_release, (ep, data),
 
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(ep->worker);
 
-    ucp_recv_desc_release(rdesc);
+    ucp_stream_rdesc_release(rdesc);
 
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(ep->worker);
 }
@@ -174,6 +303,19 @@ ucp_request_can_complete_stream_recv(ucp_request_t *req)
     return (req->recv.dt_iter.offset % req->recv.stream.elem_size) == 0;
 }
 
+static UCS_F_ALWAYS_INLINE void
+ucp_stream_recv_complete(ucp_request_t *req, ucs_status_t status)
+{
+    ucs_trace_req(
+            "completing stream receive request %p (%p) " UCP_REQUEST_FLAGS_FMT
+            " count %zu, %s",
+            req, req + 1, UCP_REQUEST_FLAGS_ARG(req->flags),
+            req->recv.stream.length, ucs_status_string(status));
+    UCS_PROFILE_REQUEST_EVENT(req, "complete_stream_recv", status);
+    ucp_request_complete(req, recv.stream.cb, status, req->recv.stream.length,
+                         req->user_data);
+}
+
 static UCS_F_ALWAYS_INLINE void
 ucp_request_complete_stream_recv(ucp_request_t *req, ucp_ep_ext_t *ep_ext,
                                  ucs_status_t status)
@@ -181,20 +323,13 @@ ucp_request_complete_stream_recv(ucp_request_t *req, ucp_ep_ext_t *ep_ext,
     /* dequeue request before complete */
     ucp_request_t *UCS_V_UNUSED check_req;
 
-    check_req = ucs_queue_pull_elem_non_empty(&ep_ext->stream.match_q,
+    check_req = ucs_queue_pull_elem_non_empty(&ep_ext->cold->stream.match_q,
                                               ucp_request_t, recv.queue);
     ucs_assert(check_req == req);
     ucs_assert((req->recv.dt_iter.offset > 0) || UCS_STATUS_IS_ERR(status));
 
     req->recv.stream.length = req->recv.dt_iter.offset;
-    ucs_trace_req(
-            "completing stream receive request %p (%p) " UCP_REQUEST_FLAGS_FMT
-            " count %zu, %s",
-            req, req + 1, UCP_REQUEST_FLAGS_ARG(req->flags),
-            req->recv.stream.length, ucs_status_string(status));
-    UCS_PROFILE_REQUEST_EVENT(req, "complete_stream_recv", status);
-    ucp_request_complete(req, recv.stream.cb, status, req->recv.stream.length,
-                         req->user_data);
+    ucp_stream_recv_complete(req, status);
 }
 
 static UCS_F_ALWAYS_INLINE ssize_t
@@ -229,12 +364,20 @@ static UCS_F_ALWAYS_INLINE ucs_status_t
 ucp_stream_rdesc_advance(ucp_recv_desc_t *rdesc, ssize_t offset,
                          ucp_ep_ext_t *ep_ext)
 {
-    ucs_assert(offset <= rdesc->length);
+    ucp_stream_rndv_desc_t *rndv_desc;
 
     if (ucs_unlikely(offset < 0)) {
         return (ucs_status_t)offset;
-    } else if (ucs_likely(offset == rdesc->length)) {
+    }
+
+    ucs_assert(offset <= ucp_stream_rdesc_length(rdesc));
+
+    if (ucs_likely(offset == ucp_stream_rdesc_length(rdesc))) {
         ucp_stream_rdesc_dequeue_and_release(rdesc, ep_ext);
+    } else if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_MALLOC)) {
+        rndv_desc                  = ucp_stream_rdesc_rndv(rdesc);
+        rndv_desc->length         -= offset;
+        rndv_desc->payload_offset += offset;
     } else {
         rdesc->length         -= offset;
         rdesc->payload_offset += offset;
@@ -250,7 +393,7 @@ ucp_stream_process_rdesc(ucp_recv_desc_t *rdesc, ucp_ep_ext_t *ep_ext,
     ssize_t unpacked;
 
     unpacked = ucp_stream_rdata_unpack(ucp_stream_rdesc_payload(rdesc),
-                                       rdesc->length, req);
+                                       ucp_stream_rdesc_length(rdesc), req);
     ucs_assertv(req->recv.dt_iter.offset <= req->recv.dt_iter.length,
                 "req=%p offset=%zu length=%zu", req, req->recv.dt_iter.offset,
                 req->recv.dt_iter.length);
@@ -274,6 +417,7 @@ ucp_stream_recv_request_init(ucp_request_t *req, ucp_ep_h ep, void *buffer,
 #endif
 
     req->recv.worker           = worker;
+    req->recv.op_attr          = param->op_attr_mask;
     req->recv.stream.length    = 0;
     req->recv.stream.elem_size = ucp_contig_dt_elem_size(datatype);
 
@@ -313,6 +457,7 @@ ucp_stream_try_recv_inplace(ucp_ep_h ep, void *buffer, size_t count,
     ucp_recv_desc_t *rdesc;
     ucs_status_t status;
     uint32_t attr_mask;
+    size_t rdesc_length;
     size_t recv_length;
     size_t elem_size;
 
@@ -342,17 +487,22 @@ ucp_stream_try_recv_inplace(ucp_ep_h ep, void *buffer, size_t count,
     }
 
     rdesc = ucp_stream_rdesc_get(ep_ext);
-    if (rdesc->length < recv_length) {
+    if (ucs_unlikely(!ucp_stream_rdesc_has_data(rdesc))) {
+        return UCS_ERR_NO_PROGRESS;
+    }
+
+    rdesc_length = ucp_stream_rdesc_length(rdesc);
+    if (rdesc_length < recv_length) {
         if (/* Need to fill the receive buffer */
             (ucp_request_param_flags(param) & UCP_STREAM_RECV_FLAG_WAITALL) ||
             /* Need at least one element */
-            (rdesc->length < elem_size)) {
+            (rdesc_length < elem_size)) {
             return UCS_ERR_NO_PROGRESS;
         }
 
         /* Unpack as much data as we have to the user buffer and respect element
            size granularity */
-        recv_length = ucs_align_down(rdesc->length, elem_size);
+        recv_length = ucs_align_down(rdesc_length, elem_size);
     }
 
     ucs_assertv(recv_length > 0, "count=%zu elem_size=%zu", count, elem_size);
@@ -367,21 +517,56 @@ ucp_stream_try_recv_inplace(ucp_ep_h ep, void *buffer, size_t count,
     return ucp_stream_rdesc_advance(rdesc, recv_length, ep_ext);
 }
 
-static ucs_status_ptr_t
-ucp_stream_recv_request(ucp_ep_h ep, ucp_request_t *req, size_t *length,
-                        const ucp_request_param_t *param)
+static UCS_F_ALWAYS_INLINE int
+ucp_stream_rndv_can_recv_zcopy(const ucp_request_t *req, size_t size)
+{
+    if ((req->recv.dt_iter.offset != 0) || (size > req->recv.dt_iter.length)) {
+        return 0;
+    }
+
+    if (size == req->recv.dt_iter.length) {
+        return 1;
+    }
+
+    if (req->flags & UCP_REQUEST_FLAG_STREAM_RECV_WAITALL) {
+        return 0;
+    }
+
+    return (req->recv.dt_iter.dt_class != UCP_DATATYPE_CONTIG) ||
+           ((size % req->recv.stream.elem_size) == 0);
+}
+
+/*
+ * Fill the request with the queued data.
+ *
+ * @return UCS_OK if the request can be completed, UCS_INPROGRESS if it is
+ *         waiting for more data, or error.
+ */
+static ucs_status_t
+ucp_stream_recv_request_process(ucp_ep_ext_t *ep_ext, ucp_request_t *req)
 {
-    ucp_ep_ext_t *ep_ext = ep->ext;
     ucp_recv_desc_t *rdesc;
     ucs_status_t status;
 
     /* OK, lets obtain all arrived data which matches the recv size */
     while ((req->recv.dt_iter.offset < req->recv.dt_iter.length) &&
            ucp_stream_ep_has_data(ep_ext)) {
-        rdesc  = ucp_stream_rdesc_get(ep_ext);
+        rdesc = ucp_stream_rdesc_get(ep_ext);
+        if (ucs_unlikely(!ucp_stream_rdesc_has_data(rdesc))) {
+            if (ucp_request_can_complete_stream_recv(req)) {
+                /* Complete with the data received so far */
+                break;
+            }
+
+            /* Wait until the data is fetched */
+            ucs_queue_push(&ucp_stream_rdesc_rndv(rdesc)->parked_q,
+                           &req->recv.queue);
+            return UCS_INPROGRESS;
+        }
+
         status = ucp_stream_process_rdesc(rdesc, ep_ext, req);
         if (ucs_unlikely(status != UCS_OK)) {
-            return UCS_STATUS_PTR(status);
+            return status;
         }
 
         /*
@@ -398,14 +583,35 @@ ucp_stream_recv_request(ucp_ep_h ep, ucp_request_t *req, size_t *length,
     ucs_assert(req->recv.dt_iter.offset <= req->recv.dt_iter.length);
 
     if (ucp_request_can_complete_stream_recv(req)) {
+        return UCS_OK;
+    }
+
+    ucs_assert(!ucp_stream_ep_has_data(ep_ext));
+    ucs_queue_push(&ep_ext->cold->stream.match_q, &req->recv.queue);
+    return UCS_INPROGRESS;
+}
+
+static ucs_status_ptr_t
+ucp_stream_recv_request(ucp_ep_h ep, ucp_request_t *req, size_t *length,
+                        const ucp_request_param_t *param)
+{
+    ucs_status_t status;
+
+    /* The request may be queued on the endpoint */
+    if (ucs_unlikely(ucp_ep_ext_cold_get(ep->ext) == NULL)) {
+        return UCS_STATUS_PTR(UCS_ERR_NO_MEMORY);
+    }
+
+    status = ucp_stream_recv_request_process(ep->ext, req);
+    if (status == UCS_OK) {
         *length = req->recv.dt_iter.offset;
         ucp_request_imm_cmpl_param(param, req, recv_stream,
                                    req->recv.dt_iter.offset);
         /* unreachable */
+    } else if (UCS_STATUS_IS_ERR(status)) {
+        return UCS_STATUS_PTR(status);
     }
 
-    ucs_assert(!ucp_stream_ep_has_data(ep_ext));
-    ucs_queue_push(&ep_ext->stream.match_q, &req->recv.queue);
     return req + 1;
 }
 
@@ -471,15 +677,16 @@ ucp_stream_am_data_process(ucp_worker_t *worker, ucp_ep_ext_t *ep_ext,
     ssize_t          unpacked;
 
     rdesc_tmp.length         = length;
+    rdesc_tmp.flags          = 0;
     rdesc_tmp.payload_offset = sizeof(*am_data); /* add sizeof(*rdesc) only if
                                                     am_data wont be handled in
                                                     place */
 
     /* First, process expected requests */
     if (!ucp_stream_ep_has_data(ep_ext)) {
-        while (!ucs_queue_is_empty(&ep_ext->stream.match_q)) {
-            req      = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
-                                                     ucp_request_t, recv.queue);
+        while (!ucs_queue_is_empty(&ep_ext->cold->stream.match_q)) {
+            req      = ucs_queue_head_elem_non_empty(
+                    &ep_ext->cold->stream.match_q, ucp_request_t, recv.queue);
             payload  = UCS_PTR_BYTE_OFFSET(am_data, rdesc_tmp.payload_offset);
             unpacked = ucp_stream_rdata_unpack(payload, rdesc_tmp.length, req);
             if (ucs_unlikely(unpacked < 0)) {
@@ -525,37 +732,45 @@ ucp_stream_am_data_process(ucp_worker_t *worker, ucp_ep_ext_t *ep_ext,
     }
 
     ep_ext->ep->flags |= UCP_EP_FLAG_STREAM_HAS_DATA;
-    ucs_queue_push(&ep_ext->stream.match_q, &rdesc->stream_queue);
+    ucs_queue_push(&ep_ext->cold->stream.match_q, &rdesc->stream_queue);
 
     return UCS_INPROGRESS;
 }
 
-void ucp_stream_ep_init(ucp_ep_h ep)
+static void ucp_stream_rndv_fetch_cancel(ucp_recv_desc_t *rdesc,
+                                         ucs_status_t status)
 {
-    ucp_ep_ext_t *ep_ext = ep->ext;
+    ucp_stream_rndv_desc_t *rndv_desc = ucp_stream_rdesc_rndv(rdesc);
+    ucp_request_t *req;
 
-    if (ep->worker->context->config.features & UCP_FEATURE_STREAM) {
-        ep_ext->stream.ready_list.prev = NULL;
-        ep_ext->stream.ready_list.next = NULL;
-        ucs_queue_head_init(&ep_ext->stream.match_q);
+    ucs_queue_for_each_extract(req, &rndv_desc->parked_q, recv.queue, 1) {
+        req->recv.stream.length = req->recv.dt_iter.offset;
+        ucp_stream_recv_complete(req, status);
     }
+
+    /* The descriptor is released when the fetch operation completes */
+    rndv_desc->ep_ext = NULL;
 }
 
 void ucp_stream_ep_cleanup(ucp_ep_h ep, ucs_status_t status)
 {
     ucp_ep_ext_t *ep_ext = ep->ext;
+    ucp_recv_desc_t *rdesc;
     ucp_request_t *req;
-    size_t length;
-    void *data;
 
-    if (!(ep->worker->context->config.features & UCP_FEATURE_STREAM)) {
+    if (!(ep->worker->context->config.features & UCP_FEATURE_STREAM) ||
+        (ep_ext->cold == NULL)) {
         return;
     }
 
     /* drop unmatched data */
-    while ((data = ucp_stream_recv_data_nb_nolock(ep, &length)) != NULL) {
-        ucs_assert_always(!UCS_PTR_IS_ERR(data));
-        ucp_stream_data_release(ep, data);
+    while (ucp_stream_ep_has_data(ep_ext)) {
+        rdesc = ucp_stream_rdesc_dequeue(ep_ext);
+        if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_RECV_STARTED)) {
+            ucp_stream_rndv_fetch_cancel(rdesc, status);
+        } else {
+            ucp_stream_rdesc_release(rdesc);
+        }
     }
 
     if (ucp_stream_ep_is_queued(ep_ext)) {
@@ -564,8 +779,8 @@ void ucp_stream_ep_cleanup(ucp_ep_h ep, ucs_status_t status)
 
     /* cancel not completed requests */
     ucs_assert(!ucp_stream_ep_has_data(ep_ext));
-    while (!ucs_queue_is_empty(&ep_ext->stream.match_q)) {
-        req = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
+    while (!ucs_queue_is_empty(&ep_ext->cold->stream.match_q)) {
+        req = ucs_queue_head_elem_non_empty(&ep_ext->cold->stream.match_q,
                                             ucp_request_t, recv.queue);
         ucp_request_complete_stream_recv(req, ep_ext, status);
     }
@@ -581,6 +796,150 @@ void ucp_stream_ep_activate(ucp_ep_h ep)
     }
 }
 
+ucs_status_t ucp_stream_rndv_process_rts(ucp_worker_h worker,
+                                         const ucp_rndv_rts_hdr_t *rts,
+                                         size_t length)
+{
+    size_t rkey_length = length - sizeof(*rts);
+    ucp_recv_desc_t *rdesc;
+    ucp_ep_ext_t *ep_ext;
+    ucp_request_t *req;
+    ucs_status_t status;
+    ucp_ep_h ep;
+
+    UCP_WORKER_GET_VALID_EP_BY_ID(&ep, worker, rts->sreq.ep_id, return UCS_OK,
+                                  "stream rts");
+    ep_ext = ep->ext;
+    if (ucs_unlikely(ucp_ep_ext_cold_get(ep_ext) == NULL)) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_ep_failed;
+    }
+
+    if (!ucp_stream_ep_has_data(ep_ext) &&
+        !ucs_queue_is_empty(&ep_ext->cold->stream.match_q)) {
+        req = ucs_queue_head_elem_non_empty(&ep_ext->cold->stream.match_q,
+                                            ucp_request_t, recv.queue);
+        if (ucp_stream_rndv_can_recv_zcopy(req, rts->size)) {
+            ucs_queue_pull_non_empty(&ep_ext->cold->stream.match_q);
+            ucp_stream_rndv_recv_zcopy(req, rts, rkey_length);
+            return UCS_OK;
+        }
+    }
+
+    /* No posted receive can hold the whole message, so fetch it to a
+     * temporary buffer right away, to let the sender complete. The posted
+     * receives, if any, wait for the data to arrive. */
+    status = ucp_stream_rndv_fetch_init(ep_ext, rts, &rdesc, &req);
+    if (status != UCS_OK) {
+        goto err_ep_failed;
+    }
+
+    if (!ucp_stream_ep_has_data(ep_ext)) {
+        ucs_queue_splice(&ucp_stream_rdesc_rndv(rdesc)->parked_q,
+                         &ep_ext->cold->stream.match_q);
+        ep->flags |= UCP_EP_FLAG_STREAM_HAS_DATA;
+    }
+
+    ucs_queue_push(&ep_ext->cold->stream.match_q, &rdesc->stream_queue);
+    ucp_proto_rndv_receive_start(worker, req, rts, rts + 1, rkey_length);
+    return UCS_OK;
+
+err_ep_failed:
+    /* The message can't be received, and the stream can't skip it since the
+     * data which follows depends on it. Fail the endpoint rather than leave
+     * the sender waiting for an acknowledgment which is never sent. */
+    ucp_ep_set_failed_schedule(ep, UCP_NULL_LANE, status);
+    return UCS_OK;
+}
+
+static void
+ucp_stream_recv_request_resume(ucp_ep_ext_t *ep_ext, ucp_request_t *req)
+{
+    ucs_status_t status;
+
+    status = ucp_stream_recv_request_process(ep_ext, req);
+    if (status == UCS_INPROGRESS) {
+        return;
+    }
+
+    req->recv.stream.length = req->recv.dt_iter.offset;
+    ucp_stream_recv_complete(req, status);
+}
+
+static void
+ucp_stream_rndv_fetch_complete(ucp_recv_desc_t *rdesc, ucs_status_t status)
+{
+    ucp_stream_rndv_desc_t *rndv_desc = ucp_stream_rdesc_rndv(rdesc);
+    ucp_ep_ext_t *ep_ext              = rndv_desc->ep_ext;
+    ucs_queue_head_t parked_q;
+    ucp_request_t *req;
+
+    if (ep_ext == NULL) {
+        /* The endpoint was closed while fetching the data */
+        ucs_free(rdesc);
+        return;
+    }
+
+    rdesc->flags &= ~UCP_RECV_DESC_FLAG_RECV_STARTED;
+    if (ucs_unlikely(status != UCS_OK)) {
+        ucs_diag("ep %p: failed to receive stream data: %s", ep_ext->ep,
+                 ucs_status_string(status));
+        /* The stream can't skip the lost data, so complete the receives which
+         * were waiting for it, drop the data which follows, and fail the
+         * endpoint. The descriptor is released with the rest of the data. */
+        ucs_queue_for_each_extract(req, &rndv_desc->parked_q, recv.queue, 1) {
+            req->recv.stream.length = req->recv.dt_iter.offset;
+            ucp_stream_recv_complete(req, status);
+        }
+        ucp_stream_ep_cleanup(ep_ext->ep, status);
+        ucp_ep_set_failed_schedule(ep_ext->ep, UCP_NULL_LANE, status);
+        return;
+    }
+
+    if (rdesc != ucp_stream_rdesc_get(ep_ext)) {
+        /* A previous message is still being fetched, and the receive
+         * requests are waiting for it */
+        ucs_assert(ucs_queue_is_empty(&rndv_desc->parked_q));
+        if (ucp_stream_rdesc_length(rdesc) == 0) {
+            ucs_queue_remove(&ep_ext->cold->stream.match_q,
+                             &rdesc->stream_queue);
+            ucs_free(rdesc);
+        }
+        return;
+    }
+
+    ucs_queue_head_init(&parked_q);
+    ucs_queue_splice(&parked_q, &rndv_desc->parked_q);
+
+    if (ucp_stream_rdesc_length(rdesc) == 0) {
+        ucp_stream_rdesc_dequeue_and_release(rdesc, ep_ext);
+    }
+
+    /* Pass the data to the receive requests which were waiting for it */
+    ucs_queue_for_each_extract(req, &parked_q, recv.queue, 1) {
+        ucp_stream_recv_request_resume(ep_ext, req);
+    }
+
+    if (ucp_stream_ep_has_data(ep_ext) && !ucp_stream_ep_is_queued(ep_ext) &&
+        (ep_ext->ep->flags & UCP_EP_FLAG_USED)) {
+        ucp_stream_ep_enqueue(ep_ext, ep_ext->ep->worker);
+    }
+}
+
+void ucp_stream_rndv_recv_complete(ucp_request_t *req, ucs_status_t status)
+{
+    ucp_recv_desc_t *rdesc = req->recv.stream.rdesc;
+
+    if (rdesc == NULL) {
+        /* The data was received directly to the user buffer */
+        ucp_stream_recv_complete(req, status);
+        return;
+    }
+
+    ucp_request_put(req);
+    ucp_stream_rndv_fetch_complete(rdesc, status);
+}
+
 static UCS_F_ALWAYS_INLINE ucs_status_t
 ucp_stream_am_handler(void *am_arg, void *am_data, size_t am_length,
                       unsigned am_flags)
@@ -597,6 +956,10 @@ ucp_stream_am_handler(void *am_arg, void *am_data, size_t am_length,
     UCP_WORKER_GET_VALID_EP_BY_ID(&ep, worker, data->hdr.ep_id, return UCS_OK,
                                   "stream data");
     ep_ext = ep->ext;
+    if (ucs_unlikely(ucp_ep_ext_cold_get(ep_ext) == NULL)) {
+        return UCS_OK;
+    }
+
     status = ucp_stream_am_data_process(worker, ep_ext, data,
                                         am_length - sizeof(data->hdr),
                                         am_flags);
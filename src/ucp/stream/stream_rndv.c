@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "stream.h"
+
+#include <ucp/proto/proto_init.h>
+#include <ucp/proto/proto_single.inl>
+#include <ucp/rndv/proto_rndv.inl>
+
+
+static size_t ucp_stream_rndv_rts_pack(void *dest, void *arg)
+{
+    ucp_rndv_rts_hdr_t *rts_hdr = dest;
+    ucp_request_t *req          = arg;
+
+    /* The endpoint is identified by the send request header */
+    rts_hdr->hdr    = 0;
+    rts_hdr->opcode = UCP_RNDV_RTS_STREAM;
+
+    return ucp_proto_rndv_rts_pack(req, rts_hdr, sizeof(*rts_hdr));
+}
+
+UCS_PROFILE_FUNC(ucs_status_t, ucp_stream_rndv_rts_progress, (self),
+                 uct_pending_req_t *self)
+{
+    ucp_request_t *req = ucs_container_of(self, ucp_request_t, send.uct);
+    const ucp_proto_rndv_ctrl_priv_t *rpriv;
+    size_t max_rts_size;
+    ucs_status_t status;
+
+    rpriv        = req->send.proto_config->priv;
+    max_rts_size = sizeof(ucp_rndv_rts_hdr_t) + rpriv->packed_rkey_size;
+
+    status = UCS_PROFILE_CALL(ucp_proto_rndv_rts_request_init, req);
+    if (status != UCS_OK) {
+        ucp_proto_request_abort(req, status);
+        return UCS_OK;
+    }
+
+    return UCS_PROFILE_CALL(ucp_proto_am_bcopy_single_progress, req,
+                            UCP_AM_ID_RNDV_RTS, rpriv->lane,
+                            ucp_stream_rndv_rts_pack, req, max_rts_size, NULL,
+                            0);
+}
+
+static ucs_status_t
+ucp_stream_rndv_rts_init(const ucp_proto_init_params_t *init_params)
+{
+    if (!ucp_proto_init_check_op(init_params,
+                                 UCS_BIT(UCP_OP_ID_STREAM_SEND))) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    return ucp_proto_rndv_rts_init(init_params);
+}
+
+ucp_proto_t ucp_stream_rndv_proto = {
+    .name     = "stream/rndv",
+    .desc     = NULL,
+    .flags    = 0,
+    .init     = ucp_stream_rndv_rts_init,
+    .query    = ucp_proto_rndv_rts_query,
+    .progress = {ucp_stream_rndv_rts_progress},
+    .abort    = ucp_proto_rndv_rts_abort,
+    .reset    = ucp_proto_rndv_rts_reset
+};
@@ -12,6 +12,7 @@
 #include "tag_match.inl"
 
 #include <ucp/tag/tag_rndv.h>
+#include <ucp/tag/tag_self.h>
 #include <ucp/api/ucp.h>
 #include <ucp/rndv/rndv.h>
 #include <ucp/core/ucp_worker.h>
@@ -53,6 +54,8 @@ UCS_PROFILE_FUNC(ucp_tag_message_h, ucp_tag_probe_nb,
                     ucs_offsetof(ucp_eager_first_hdr_t, total_len) ==
                     ucs_offsetof(ucp_offload_first_desc_t, total_length));
             info->length = ((ucp_eager_first_hdr_t*)(rdesc + 1))->total_len;
+        } else if (flags & UCP_RECV_DESC_FLAG_SELF_REF) {
+            info->length = ucp_tag_self_ref_sreq(rdesc)->send.length;
         } else {
             ucs_assert(flags & UCP_RECV_DESC_FLAG_RNDV);
             info->length = ucp_tag_rndv_rts_from_rdesc(rdesc)->size;
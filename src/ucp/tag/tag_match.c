@@ -10,6 +10,7 @@
 
 #include "tag_match.inl"
 #include <ucp/tag/offload.h>
+#include <ucp/tag/tag_self.h>
 
 
 ucs_status_t ucp_tag_match_init(ucp_tag_match_t *tm)
@@ -60,6 +61,9 @@ void ucp_tag_match_cleanup(ucp_tag_match_t *tm)
     ucs_list_for_each_safe(rdesc, tmp_rdesc, &tm->unexpected.all,
                            tag_list[UCP_RDESC_ALL_LIST]) {
         ucs_warn("unexpected tag-receive descriptor %p was not matched", rdesc);
+        if (rdesc->flags & UCP_RECV_DESC_FLAG_SELF_REF) {
+            ucp_tag_self_ref_discard(rdesc, UCS_ERR_CANCELED);
+        }
         ucp_tag_unexp_remove(rdesc);
         ucp_recv_desc_release(rdesc);
     }
@@ -10,6 +10,7 @@
 
 #include "eager.h"
 #include "tag_rndv.h"
+#include "tag_self.h"
 #include "tag_match.inl"
 #include "offload.h"
 
@@ -172,6 +173,8 @@ static UCS_F_ALWAYS_INLINE ucs_status_ptr_t ucp_tag_recv_common(
                              rdesc->length);
         UCP_WORKER_STAT_RNDV(worker, RX_UNEXP, 1);
         ucp_recv_desc_release(rdesc);
+    } else if (ucs_unlikely(rdesc->flags & UCP_RECV_DESC_FLAG_SELF_REF)) {
+        ucp_tag_self_ref_matched(req, rdesc);
     } else {
         ucp_tag_recv_eager_multi(worker, req, rdesc);
     }
@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "tag_self.h"
+#include "eager.h"
+#include "tag_match.inl"
+#include "offload.h"
+
+#include <ucp/core/ucp_ep.h>
+#include <ucp/core/ucp_worker.h>
+#include <ucp/core/ucp_request.inl>
+
+
+/*
+ * Messages sent to the local worker are matched while they are sent:
+ * - If a receive is posted, the data is copied directly to its buffer.
+ * - Otherwise, a message which fits in an eager fragment is copied to an
+ *   unexpected descriptor, and a message which would be sent by rendezvous is
+ *   queued by reference to its send buffer, so it is copied only once, when
+ *   it is received.
+ * Other messages go through the regular protocols over the "self" transport,
+ * which delivers them while they are sent as well, so the order of messages
+ * is preserved.
+ */
+
+static ucs_status_ptr_t
+ucp_tag_send_self_complete(ucp_worker_h worker, const ucp_request_param_t *param)
+{
+    ucp_request_t *req;
+
+    if (ucs_likely(!(param->op_attr_mask & UCP_OP_ATTR_FLAG_NO_IMM_CMPL))) {
+        return UCS_STATUS_PTR(UCS_OK);
+    }
+
+    req = ucp_request_get_param(worker, param,
+                                {return UCS_STATUS_PTR(UCS_ERR_NO_MEMORY);});
+    req->flags  = UCP_REQUEST_FLAG_COMPLETED | UCP_REQUEST_FLAG_SEND_TAG;
+    req->status = UCS_OK;
+    return ucp_request_prevent_imm_cmpl(param, req, send);
+}
+
+static ucs_status_ptr_t
+ucp_tag_send_self_expected(ucp_ep_h ep, ucp_request_t *rreq,
+                           const void *buffer, size_t length, ucp_tag_t tag,
+                           const ucp_request_param_t *param)
+{
+    ucp_worker_h worker = ep->worker;
+    ucs_status_t status;
+
+    ucs_trace_req("self send tag %" PRIx64 " length %zu matched req %p", tag,
+                  length, rreq);
+    UCP_EP_STAT_TAG_OP(ep, EAGER);
+    UCP_WORKER_STAT_EAGER_MSG(worker, UCP_RECV_DESC_FLAG_EAGER_ONLY);
+    UCP_WORKER_STAT_EAGER_CHUNK(worker, EXP);
+
+    ucp_tag_offload_try_cancel(worker, rreq, UCP_TAG_OFFLOAD_CANCEL_FORCE);
+
+    rreq->recv.tag.info.sender_tag = tag;
+    rreq->recv.tag.info.length     = length;
+    status = ucp_request_recv_data_unpack(rreq, buffer, length, 0, 0, 1);
+    ucp_request_complete_tag_recv(rreq, status);
+
+    return ucp_tag_send_self_complete(worker, param);
+}
+
+static ucs_status_ptr_t
+ucp_tag_send_self_eager(ucp_ep_h ep, const void *buffer, size_t length,
+                        ucp_tag_t tag, const ucp_request_param_t *param)
+{
+    ucp_worker_h worker = ep->worker;
+    ucp_recv_desc_t *rdesc;
+    ucs_status_t status;
+
+    status = ucp_recv_desc_init(worker, (void*)buffer, length,
+                                sizeof(ucp_eager_hdr_t), 0,
+                                sizeof(ucp_eager_hdr_t),
+                                UCP_RECV_DESC_FLAG_EAGER |
+                                UCP_RECV_DESC_FLAG_EAGER_ONLY,
+                                0, 1, "tag_self_eager", &rdesc);
+    if (ucs_unlikely(status != UCS_OK)) {
+        return UCS_STATUS_PTR(status);
+    }
+
+    UCP_EP_STAT_TAG_OP(ep, EAGER);
+    ((ucp_eager_hdr_t*)(rdesc + 1))->super.tag = tag;
+    ucp_tag_unexp_recv(&worker->tm, rdesc, tag);
+
+    return ucp_tag_send_self_complete(worker, param);
+}
+
+static ucs_status_ptr_t
+ucp_tag_send_self_ref(ucp_ep_h ep, const void *buffer, size_t length,
+                      ucs_memory_type_t mem_type, ucp_tag_t tag,
+                      const ucp_request_param_t *param)
+{
+    ucp_worker_h worker = ep->worker;
+    ucp_tag_self_ref_hdr_t hdr;
+    ucp_recv_desc_t *rdesc;
+    ucp_request_t *sreq;
+    ucs_status_t status;
+
+    sreq = ucp_request_get_param(worker, param,
+                                 {return UCS_STATUS_PTR(UCS_ERR_NO_MEMORY);});
+
+    hdr.super.tag = tag;
+    hdr.sreq      = sreq;
+    status        = ucp_recv_desc_init(worker, &hdr, sizeof(hdr), 0, 0,
+                                       sizeof(hdr), UCP_RECV_DESC_FLAG_SELF_REF,
+                                       0, 1, "tag_self_ref", &rdesc);
+    if (ucs_unlikely(status != UCS_OK)) {
+        ucp_request_put_param(param, sreq);
+        return UCS_STATUS_PTR(status);
+    }
+
+    sreq->flags              = UCP_REQUEST_FLAG_SEND_TAG;
+    sreq->status             = UCS_OK;
+    sreq->send.ep            = ep;
+    sreq->send.buffer        = (void*)buffer;
+    sreq->send.datatype      = ucp_dt_make_contig(1);
+    sreq->send.length        = length;
+    sreq->send.mem_type      = mem_type;
+    sreq->send.msg_proto.tag = tag;
+    ucp_request_set_send_callback_param(param, sreq, send);
+
+    UCP_EP_STAT_TAG_OP(ep, RNDV);
+    ucp_tag_unexp_recv(&worker->tm, rdesc, tag);
+
+    ucs_trace_req("self send tag %" PRIx64 " length %zu queued by reference, "
+                  "returning send request %p", tag, length, sreq);
+    return sreq + 1;
+}
+
+ucs_status_t ucp_tag_send_self(ucp_ep_h ep, const void *buffer, size_t count,
+                               ucp_tag_t tag, const ucp_request_param_t *param,
+                               ucs_status_ptr_t *ret_p)
+{
+    ucp_ep_config_t *ep_config = ucp_ep_config(ep);
+    ucp_worker_h worker        = ep->worker;
+    uintptr_t datatype         = ucp_request_param_datatype(param);
+    ucs_memory_type_t mem_type;
+    ucp_request_t *rreq;
+    size_t length;
+
+    if (!UCP_DT_IS_CONTIG(datatype)) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    length   = ucp_contig_dt_length(datatype, count);
+    mem_type = ucp_request_get_memory_type(worker->context, buffer, count,
+                                           datatype, length, param);
+    if (!UCP_MEM_IS_HOST(mem_type)) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    rreq = ucp_tag_exp_search(&worker->tm, tag);
+    if (rreq != NULL) {
+        *ret_p = ucp_tag_send_self_expected(ep, rreq, buffer, length, tag,
+                                            param);
+    } else if ((length + sizeof(ucp_eager_hdr_t)) <=
+               ep_config->tag.eager.max_bcopy) {
+        *ret_p = ucp_tag_send_self_eager(ep, buffer, length, tag, param);
+    } else if ((length >= ucs_min(ep_config->tag.rndv.am_thresh.remote,
+                                  ep_config->tag.rndv.rma_thresh.remote)) &&
+               !(param->op_attr_mask & UCP_OP_ATTR_FLAG_FORCE_IMM_CMPL)) {
+        *ret_p = ucp_tag_send_self_ref(ep, buffer, length, mem_type, tag,
+                                       param);
+    } else {
+        /* Medium unexpected message keeps the eager completion semantics */
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    return UCS_OK;
+}
+
+void ucp_tag_self_ref_matched(ucp_request_t *req, ucp_recv_desc_t *rdesc)
+{
+    ucp_request_t *sreq = ucp_tag_self_ref_sreq(rdesc);
+    ucs_status_t status;
+
+    ucs_trace_req("self rdesc %p matched req %p, send req %p length %zu",
+                  rdesc, req, sreq, sreq->send.length);
+    UCP_WORKER_STAT_RNDV(req->recv.worker, RX_UNEXP, 1);
+
+    req->recv.tag.info.sender_tag = ucp_rdesc_get_tag(rdesc);
+    req->recv.tag.info.length     = sreq->send.length;
+    ucp_recv_desc_release(rdesc);
+
+    status = ucp_request_recv_data_unpack(req, sreq->send.buffer,
+                                          sreq->send.length, 0, 0, 1);
+    ucp_request_complete_tag_recv(req, status);
+    ucp_request_complete_send(sreq, UCS_OK);
+}
+
+void ucp_tag_self_ref_discard(ucp_recv_desc_t *rdesc, ucs_status_t status)
+{
+    ucp_request_complete_send(ucp_tag_self_ref_sreq(rdesc), status);
+}
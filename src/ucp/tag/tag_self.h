@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCP_TAG_SELF_H_
+#define UCP_TAG_SELF_H_
+
+#include "tag_match.h"
+
+#include <ucp/api/ucp.h>
+#include <ucp/core/ucp_request.h>
+
+
+/*
+ * Unexpected message sent to the local worker, which is queued by reference:
+ * the data stays in the send buffer until the message is received.
+ */
+typedef struct {
+    ucp_tag_hdr_t             super;
+    ucp_request_t             *sreq;  /* Send request, completed on receive */
+} UCS_S_PACKED ucp_tag_self_ref_hdr_t;
+
+
+/**
+ * Send a tag message on an endpoint connected to the local worker, bypassing
+ * the transport.
+ *
+ * @return UCS_OK if the message was handled and @a ret_p is set to the result
+ *         of the send operation, or UCS_ERR_UNSUPPORTED if the message should
+ *         be sent by the regular protocols.
+ */
+ucs_status_t ucp_tag_send_self(ucp_ep_h ep, const void *buffer, size_t count,
+                               ucp_tag_t tag, const ucp_request_param_t *param,
+                               ucs_status_ptr_t *ret_p);
+
+
+/**
+ * Receive a message queued by reference into the receive request @a req, and
+ * complete both the receive and the send operations.
+ */
+void ucp_tag_self_ref_matched(ucp_request_t *req, ucp_recv_desc_t *rdesc);
+
+
+/**
+ * Complete the send operation of a message queued by reference, which is
+ * discarded without being received.
+ */
+void ucp_tag_self_ref_discard(ucp_recv_desc_t *rdesc, ucs_status_t status);
+
+
+static UCS_F_ALWAYS_INLINE ucp_request_t *
+ucp_tag_self_ref_sreq(ucp_recv_desc_t *rdesc)
+{
+    ucs_assert(rdesc->flags & UCP_RECV_DESC_FLAG_SELF_REF);
+    return ((ucp_tag_self_ref_hdr_t*)(rdesc + 1))->sreq;
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include "tag_match.inl"
 #include "eager.h"
 #include "tag_rndv.h"
+#include "tag_self.h"
 
 #include <ucp/core/ucp_ep.h>
 #include <ucp/core/ucp_worker.h>
@@ -250,6 +251,13 @@ UCS_PROFILE_FUNC(ucs_status_ptr_t, ucp_tag_send_nbx,
     ucs_trace_req("send_nbx buffer %p count %zu tag %"PRIx64" to %s",
                   buffer, count, tag, ucp_ep_peer_name(ep));
 
+    if (ucs_unlikely(ucp_ep_config(ep)->tag.self_bypass)) {
+        status = ucp_tag_send_self(ep, buffer, count, tag, param, &ret);
+        if (status == UCS_OK) {
+            goto out;
+        }
+    }
+
     attr_mask = param->op_attr_mask &
                 (UCP_OP_ATTR_FIELD_DATATYPE | UCP_OP_ATTR_FLAG_NO_IMM_CMPL);
 
@@ -13,6 +13,7 @@
 
 #include <ucp/core/ucp_worker.h>
 #include <ucp/core/ucp_ep.inl>
+#include <ucs/algorithm/crc.h>
 #include <ucs/arch/bitops.h>
 #include <ucs/datastruct/array.h>
 #include <ucs/debug/log.h>
@@ -108,6 +109,32 @@
  *    (*3) - iface attrs format defined by ucp_address_v2_packed_iface_attr_t
  *    (*4) - present and contains actual iface address length,
  *           if if_addr_len == 63
+ *
+ * Address version 2 dictionary formats:
+ *
+ *   Dictionary address (DICT header flag) - the regular address, with a 64-bit
+ *   dictionary id between the worker name and the first device. The receiver
+ *   keeps a copy of the address body, without the device and interface
+ *   addresses, under this id:
+ *
+ *      +--------+------+-----------+---------+---------+----------------+
+ *      | header | uuid | client_id |  name   | dict_id |  devices ...   |
+ *      +--------+------+-----------+---------+---------+----------------+
+ *
+ *   Compact address (COMPACT header flag) - only the device and interface
+ *   addresses, in the order of the dictionary entries; their lengths are
+ *   taken from the dictionary:
+ *
+ *      +--------+------+-----------+---------+---------+--------+-------+
+ *      | header | uuid | client_id |  name   | dict_id |dev_addr|if_addr| ...
+ *      +--------+------+-----------+---------+---------+--------+-------+
+ *
+ *   The dictionary id is composed of the length and the CRC32 of the address
+ *   body with the device and interface addresses removed, so workers having
+ *   the same kind of resources share a dictionary, even on different nodes.
+ *   Since the id is not unique, the receiver compares the contents of
+ *   dictionary addresses having a known id, and rejects compact addresses
+ *   which refer to an id used by different dictionaries.
  */
 
 
@@ -175,6 +202,34 @@ typedef struct {
 UCS_ARRAY_DECLARE_TYPE(ucp_address_remote_device_array_t, unsigned,
                        ucp_address_remote_device_t);
 
+/* Location of the device and interface addresses in a packed address body,
+ * which are the only parts of a dictionary address specific to a particular
+ * worker */
+typedef struct {
+    const void *body;        /* Start of the devices list */
+    const void *body_end;    /* End of the devices list */
+    unsigned   num_segments; /* Number of non-empty device and interface
+                                addresses */
+    struct {
+        const void *addr;
+        size_t     length;
+    } segments[UCP_MAX_RESOURCES * 2];
+} ucp_address_dict_layout_t;
+
+static UCS_F_ALWAYS_INLINE void
+ucp_address_dict_layout_add(ucp_address_dict_layout_t *layout,
+                            const void *addr, size_t length)
+{
+    if ((layout == NULL) || (length == 0)) {
+        return;
+    }
+
+    ucs_assert(layout->num_segments < ucs_static_array_size(layout->segments));
+    layout->segments[layout->num_segments].addr   = addr;
+    layout->segments[layout->num_segments].length = length;
+    ++layout->num_segments;
+}
+
 #define UCP_ADDRESS_V1_FLAG_ATOMIC32  UCS_BIT(30) /* 32bit atomic operations */
 #define UCP_ADDRESS_V1_FLAG_ATOMIC64  UCS_BIT(31) /* 64bit atomic operations */
 
@@ -222,11 +277,18 @@ UCS_ARRAY_DECLARE_TYPE(ucp_address_remote_device_array_t, unsigned,
 #define UCP_ADDRESS_DEFAULT_WORKER_UUID     0
 #define UCP_ADDRESS_DEFAULT_CLIENT_ID       0
 
+/* Maximal number of address dictionaries kept by a worker. Dictionaries do not
+ * include device addresses, so there is one per kind of peer configuration
+ * rather than per node. */
+#define UCP_ADDRESS_DICT_MAX                64
+
 enum {
     UCP_ADDRESS_HEADER_FLAG_DEBUG_INFO  = UCS_BIT(0),  /* Address has debug info */
     UCP_ADDRESS_HEADER_FLAG_WORKER_UUID = UCS_BIT(1),  /* Worker unique id */
     UCP_ADDRESS_HEADER_FLAG_CLIENT_ID   = UCS_BIT(2),  /* Worker client id */
-    UCP_ADDRESS_HEADER_FLAG_AM_ONLY     = UCS_BIT(3)   /* Only AM lane info */
+    UCP_ADDRESS_HEADER_FLAG_AM_ONLY     = UCS_BIT(3),  /* Only AM lane info */
+    UCP_ADDRESS_HEADER_FLAG_DICT        = UCS_BIT(4),  /* Dictionary address */
+    UCP_ADDRESS_HEADER_FLAG_COMPACT     = UCS_BIT(5)   /* Compact address */
 };
 
 static size_t ucp_address_iface_attr_size(ucp_worker_t *worker, uint64_t flags,
@@ -1190,7 +1252,8 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
                     unsigned pack_flags, ucp_object_version_t addr_version,
                     const ucp_lane_index_t *lanes2remote,
                     const ucp_address_packed_device_t *devices,
-                    ucp_rsc_index_t num_devices)
+                    ucp_rsc_index_t num_devices,
+                    ucp_address_dict_layout_t *layout)
 {
     ucp_context_h context       = worker->context;
     uint64_t md_flags_pack_mask = (UCT_MD_FLAG_REG | UCT_MD_FLAG_ALLOC);
@@ -1251,6 +1314,11 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
 
     ucp_address_pack_header_flags(address_header_p, addr_version, addr_flags);
 
+    if (layout != NULL) {
+        layout->body         = ptr;
+        layout->num_segments = 0;
+    }
+
     if (num_devices == 0) {
         *((uint8_t*)ptr) = UCP_NULL_RESOURCE;
         ptr = UCS_PTR_TYPE_OFFSET(ptr, UCP_NULL_RESOURCE);
@@ -1305,6 +1373,12 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
             }
 
             ucp_address_memcheck(context, ptr, dev->dev_addr_len, dev->rsc_index);
+            /* Device addresses of devices without transports are not
+             * unpacked, so they are kept in the dictionary */
+            if (!UCS_BITMAP_IS_ZERO_INPLACE(&dev_tl_bitmap)) {
+                ucp_address_dict_layout_add(layout, ptr, dev->dev_addr_len);
+            }
+
             ptr = UCS_PTR_BYTE_OFFSET(ptr, dev->dev_addr_len);
         }
 
@@ -1367,6 +1441,8 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
                 }
 
                 ucp_address_memcheck(context, ptr, iface_addr_len, rsc_index);
+                ucp_address_dict_layout_add(layout, ptr, iface_addr_len);
+
                 ptr = UCS_PTR_BYTE_OFFSET(ptr, iface_addr_len);
             }
 
@@ -1493,6 +1569,10 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
     }
 
 out:
+    if (layout != NULL) {
+        layout->body_end = ptr;
+    }
+
     ucs_assertv(UCS_PTR_BYTE_OFFSET(buffer, size) == ptr,
                 "buffer=%p size=%zu ptr=%p ptr-buffer=%zd",
                 buffer, size, ptr, UCS_PTR_BYTE_DIFF(buffer, ptr));
@@ -1526,6 +1606,11 @@ out:
     return status;
 }
 
+static ucs_status_t
+ucp_address_pack_dict(ucp_worker_h worker, unsigned pack_flags,
+                      const ucp_address_dict_layout_t *layout, size_t *size_p,
+                      void **buffer_p);
+
 ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
                               const ucp_tl_bitmap_t *tl_bitmap,
                               unsigned pack_flags,
@@ -1534,6 +1619,7 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
                               unsigned max_num_paths, size_t *size_p,
                               void **buffer_p)
 {
+    ucp_address_dict_layout_t dict_layout, *layout;
     ucp_address_packed_device_t *devices;
     ucp_rsc_index_t num_devices;
     const ucp_ep_config_key_t *key;
@@ -1569,10 +1655,21 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
 
     memset(buffer, 0, size);
 
+    /* Dictionary and compact addresses are made from the full address, using
+     * the location of the interface addresses recorded while packing it */
+    if ((pack_flags & (UCP_ADDRESS_PACK_FLAG_DICT |
+                       UCP_ADDRESS_PACK_FLAG_COMPACT)) &&
+        !(pack_flags & UCP_ADDRESS_PACK_FLAG_EP_ADDR) &&
+        (addr_version == UCP_OBJECT_VERSION_V2) && (num_devices > 0)) {
+        layout = &dict_layout;
+    } else {
+        layout = NULL;
+    }
+
     /* Pack the address */
     status = ucp_address_do_pack(worker, ep, buffer, size, pack_flags,
                                  addr_version, lanes2remote, devices,
-                                 num_devices);
+                                 num_devices, layout);
     if (status != UCS_OK) {
         ucs_free(buffer);
         goto out_free_devices;
@@ -1584,6 +1681,14 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
     *buffer_p = buffer;
     status    = UCS_OK;
 
+    if (layout != NULL) {
+        status = ucp_address_pack_dict(worker, pack_flags, layout, size_p,
+                                       buffer_p);
+        if (status != UCS_OK) {
+            ucs_free(buffer);
+        }
+    }
+
 out_free_devices:
     ucs_free(devices);
 out:
@@ -1615,6 +1720,284 @@ static ucp_rsc_index_t ucp_address_get_remote_device_index(
     return ucs_array_length(device_array) - 1;
 }
 
+/*
+ * Calculate the dictionary id of an address body, and copy the body without
+ * the device and interface addresses to 'dest', unless it is NULL.
+ */
+static uint64_t
+ucp_address_dict_id(const ucp_address_dict_layout_t *layout, void *dest)
+{
+    const void *segment = layout->body;
+    size_t dict_length  = 0;
+    uint32_t crc        = 0;
+    size_t segment_length;
+    unsigned i;
+
+    for (i = 0; i <= layout->num_segments; ++i) {
+        segment_length = UCS_PTR_BYTE_DIFF(segment,
+                                           (i < layout->num_segments) ?
+                                           layout->segments[i].addr :
+                                           layout->body_end);
+        crc            = ucs_crc32(crc, segment, segment_length);
+        if (dest != NULL) {
+            memcpy(UCS_PTR_BYTE_OFFSET(dest, dict_length), segment,
+                   segment_length);
+        }
+
+        dict_length += segment_length;
+        if (i < layout->num_segments) {
+            segment = UCS_PTR_BYTE_OFFSET(layout->segments[i].addr,
+                                          layout->segments[i].length);
+        }
+    }
+
+    return (dict_length << 32) | crc;
+}
+
+static size_t ucp_address_dict_length(uint64_t dict_id)
+{
+    return dict_id >> 32;
+}
+
+/* Check whether the address body without the device and interface addresses
+ * is the same as the one stored in the dictionary */
+static int ucp_address_dict_is_equal(const ucp_address_dict_t *dict,
+                                     const ucp_address_dict_layout_t *layout)
+{
+    const void *segment  = layout->body;
+    const void *dict_ptr = dict->contents;
+    size_t segment_length;
+    unsigned i;
+
+    for (i = 0; i <= layout->num_segments; ++i) {
+        segment_length = UCS_PTR_BYTE_DIFF(segment,
+                                           (i < layout->num_segments) ?
+                                           layout->segments[i].addr :
+                                           layout->body_end);
+        if (memcmp(dict_ptr, segment, segment_length)) {
+            return 0;
+        }
+
+        dict_ptr = UCS_PTR_BYTE_OFFSET(dict_ptr, segment_length);
+        if (i < layout->num_segments) {
+            segment = UCS_PTR_BYTE_OFFSET(layout->segments[i].addr,
+                                          layout->segments[i].length);
+        }
+    }
+
+    return 1;
+}
+
+static void
+ucp_address_dict_layout_init(ucp_address_dict_layout_t *layout,
+                             const void *body, const void *body_end,
+                             const ucp_unpacked_address_t *unpacked_address)
+{
+    const uct_device_addr_t *dev_addr = NULL;
+    const ucp_address_entry_t *ae;
+
+    layout->body         = body;
+    layout->body_end     = body_end;
+    layout->num_segments = 0;
+    ucp_unpacked_address_for_each(ae, unpacked_address) {
+        /* Entries of the same device share its address */
+        if (ae->dev_addr != dev_addr) {
+            dev_addr = ae->dev_addr;
+            ucp_address_dict_layout_add(layout, dev_addr, ae->dev_addr_len);
+        }
+
+        if (ae->iface_addr != NULL) {
+            ucp_address_dict_layout_add(layout, ae->iface_addr,
+                                        ae->iface_addr_len);
+        }
+    }
+}
+
+static int
+ucp_address_dict_is_supported(const ucp_unpacked_address_t *unpacked_address)
+{
+    const ucp_address_entry_t *ae;
+
+    if (unpacked_address->address_count == 0) {
+        return 0;
+    }
+
+    /* Endpoint addresses are specific to a connection */
+    ucp_unpacked_address_for_each(ae, unpacked_address) {
+        if (ae->num_ep_addrs > 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void
+ucp_address_dict_add(ucp_worker_h worker, uint64_t dict_id, const void *body,
+                     const void *body_end, unsigned unpack_flags,
+                     const ucp_unpacked_address_t *unpacked_address)
+{
+    size_t body_length = UCS_PTR_BYTE_DIFF(body, body_end);
+    size_t list_size   = unpacked_address->address_count *
+                         sizeof(*unpacked_address->address_list);
+    ucp_address_dict_layout_t layout;
+    ucp_address_dict_t *dict;
+    ucp_address_entry_t *ae;
+    void *dict_body, *contents;
+    khiter_t iter;
+    int ret;
+
+    if (!ucp_address_dict_is_supported(unpacked_address)) {
+        return;
+    }
+
+    ucp_address_dict_layout_init(&layout, body, body_end, unpacked_address);
+    if (ucp_address_dict_id(&layout, NULL) != dict_id) {
+        ucs_debug("address dictionary id 0x%" PRIx64 " does not match its"
+                  " contents", dict_id);
+        return;
+    }
+
+    iter = kh_get(ucp_worker_addr_dict_hash, &worker->addr_dict_hash,
+                  dict_id);
+    if (iter != kh_end(&worker->addr_dict_hash)) {
+        dict = kh_val(&worker->addr_dict_hash, iter);
+        if (!dict->ambiguous && !ucp_address_dict_is_equal(dict, &layout)) {
+            /* Compact addresses can't tell which of the dictionaries they
+             * refer to, so neither of them can be used */
+            ucs_debug("address dictionary id 0x%" PRIx64 " is used by"
+                      " different dictionaries", dict_id);
+            dict->ambiguous = 1;
+        }
+        return;
+    }
+
+    if (kh_size(&worker->addr_dict_hash) >= UCP_ADDRESS_DICT_MAX) {
+        ucs_debug("not adding address dictionary 0x%" PRIx64 ": reached the"
+                  " limit of %d dictionaries", dict_id, UCP_ADDRESS_DICT_MAX);
+        return;
+    }
+
+    dict = ucs_malloc(sizeof(*dict) + list_size + body_length +
+                      ucp_address_dict_length(dict_id), "ucp_address_dict");
+    if (dict == NULL) {
+        ucs_debug("failed to allocate address dictionary 0x%" PRIx64,
+                  dict_id);
+        return;
+    }
+
+    dict->id            = dict_id;
+    dict->ambiguous     = 0;
+    dict->address_count = unpacked_address->address_count;
+    dict->address_list  = UCS_PTR_TYPE_OFFSET(dict, *dict);
+    dict->addr_version  = unpacked_address->addr_version;
+    dict->dst_version   = unpacked_address->dst_version;
+    dict_body           = UCS_PTR_BYTE_OFFSET(dict->address_list, list_size);
+    contents            = UCS_PTR_BYTE_OFFSET(dict_body, body_length);
+    dict->contents      = contents;
+    memcpy(dict->address_list, unpacked_address->address_list, list_size);
+    memcpy(dict_body, body, body_length);
+    ucp_address_dict_id(&layout, contents);
+
+    /* Device and interface addresses are taken from each compact address.
+     * The template keeps the device address location in the body, to tell
+     * where the entries of a new device start. */
+    ucp_unpacked_address_for_each(ae, dict) {
+        if (ae->dev_addr != NULL) {
+            ae->dev_addr = UCS_PTR_BYTE_OFFSET(dict_body,
+                                               UCS_PTR_BYTE_DIFF(body,
+                                                                 ae->dev_addr));
+        }
+        ae->iface_addr = NULL;
+    }
+
+    iter = kh_put(ucp_worker_addr_dict_hash, &worker->addr_dict_hash, dict_id,
+                  &ret);
+    if (ret == UCS_KH_PUT_FAILED) {
+        ucs_free(dict);
+        return;
+    }
+
+    kh_val(&worker->addr_dict_hash, iter) = dict;
+    ucp_address_trace(unpack_flags,
+                      "added address dictionary 0x%" PRIx64 " with %u entries",
+                      dict_id, dict->address_count);
+}
+
+static ucs_status_t
+ucp_address_unpack_compact(ucp_worker_h worker, uint64_t dict_id,
+                           const void *ptr, unsigned unpack_flags,
+                           ucp_unpacked_address_t *unpacked_address)
+{
+    const uct_device_addr_t *dict_dev_addr = NULL;
+    const uct_device_addr_t *dev_addr      = NULL;
+    ucp_address_entry_t *address_list, *address;
+    const ucp_address_dict_t *dict;
+    khiter_t iter;
+
+    iter = kh_get(ucp_worker_addr_dict_hash, &worker->addr_dict_hash,
+                  dict_id);
+    if (iter == kh_end(&worker->addr_dict_hash)) {
+        ucp_address_error(unpack_flags,
+                          "failed to parse address: unknown dictionary 0x%"
+                          PRIx64, dict_id);
+        return UCS_ERR_NO_ELEM;
+    }
+
+    dict = kh_val(&worker->addr_dict_hash, iter);
+    if (dict->ambiguous) {
+        ucp_address_error(unpack_flags,
+                          "failed to parse address: dictionary 0x%" PRIx64
+                          " is ambiguous", dict_id);
+        return UCS_ERR_NO_ELEM;
+    }
+
+    address_list = ucs_malloc(dict->address_count * sizeof(*address_list),
+                              "ucp_address_list");
+    if (address_list == NULL) {
+        ucs_error("failed to allocate address list");
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    memcpy(address_list, dict->address_list,
+           dict->address_count * sizeof(*address_list));
+    for (address = address_list; address < address_list + dict->address_count;
+         ++address) {
+        /* The device address is packed before the first entry of the device */
+        if (address->dev_addr != dict_dev_addr) {
+            dict_dev_addr = address->dev_addr;
+            dev_addr      = (address->dev_addr_len > 0) ? ptr : NULL;
+            ptr           = UCS_PTR_BYTE_OFFSET(ptr, address->dev_addr_len);
+        }
+
+        address->dev_addr   = dev_addr;
+        address->iface_addr = (address->iface_addr_len > 0) ? ptr : NULL;
+        ptr                 = UCS_PTR_BYTE_OFFSET(ptr,
+                                                  address->iface_addr_len);
+    }
+
+    ucp_address_trace(unpack_flags,
+                      "unpacked compact address dictionary 0x%" PRIx64
+                      " entries %u", dict_id, dict->address_count);
+
+    unpacked_address->addr_version  = dict->addr_version;
+    unpacked_address->dst_version   = dict->dst_version;
+    unpacked_address->address_count = dict->address_count;
+    unpacked_address->address_list  = address_list;
+    return UCS_OK;
+}
+
+void ucp_address_dicts_cleanup(ucp_worker_h worker)
+{
+    ucp_address_dict_t *dict;
+
+    kh_foreach_value(&worker->addr_dict_hash, dict, {
+        ucs_free(dict);
+    })
+
+    kh_destroy_inplace(ucp_worker_addr_dict_hash, &worker->addr_dict_hash);
+}
+
 ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
                                 unsigned unpack_flags,
                                 ucp_unpacked_address_t *unpacked_address)
@@ -1639,6 +2022,8 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
     uint8_t flags;
     const void *ptr;
     const void *flags_ptr;
+    const void *body;
+    uint64_t dict_id;
 
     /* Initialize the unpacked address to empty */
     unpacked_address->address_count = 0;
@@ -1683,6 +2068,19 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
                          sizeof(unpacked_address->name));
     }
 
+    if (addr_flags & (UCP_ADDRESS_HEADER_FLAG_DICT |
+                      UCP_ADDRESS_HEADER_FLAG_COMPACT)) {
+        dict_id = *ucs_serialize_next(&ptr, const uint64_t);
+        if (addr_flags & UCP_ADDRESS_HEADER_FLAG_COMPACT) {
+            return ucp_address_unpack_compact(worker, dict_id, ptr,
+                                              unpack_flags, unpacked_address);
+        }
+    } else {
+        dict_id = 0;
+    }
+
+    body = ptr;
+
     /* Empty address list */
     if (*(uint8_t*)ptr == UCP_NULL_RESOURCE) {
         return UCS_OK;
@@ -1774,8 +2172,9 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
             ptr       = ucp_address_unpack_tl_length(
                                           worker, flags_ptr, ptr, addr_version,
                                           &iface_addr_len, 0, &last_tl);
-            address->iface_addr   = (iface_addr_len > 0) ? ptr : NULL;
-            address->num_ep_addrs = 0;
+            address->iface_addr     = (iface_addr_len > 0) ? ptr : NULL;
+            address->iface_addr_len = iface_addr_len;
+            address->num_ep_addrs   = 0;
             ptr                   = UCS_PTR_BYTE_OFFSET(ptr, iface_addr_len);
             last_ep_addr          = !(*(uint8_t*)flags_ptr &
                                       UCP_ADDRESS_FLAG_HAS_EP_ADDR);
@@ -1839,9 +2238,80 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
     unpacked_address->dst_version   = dst_version;
     unpacked_address->address_count = address - address_list;
     unpacked_address->address_list  = address_list;
+
+    if (addr_flags & UCP_ADDRESS_HEADER_FLAG_DICT) {
+        ucp_address_dict_add(worker, dict_id, body, ptr, unpack_flags,
+                             unpacked_address);
+    }
+
     return UCS_OK;
 
 err_free:
     ucs_free(address_list);
     return UCS_ERR_INVALID_PARAM;
 }
+
+/* Convert a full address to a dictionary or compact address */
+static ucs_status_t
+ucp_address_pack_dict(ucp_worker_h worker, unsigned pack_flags,
+                      const ucp_address_dict_layout_t *layout, size_t *size_p,
+                      void **buffer_p)
+{
+    void *buffer = *buffer_p;
+    ucp_object_version_t addr_version;
+    unsigned dst_version;
+    uint8_t addr_flags;
+    size_t prefix_size, size;
+    void *new_buffer, *ptr;
+    uint64_t dict_id;
+    unsigned i;
+
+    dict_id     = ucp_address_dict_id(layout, NULL);
+    prefix_size = UCS_PTR_BYTE_DIFF(buffer, layout->body);
+    size        = prefix_size + sizeof(dict_id);
+    if (pack_flags & UCP_ADDRESS_PACK_FLAG_COMPACT) {
+        for (i = 0; i < layout->num_segments; ++i) {
+            size += layout->segments[i].length;
+        }
+    } else {
+        size += UCS_PTR_BYTE_DIFF(layout->body, layout->body_end);
+    }
+
+    new_buffer = ucs_malloc(size, "ucp_address");
+    if (new_buffer == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    ucp_address_unpack_header(buffer, &addr_version, &addr_flags,
+                              &dst_version);
+    addr_flags |= (pack_flags & UCP_ADDRESS_PACK_FLAG_COMPACT) ?
+                  UCP_ADDRESS_HEADER_FLAG_COMPACT :
+                  UCP_ADDRESS_HEADER_FLAG_DICT;
+
+    memcpy(new_buffer, buffer, prefix_size);
+    ucp_address_pack_header_flags(new_buffer, addr_version, addr_flags);
+    ptr                                 = UCS_PTR_BYTE_OFFSET(new_buffer,
+                                                              prefix_size);
+    *ucs_serialize_next(&ptr, uint64_t) = dict_id;
+
+    if (pack_flags & UCP_ADDRESS_PACK_FLAG_COMPACT) {
+        for (i = 0; i < layout->num_segments; ++i) {
+            memcpy(ucs_serialize_next_raw(&ptr, void,
+                                          layout->segments[i].length),
+                   layout->segments[i].addr, layout->segments[i].length);
+        }
+    } else {
+        memcpy(ptr, layout->body,
+               UCS_PTR_BYTE_DIFF(layout->body, layout->body_end));
+    }
+
+    ucs_trace("worker %p: packed %s address dictionary 0x%" PRIx64
+              " length %zu (full %zu)", worker,
+              (pack_flags & UCP_ADDRESS_PACK_FLAG_COMPACT) ? "compact" : "full",
+              dict_id, size, *size_p);
+
+    ucs_free(buffer);
+    *buffer_p = new_buffer;
+    *size_p   = size;
+    return UCS_OK;
+}
@@ -100,7 +100,16 @@ enum {
                                         UCP_ADDRESS_PACK_FLAG_EP_ADDR,
 
     /* Suppress debug tracing */
-    UCP_ADDRESS_PACK_FLAG_NO_TRACE    = UCS_BIT(16)
+    UCP_ADDRESS_PACK_FLAG_NO_TRACE    = UCS_BIT(16),
+
+    /* Publish the address body as a dictionary which can be referenced by
+     * compact addresses of workers with the same kind of resources
+     * (address v2) */
+    UCP_ADDRESS_PACK_FLAG_DICT        = UCS_BIT(17),
+
+    /* Pack only a dictionary reference and the device and interface addresses
+     * (address v2) */
+    UCP_ADDRESS_PACK_FLAG_COMPACT     = UCS_BIT(18)
 };
 
 
@@ -145,6 +154,7 @@ struct ucp_address_entry {
     const uct_device_addr_t     *dev_addr;      /* Points to device address */
     size_t                      dev_addr_len;   /* Device address length */
     const uct_iface_addr_t      *iface_addr;    /* Interface address, NULL if not available */
+    size_t                      iface_addr_len; /* Interface address length */
     unsigned                    num_ep_addrs;   /* How many endpoint address are in ep_addrs */
     ucp_address_entry_ep_addr_t ep_addrs[UCP_MAX_LANES]; /* Endpoint addresses */
     ucp_address_iface_attr_t    iface_attr;     /* Interface attributes information */
@@ -170,6 +180,27 @@ struct ucp_unpacked_address {
 };
 
 
+/**
+ * Address dictionary: the device and interface description of a remote
+ * worker, learned from a dictionary address. Compact addresses which refer to
+ * it carry only the device and interface addresses.
+ */
+struct ucp_address_dict {
+    uint64_t                    id;             /* Dictionary id */
+    int                         ambiguous;      /* Whether different
+                                                   dictionaries have this id */
+    unsigned                    address_count;  /* Length of address list */
+    ucp_address_entry_t         *address_list;  /* Template address list,
+                                                   points to body */
+    const void                  *contents;      /* Address body without the
+                                                   device and interface
+                                                   addresses */
+    ucp_object_version_t        addr_version;   /* Peer address version */
+    unsigned                    dst_version;    /* Peer release version */
+    /* Followed by address list, a copy of the address body and contents */
+};
+
+
 /* Iterate over entries in an unpacked address */
 #define ucp_unpacked_address_for_each(_elem, _unpacked_address) \
     for (_elem = (_unpacked_address)->address_list; \
@@ -285,6 +316,14 @@ uint64_t ucp_address_get_client_id(const void *address);
 uint8_t ucp_address_is_am_only(const void *address);
 
 
+/**
+ * Release all address dictionaries learned by the worker.
+ *
+ * @param [in] worker Worker object.
+ */
+void ucp_address_dicts_cleanup(ucp_worker_h worker);
+
+
 /**
  * Returns maximal AM fragment size which can be received by the iface.
  *
@@ -683,6 +683,22 @@ ucp_wireup_tl_iface_latency(const ucp_worker_iface_t *wiface,
     }
 }
 
+static int
+ucp_wireup_has_lane_type(const ucp_wireup_select_context_t *select_ctx,
+                         ucp_lane_type_t lane_type)
+{
+    const ucp_wireup_lane_desc_t *lane_desc;
+
+    ucs_carray_for_each(lane_desc, select_ctx->lane_descs,
+                        select_ctx->num_lanes) {
+        if (lane_desc->lane_types & UCS_BIT(lane_type)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 static int ucp_wireup_has_slow_lanes(ucp_wireup_select_context_t *select_ctx)
 {
     ucp_wireup_lane_desc_t *lane_desc;
@@ -1789,7 +1805,8 @@ ucp_wireup_add_rma_bw_lanes(const ucp_wireup_select_params_t *select_params,
     if (ep_init_flags & UCP_EP_INIT_FLAG_MEM_TYPE) {
         md_reg_flag = 0;
     } else if (ucp_ep_get_context_features(ep) &
-               (UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_RMA)) {
+               (UCP_FEATURE_TAG | UCP_FEATURE_AM | UCP_FEATURE_STREAM |
+                UCP_FEATURE_RMA)) {
         /* if needed for RNDV, need only access for remote registered memory */
         md_reg_flag = UCT_MD_FLAG_REG;
     } else {
@@ -1831,6 +1848,25 @@ ucp_wireup_add_rma_bw_lanes(const ucp_wireup_select_params_t *select_params,
                                 tl_bitmap);
         ucp_wireup_add_bw_lanes(select_params, &bw_info, tl_bitmap,
                                 UCP_NULL_LANE, select_ctx);
+
+        /* If no transport can map arbitrary registered memory, fall back to
+         * a transport which can map memory allocated by its own memory
+         * domain (e.g posix or sysv). Buffers allocated by ucp_mem_map() with
+         * such memory domain can then be accessed by the peer directly.
+         * The lane is useful only when the shared memory heap is enabled,
+         * otherwise most buffers are not allocated by such memory domain.
+         */
+        if ((context->config.ext.shm_heap_max_alloc > 0) &&
+            !ucp_wireup_has_lane_type(select_ctx, UCP_LANE_TYPE_RKEY_PTR)) {
+            bw_info.criteria.title           = "obtain allocated remote "
+                                               "memory pointer";
+            bw_info.criteria.local_md_flags  = UCT_MD_FLAG_ALLOC;
+            bw_info.criteria.alloc_mem_types = UCS_BIT(UCS_MEMORY_TYPE_HOST);
+            ucp_wireup_add_bw_lanes(select_params, &bw_info, tl_bitmap,
+                                    UCP_NULL_LANE, select_ctx);
+            bw_info.criteria.local_md_flags  = md_reg_flag;
+            bw_info.criteria.alloc_mem_types = 0;
+        }
     }
 
     bw_info.criteria.title            = "high-bw remote memory access";
@@ -2377,7 +2413,11 @@ ucp_wireup_construct_lanes(const ucp_wireup_select_params_t *select_params,
     if (key->rkey_ptr_lane != UCP_NULL_LANE) {
         rsc_index            = select_ctx->lane_descs[key->rkey_ptr_lane].rsc_index;
         md_index             = context->tl_rscs[rsc_index].md_index;
-        key->rma_bw_md_map  |= UCS_BIT(md_index);
+        /* Memory domain which can expose only its own allocations does not
+         * take part in send buffer registration */
+        if (context->tl_mds[md_index].attr.flags & UCT_MD_FLAG_REG) {
+            key->rma_bw_md_map |= UCS_BIT(md_index);
+        }
     }
 
     for (i = 0; key->rma_lanes[i] != UCP_NULL_LANE; i++) {
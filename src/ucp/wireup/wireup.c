@@ -13,6 +13,7 @@
 #include "wireup_cm.h"
 #include "wireup_ep.h"
 
+#include <ucs/algorithm/crc.h>
 #include <ucs/async/async.h>
 #include <ucs/datastruct/queue.h>
 #include <ucp/core/ucp_ep.h>
@@ -21,6 +22,7 @@
 #include <ucp/core/ucp_worker.h>
 #include <ucp/proto/proto_common.h>
 #include <ucs/sys/iovec.h>
+#include <ucs/type/serialize.h>
 #include <ucp/tag/eager.h>
 
 #include <ucp/core/ucp_request.inl>
@@ -485,7 +487,8 @@ unsigned ucp_wireup_eps_progress(void *arg)
     ucp_wireup_eps_pending_extract(ucp_ep, &tmp_pending_queue);
     for (lane = 0; lane < ucp_ep_num_lanes(ucp_ep); ++lane) {
         wireup_ep = ucp_wireup_ep(ucp_ep_get_lane(ucp_ep, lane));
-        if (wireup_ep == NULL) {
+        if ((wireup_ep == NULL) ||
+            (wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND)) {
             continue;
         }
 
@@ -516,7 +519,8 @@ void ucp_wireup_update_flags(ucp_ep_h ucp_ep, uint32_t new_flags)
 
     for (lane = 0; lane < ucp_ep_num_lanes(ucp_ep); ++lane) {
         wireup_ep = ucp_wireup_ep(ucp_ep_get_lane(ucp_ep, lane));
-        if (wireup_ep == NULL) {
+        if ((wireup_ep == NULL) ||
+            (wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND)) {
             continue;
         }
 
@@ -1155,6 +1159,115 @@ ucp_wireup_connect_lane_to_ep(ucp_ep_h ep, unsigned ep_init_flags,
     return UCS_OK;
 }
 
+static int ucp_wireup_lane_is_on_demand(ucp_ep_h ep, unsigned ep_init_flags,
+                                        ucp_lane_index_t lane)
+{
+    const ucp_ep_config_key_t *key = &ucp_ep_config(ep)->key;
+
+    /* Lanes which the endpoint uses for its own messages (AM, wireup,
+     * keepalive) and tag offload lanes, which must be ready to receive, are
+     * connected right away */
+    return ep->worker->context->config.ext.on_demand_lanes &&
+           !(ep_init_flags & (UCP_EP_INIT_FLAG_MEM_TYPE |
+                              UCP_EP_INIT_FLAG_INTERNAL)) &&
+           !ucp_ep_init_flags_has_cm(ep_init_flags) &&
+           !ucp_ep_has_cm_lane(ep) && (ucp_ep_get_lane(ep, lane) == NULL) &&
+           (lane != key->am_lane) && (lane != key->wireup_msg_lane) &&
+           (lane != key->keepalive_lane) && (lane != key->tag_lane);
+}
+
+static ucs_status_t
+ucp_wireup_connect_lane_on_demand(ucp_ep_h ep, ucp_lane_index_t lane,
+                                  unsigned path_index,
+                                  const ucp_address_entry_t *address)
+{
+    ucs_status_t status;
+    uct_ep_h uct_ep;
+
+    status = ucp_wireup_ep_create_on_demand(ep, address, path_index, &uct_ep);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    ucs_trace("ep %p: assign uct_ep[%d]=%p on demand", ep, lane, uct_ep);
+    ucp_ep_set_lane(ep, lane, uct_ep);
+    return UCS_OK;
+}
+
+void ucp_wireup_on_demand_sched(ucp_wireup_ep_t *wireup_ep)
+{
+    ucp_worker_h worker = wireup_ep->super.ucp_ep->worker;
+
+    ucs_callbackq_add_oneshot(&worker->uct->progress_q, wireup_ep,
+                              ucp_wireup_on_demand_progress, wireup_ep);
+    ucp_worker_signal_internal(worker);
+}
+
+unsigned ucp_wireup_on_demand_progress(void *arg)
+{
+    ucp_wireup_ep_t *wireup_ep              = arg;
+    ucp_ep_h ep                             = wireup_ep->super.ucp_ep;
+    ucp_worker_h worker                     = ep->worker;
+    const ucp_wireup_ep_remote_addr_t *addr = wireup_ep->remote_addr;
+    ucs_queue_head_t pending_queue;
+    uct_ep_params_t uct_ep_params;
+    ucp_worker_iface_t *wiface;
+    ucp_rsc_index_t rsc_index;
+    ucp_lane_index_t lane;
+    ucs_status_t status;
+    uct_ep_h uct_ep;
+
+    UCS_ASYNC_BLOCK(&worker->async);
+
+    wireup_ep->flags &= ~UCP_WIREUP_EP_FLAG_CONNECT_SCHED;
+    if (ep->flags & UCP_EP_FLAG_FAILED) {
+        /* Pending requests are purged by the error flow */
+        goto out;
+    }
+
+    for (lane = 0; lane < ucp_ep_num_lanes(ep); ++lane) {
+        if (ucp_ep_get_lane(ep, lane) == &wireup_ep->super.super) {
+            break;
+        }
+    }
+
+    ucs_assert(lane < ucp_ep_num_lanes(ep));
+    rsc_index = ucp_ep_get_rsc_index(ep, lane);
+    wiface    = ucp_worker_iface(worker, rsc_index);
+
+    ucs_trace("ep %p: connect lane[%d] on demand", ep, lane);
+    uct_ep_params.field_mask = UCT_EP_PARAM_FIELD_IFACE      |
+                               UCT_EP_PARAM_FIELD_DEV_ADDR   |
+                               UCT_EP_PARAM_FIELD_IFACE_ADDR |
+                               UCT_EP_PARAM_FIELD_PATH_INDEX;
+    uct_ep_params.iface      = wiface->iface;
+    uct_ep_params.dev_addr   = addr->dev_addr;
+    uct_ep_params.iface_addr = addr->iface_addr;
+    uct_ep_params.path_index = addr->path_index;
+    status = uct_ep_create(&uct_ep_params, &uct_ep);
+    if (status != UCS_OK) {
+        ucp_ep_set_failed_schedule(ep, lane, status);
+        goto out;
+    }
+
+    if (ucp_wireup_should_activate_wiface(wiface, ep, lane)) {
+        ucp_worker_iface_progress_ep(wiface);
+    }
+
+    /* Replace the proxy by the transport endpoint and resend the operations
+     * which were waiting for the connection */
+    ucs_queue_head_init(&pending_queue);
+    ucp_worker_flush_ops_count_add(
+            worker, -ucp_wireup_ep_pending_extract(wireup_ep, &pending_queue));
+    ucp_wireup_ep_set_next_ep(&wireup_ep->super.super, uct_ep, rsc_index);
+    ucp_proxy_ep_replace(&wireup_ep->super);
+    ucp_wireup_replay_pending_requests(ep, &pending_queue);
+
+out:
+    UCS_ASYNC_UNBLOCK(&worker->async);
+    return 1;
+}
+
 static ucs_status_t
 ucp_wireup_connect_lane(ucp_ep_h ep, unsigned ep_init_flags,
                         ucp_lane_index_t lane, unsigned path_index,
@@ -1187,6 +1300,11 @@ ucp_wireup_connect_lane(ucp_ep_h ep, unsigned ep_init_flags,
                                              remote_address);
     } else if (ucp_worker_is_tl_2iface(worker, rsc_index)) {
         address = &remote_address->address_list[addr_index];
+        if (ucp_wireup_lane_is_on_demand(ep, ep_init_flags, lane)) {
+            return ucp_wireup_connect_lane_on_demand(ep, lane, path_index,
+                                                     address);
+        }
+
         return ucp_wireup_connect_lane_to_iface(ep, lane, path_index, wiface,
                                                 address);
     } else {
@@ -1512,6 +1630,264 @@ ucp_wireup_check_config_intersect(ucp_ep_h ep, ucp_ep_config_key_t *new_key,
     return UCS_OK;
 }
 
+/* Maximal number of lane selection results cached on a worker */
+#define UCP_WIREUP_LANE_CACHE_MAX 1024
+
+
+/* Maximal size of a remote address shape which can be cached. The shape is
+ * built on the stack, so larger addresses always go through lane selection. */
+#define UCP_WIREUP_LANE_CACHE_SHAPE_MAX 4096
+
+
+/* Common part of the remote address shape */
+typedef struct {
+    uint32_t                    ep_init_flags;
+    uint32_t                    dst_version;
+    uint32_t                    address_count;
+    uint8_t                     addr_version;
+    uint8_t                     is_self;
+    uint8_t                     local_connected;
+    ucp_tl_bitmap_t             tl_bitmap;
+} UCS_S_PACKED ucp_wireup_lane_cache_hdr_t;
+
+
+/* Shape of a single remote address entry */
+typedef struct {
+    uint64_t                    flags;
+    double                      overhead;
+    double                      bandwidth;
+    double                      lat_ovh;
+    int32_t                     priority;
+    uint64_t                    seg_size;
+    ucp_tl_iface_atomic_flags_t atomic;
+    uint32_t                    dev_num_paths;
+    uint32_t                    num_ep_addrs;
+    uint32_t                    dev_addr_len;
+    uint16_t                    tl_name_csum;
+    ucp_md_index_t              md_index;
+    ucs_sys_device_t            sys_dev;
+    ucp_rsc_index_t             dev_index;
+    ucp_rsc_index_t             dst_rsc_index;
+    uint8_t                     has_iface_addr;
+    ucp_tl_bitmap_t             reachable; /* local resources which can reach
+                                              the entry */
+} UCS_S_PACKED ucp_wireup_lane_cache_ae_t;
+
+
+/* Lane selection result for a remote address shape */
+struct ucp_wireup_lane_cache_entry {
+    ucp_worker_cfg_index_t      cfg_index;
+    unsigned                    addr_indices[UCP_MAX_LANES];
+    uint64_t                    hash;
+    size_t                      shape_length;
+    uint8_t                     shape[];
+};
+
+
+/* Remote address shape, used as a lookup key */
+typedef struct {
+    void                        *shape;
+    size_t                      length;
+    uint64_t                    hash;
+} ucp_wireup_lane_cache_key_t;
+
+
+/*
+ * Size of the remote address shape, or 0 if it should not be cached.
+ */
+static size_t
+ucp_wireup_lane_cache_key_length(ucp_ep_h ep,
+                                 const ucp_unpacked_address_t *remote_address)
+{
+    size_t length;
+
+    if (ep->cfg_index != UCP_WORKER_CFG_INDEX_NULL) {
+        return 0;
+    }
+
+    length = sizeof(ucp_wireup_lane_cache_hdr_t) +
+             (remote_address->address_count *
+              sizeof(ucp_wireup_lane_cache_ae_t));
+    return (length <= UCP_WIREUP_LANE_CACHE_SHAPE_MAX) ? length : 0;
+}
+
+/*
+ * Build the part of the remote address which determines the lane selection:
+ * the transports and devices of the peer, and which local resources can reach
+ * them. Device, interface and endpoint addresses are unique to every peer, so
+ * they are replaced by the reachability result. Peers which have the same
+ * shape get the same lanes, so the selection result can be reused.
+ *
+ * The shape is built to the buffer passed by the caller, of the size returned
+ * by @ref ucp_wireup_lane_cache_key_length, or NULL if it is 0.
+ */
+static void
+ucp_wireup_lane_cache_key_init(ucp_ep_h ep, unsigned ep_init_flags,
+                               const ucp_tl_bitmap_t *tl_bitmap,
+                               const ucp_unpacked_address_t *remote_address,
+                               void *shape, size_t length,
+                               ucp_wireup_lane_cache_key_t *cache_key)
+{
+    ucp_context_h context = ep->worker->context;
+    ucp_wireup_lane_cache_hdr_t *hdr;
+    ucp_wireup_lane_cache_ae_t *cae;
+    const ucp_address_entry_t *ae;
+    ucp_rsc_index_t rsc_index;
+    void *ptr;
+
+    cache_key->shape = shape;
+    if (shape == NULL) {
+        return;
+    }
+
+    memset(shape, 0, length);
+    cache_key->length = length;
+    ptr               = shape;
+
+    hdr                  = ucs_serialize_next(&ptr,
+                                              ucp_wireup_lane_cache_hdr_t);
+    hdr->ep_init_flags   = ep_init_flags;
+    hdr->dst_version     = remote_address->dst_version;
+    hdr->address_count   = remote_address->address_count;
+    hdr->addr_version    = remote_address->addr_version;
+    hdr->is_self         = remote_address->uuid == ep->worker->uuid;
+    hdr->local_connected = !!(ep->flags & UCP_EP_FLAG_LOCAL_CONNECTED);
+    hdr->tl_bitmap       = *tl_bitmap;
+
+    ucp_unpacked_address_for_each(ae, remote_address) {
+        cae                 = ucs_serialize_next(&ptr,
+                                                 ucp_wireup_lane_cache_ae_t);
+        cae->flags          = ae->iface_attr.flags;
+        cae->overhead       = ae->iface_attr.overhead;
+        cae->bandwidth      = ae->iface_attr.bandwidth;
+        cae->lat_ovh        = ae->iface_attr.lat_ovh;
+        cae->priority       = ae->iface_attr.priority;
+        cae->seg_size       = ae->iface_attr.seg_size;
+        cae->atomic         = ae->iface_attr.atomic;
+        cae->dev_num_paths  = ae->dev_num_paths;
+        cae->num_ep_addrs   = ae->num_ep_addrs;
+        cae->dev_addr_len   = ae->dev_addr_len;
+        cae->tl_name_csum   = ae->tl_name_csum;
+        cae->md_index       = ae->md_index;
+        cae->sys_dev        = ae->sys_dev;
+        cae->dev_index      = ae->dev_index;
+        cae->dst_rsc_index  = ae->iface_attr.dst_rsc_index;
+        cae->has_iface_addr = ae->iface_addr != NULL;
+        UCS_BITMAP_FOR_EACH_BIT(context->tl_bitmap, rsc_index) {
+            if (ucp_wireup_is_reachable(ep, ep_init_flags, rsc_index, ae)) {
+                UCS_BITMAP_SET(cae->reachable, rsc_index);
+            }
+        }
+    }
+
+    ucs_assert(UCS_PTR_BYTE_DIFF(shape, ptr) == length);
+    cache_key->hash = ((uint64_t)length << 32) | ucs_crc32(0, shape, length);
+}
+
+/* Find the cached lane selection result for the remote address shape */
+static const ucp_wireup_lane_cache_entry_t *
+ucp_wireup_lane_cache_lookup(ucp_ep_h ep,
+                             const ucp_wireup_lane_cache_key_t *cache_key)
+{
+    ucp_worker_h worker = ep->worker;
+    ucp_wireup_lane_cache_entry_t *entry;
+    khiter_t iter;
+
+    if (cache_key->shape == NULL) {
+        return NULL;
+    }
+
+    iter = kh_get(ucp_worker_lane_cache_hash, &worker->lane_cache_hash,
+                  cache_key->hash);
+    if (iter == kh_end(&worker->lane_cache_hash)) {
+        return NULL;
+    }
+
+    entry = kh_val(&worker->lane_cache_hash, iter);
+    if ((entry->shape_length != cache_key->length) ||
+        memcmp(entry->shape, cache_key->shape, cache_key->length)) {
+        return NULL;
+    }
+
+    ucs_lru_push(worker->lane_cache_lru, entry);
+    return entry;
+}
+
+static void ucp_wireup_lane_cache_remove(ucp_worker_h worker,
+                                         ucp_wireup_lane_cache_entry_t *entry)
+{
+    khiter_t iter;
+
+    iter = kh_get(ucp_worker_lane_cache_hash, &worker->lane_cache_hash,
+                  entry->hash);
+    ucs_assert(iter != kh_end(&worker->lane_cache_hash));
+    kh_del(ucp_worker_lane_cache_hash, &worker->lane_cache_hash, iter);
+    ucs_lru_remove(worker->lane_cache_lru, entry);
+    ucs_free(entry);
+}
+
+static void
+ucp_wireup_lane_cache_insert(ucp_worker_h worker,
+                             ucp_wireup_lane_cache_key_t *cache_key,
+                             const unsigned *addr_indices,
+                             ucp_worker_cfg_index_t cfg_index)
+{
+    ucp_wireup_lane_cache_entry_t *entry;
+    khiter_t iter;
+    int ret;
+
+    if (cache_key->shape == NULL) {
+        return;
+    }
+
+    if (kh_size(&worker->lane_cache_hash) >=
+        worker->lane_cache_lru->capacity) {
+        /* Evict the least recently used shape */
+        ucp_wireup_lane_cache_remove(worker,
+                                     ucs_lru_tail(worker->lane_cache_lru));
+    }
+
+    entry = ucs_malloc(sizeof(*entry) + cache_key->length,
+                       "ucp_wireup_lane_cache_entry");
+    if (entry == NULL) {
+        return;
+    }
+
+    iter = kh_put(ucp_worker_lane_cache_hash, &worker->lane_cache_hash,
+                  cache_key->hash, &ret);
+    if (ret != UCS_KH_PUT_BUCKET_EMPTY) {
+        /* Hash collision, or insertion failure */
+        ucs_free(entry);
+        return;
+    }
+
+    entry->cfg_index    = cfg_index;
+    entry->hash         = cache_key->hash;
+    entry->shape_length = cache_key->length;
+    memcpy(entry->addr_indices, addr_indices, sizeof(entry->addr_indices));
+    memcpy(entry->shape, cache_key->shape, cache_key->length);
+    kh_val(&worker->lane_cache_hash, iter) = entry;
+    ucs_lru_push(worker->lane_cache_lru, entry);
+}
+
+ucs_status_t ucp_wireup_lane_cache_init(ucp_worker_h worker)
+{
+    kh_init_inplace(ucp_worker_lane_cache_hash, &worker->lane_cache_hash);
+    return ucs_lru_create(UCP_WIREUP_LANE_CACHE_MAX, &worker->lane_cache_lru);
+}
+
+void ucp_wireup_lane_cache_cleanup(ucp_worker_h worker)
+{
+    ucp_wireup_lane_cache_entry_t *entry;
+
+    kh_foreach_value(&worker->lane_cache_hash, entry, {
+        ucs_free(entry);
+    });
+
+    kh_destroy_inplace(ucp_worker_lane_cache_hash, &worker->lane_cache_hash);
+    ucs_lru_destroy(worker->lane_cache_lru);
+}
+
 ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
                                    const ucp_tl_bitmap_t *local_tl_bitmap,
                                    const ucp_unpacked_address_t *remote_address,
@@ -1522,12 +1898,15 @@ ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
                                                           worker->context->tl_bitmap,
                                                           UCP_MAX_RESOURCES);
     ucp_rsc_index_t cm_idx               = UCP_NULL_RESOURCE;
+    const ucp_wireup_lane_cache_entry_t *cache_entry;
+    ucp_wireup_lane_cache_key_t cache_key;
+    size_t cache_key_length;
     ucp_tl_bitmap_t current_tl_bitmap;
     ucp_rsc_index_t rsc_idx;
     ucp_lane_map_t connect_lane_bitmap;
     ucp_ep_config_key_t key;
     ucp_worker_cfg_index_t new_cfg_index;
-    ucp_lane_index_t lane;
+    ucp_lane_index_t lane, num_lanes;
     ucs_status_t status;
     char str[32];
     ucs_queue_head_t replay_pending_queue;
@@ -1563,6 +1942,32 @@ ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
         UCS_BITMAP_AND_INPLACE(&tl_bitmap, current_tl_bitmap);
     }
 
+    /* Peers with the same address shape get the same lanes, so skip the
+     * selection and reuse the configuration found for a previous peer */
+    cache_key_length = ucp_wireup_lane_cache_key_length(ep, remote_address);
+    ucp_wireup_lane_cache_key_init(ep, ep_init_flags, &tl_bitmap,
+                                   remote_address,
+                                   (cache_key_length > 0) ?
+                                   ucs_alloca(cache_key_length) : NULL,
+                                   cache_key_length, &cache_key);
+    cache_entry = ucp_wireup_lane_cache_lookup(ep, &cache_key);
+    if (cache_entry != NULL) {
+        ucs_trace("ep %p: reusing cached lane selection of cfg_index %d", ep,
+                  cache_entry->cfg_index);
+        new_cfg_index = cache_entry->cfg_index;
+        num_lanes     = ucs_array_elem(&worker->ep_config,
+                                       new_cfg_index).key.num_lanes;
+        memcpy(addr_indices, cache_entry->addr_indices,
+               sizeof(cache_entry->addr_indices));
+        status = ucp_ep_realloc_lanes(ep, num_lanes);
+        if (status != UCS_OK) {
+            goto out;
+        }
+
+        connect_lane_bitmap = UCS_MASK(num_lanes);
+        goto set_config;
+    }
+
     status = ucp_wireup_select_lanes(ep, ep_init_flags, tl_bitmap,
                                      remote_address, addr_indices, &key, 1);
     if (status != UCS_OK) {
@@ -1586,6 +1991,10 @@ ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
         goto out;
     }
 
+    ucp_wireup_lane_cache_insert(worker, &cache_key, addr_indices,
+                                 new_cfg_index);
+
+set_config:
     if (ep->cfg_index == new_cfg_index) {
 #if UCS_ENABLE_ASSERT
         for (lane = 0; lane < ucp_ep_num_lanes(ep); ++lane) {
@@ -1621,7 +2030,7 @@ ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
     }
 
     ep->cfg_index = new_cfg_index;
-    ep->am_lane   = key.am_lane;
+    ep->am_lane   = ucp_ep_config(ep)->key.am_lane;
 
     snprintf(str, sizeof(str), "ep %p", ep);
     ucp_wireup_print_config(worker, &ucp_ep_config(ep)->key, str,
@@ -1634,9 +2043,10 @@ ucs_status_t ucp_wireup_init_lanes(ucp_ep_h ep, unsigned ep_init_flags,
         }
 
         if (connect_lane_bitmap & UCS_BIT(lane)) {
-            status = ucp_wireup_connect_lane(ep, ep_init_flags, lane,
-                                             key.lanes[lane].path_index,
-                                             remote_address, addr_indices[lane]);
+            status = ucp_wireup_connect_lane(
+                    ep, ep_init_flags, lane,
+                    ucp_ep_config(ep)->key.lanes[lane].path_index,
+                    remote_address, addr_indices[lane]);
             if (status != UCS_OK) {
                 goto out;
             }
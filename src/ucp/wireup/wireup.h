@@ -216,6 +216,14 @@ uct_ep_h ucp_wireup_extract_lane(ucp_ep_h ep, ucp_lane_index_t lane);
 
 unsigned ucp_wireup_eps_progress(void *arg);
 
+void ucp_wireup_on_demand_sched(ucp_wireup_ep_t *wireup_ep);
+
+unsigned ucp_wireup_on_demand_progress(void *arg);
+
+ucs_status_t ucp_wireup_lane_cache_init(ucp_worker_h worker);
+
+void ucp_wireup_lane_cache_cleanup(ucp_worker_h worker);
+
 double ucp_wireup_iface_lat_distance_v1(const ucp_worker_iface_t *wiface);
 
 double ucp_wireup_iface_lat_distance_v2(const ucp_worker_iface_t *wiface);
@@ -18,6 +18,10 @@
 #include <ucs/sys/string.h>
 
 
+/* Maximal number of connection requests handled in one progress call */
+#define UCP_CM_SERVER_CONN_REQ_BATCH 64
+
+
 /**
  * @brief Check whether CM callback should be called or not.
  *
@@ -1060,23 +1064,65 @@ ucs_status_t ucp_ep_client_cm_connect_start(ucp_ep_h ucp_ep,
 
 static unsigned ucp_cm_server_conn_request_progress(void *arg)
 {
-    ucp_conn_request_h               conn_request = arg;
-    ucp_listener_h                   listener     = conn_request->listener;
-    ucp_worker_h                     worker       = listener->worker;
-    ucp_ep_h                         ep;
+    ucp_listener_h listener = arg;
+    ucp_worker_h worker     = listener->worker;
+    unsigned count          = 0;
+    int destroyed           = 0;
+    ucp_conn_request_h conn_request;
+    ucp_ep_h ep;
 
-    ucs_trace_func("listener %p, connect request %p", listener, conn_request);
+    ucs_trace_func("listener %p", listener);
 
-    if (listener->conn_cb) {
-        listener->conn_cb(conn_request, listener->arg);
-        return 1;
+    /* Handle a batch of the pending connection requests in one progress call,
+     * so a burst of incoming connections does not need a callback per
+     * request. The user's handlers may destroy the listener, which is
+     * reported by the 'destroyed' flag. */
+    ucs_assert(listener->destroyed_p == NULL);
+    listener->destroyed_p = &destroyed;
+
+    while (count < UCP_CM_SERVER_CONN_REQ_BATCH) {
+        UCS_ASYNC_BLOCK(&worker->async);
+        if (ucs_queue_is_empty(&listener->conn_req_q)) {
+            UCS_ASYNC_UNBLOCK(&worker->async);
+            break;
+        }
+
+        conn_request = ucs_queue_pull_elem_non_empty(&listener->conn_req_q,
+                                                     ucp_conn_request_t,
+                                                     queue);
+        UCS_ASYNC_UNBLOCK(&worker->async);
+
+        ucs_trace("listener %p: handling connect request %p", listener,
+                  conn_request);
+        ++count;
+
+        if (listener->conn_cb) {
+            listener->conn_cb(conn_request, listener->arg);
+        } else {
+            ucs_assert(listener->accept_cb != NULL);
+            UCS_ASYNC_BLOCK(&worker->async);
+            ucp_ep_create_server_accept(worker, conn_request, &ep);
+            UCS_ASYNC_UNBLOCK(&worker->async);
+        }
+
+        if (destroyed) {
+            /* The listener was destroyed, and its remaining requests were
+             * rejected */
+            return count;
+        }
     }
 
-    ucs_assert(listener->accept_cb != NULL);
+    /* Continue with the rest of the requests on the next progress call */
     UCS_ASYNC_BLOCK(&worker->async);
-    ucp_ep_create_server_accept(worker, conn_request, &ep);
+    listener->destroyed_p = NULL;
+    if (!ucs_queue_is_empty(&listener->conn_req_q)) {
+        ucs_callbackq_add_oneshot(&worker->uct->progress_q, listener,
+                                  ucp_cm_server_conn_request_progress,
+                                  listener);
+    }
     UCS_ASYNC_UNBLOCK(&worker->async);
-    return 1;
+
+    return count;
 }
 
 static ucp_rsc_index_t ucp_listener_get_cm_index(uct_listener_h listener,
@@ -1094,23 +1140,32 @@ static ucp_rsc_index_t ucp_listener_get_cm_index(uct_listener_h listener,
     return UCP_NULL_RESOURCE;
 }
 
-int ucp_cm_server_conn_request_progress_cb_pred(const ucs_callbackq_elem_t *elem,
-                                                void *arg)
+static int
+ucp_cm_server_conn_request_progress_cb_pred(const ucs_callbackq_elem_t *elem,
+                                            void *arg)
+{
+    return (elem->cb == ucp_cm_server_conn_request_progress) &&
+           (elem->arg == arg);
+}
+
+void ucp_cm_server_conn_requests_purge(ucp_listener_h listener)
 {
-    ucp_listener_h listener = arg;
+    ucp_worker_h worker = listener->worker;
     ucp_conn_request_h conn_request;
 
-    if (elem->cb != ucp_cm_server_conn_request_progress) {
-        return 0;
+    UCS_ASYNC_BLOCK(&worker->async);
+    ucs_callbackq_remove_oneshot(&worker->uct->progress_q, listener,
+                                 ucp_cm_server_conn_request_progress_cb_pred,
+                                 listener);
+    ucs_queue_for_each_extract(conn_request, &listener->conn_req_q, queue, 1) {
+        ucp_listener_reject(listener, conn_request);
     }
 
-    conn_request = elem->arg;
-    if (conn_request->listener != listener) {
-        return 0;
+    if (listener->destroyed_p != NULL) {
+        /* Stop the batch which is being handled */
+        *listener->destroyed_p = 1;
     }
-
-    ucp_listener_reject(listener, conn_request);
-    return 1;
+    UCS_ASYNC_UNBLOCK(&worker->async);
 }
 
 void ucp_cm_server_conn_request_cb(uct_listener_h listener, void *arg,
@@ -1190,9 +1245,17 @@ void ucp_cm_server_conn_request_cb(uct_listener_h listener, void *arg,
     memcpy(ucp_conn_request + 1, remote_data->conn_priv_data,
            remote_data->conn_priv_data_length);
 
-    ucs_callbackq_add_oneshot(&worker->uct->progress_q, ucp_listener,
-                              ucp_cm_server_conn_request_progress,
-                              ucp_conn_request);
+    UCS_ASYNC_BLOCK(&worker->async);
+    /* While a batch is handled, the batch adds the progress callback again if
+     * needed */
+    if (ucs_queue_is_empty(&ucp_listener->conn_req_q) &&
+        (ucp_listener->destroyed_p == NULL)) {
+        ucs_callbackq_add_oneshot(&worker->uct->progress_q, ucp_listener,
+                                  ucp_cm_server_conn_request_progress,
+                                  ucp_listener);
+    }
+    ucs_queue_push(&ucp_listener->conn_req_q, &ucp_conn_request->queue);
+    UCS_ASYNC_UNBLOCK(&worker->async);
 
     /* If the worker supports the UCP_FEATURE_WAKEUP feature, signal the user so
      * that he can wake-up on this event */
@@ -142,6 +142,13 @@ static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
         ucs_queue_push(&wireup_ep->pending_q, ucp_wireup_ep_req_priv(req));
         ucp_worker_flush_ops_count_add(worker, +1);
         status = UCS_OK;
+
+        if ((wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND) &&
+            !(wireup_ep->flags & UCP_WIREUP_EP_FLAG_CONNECT_SCHED)) {
+            /* First operation on the lane, connect it */
+            wireup_ep->flags |= UCP_WIREUP_EP_FLAG_CONNECT_SCHED;
+            ucp_wireup_on_demand_sched(wireup_ep);
+        }
     }
 out:
     UCS_ASYNC_UNBLOCK(&worker->async);
@@ -201,6 +208,50 @@ static ssize_t ucp_wireup_ep_am_bcopy(uct_ep_h uct_ep, uint8_t id,
 UCS_CLASS_DEFINE_NAMED_NEW_FUNC(ucp_wireup_ep_create, ucp_wireup_ep_t, uct_ep_t,
                                 ucp_ep_h, const ucp_rsc_index_t*);
 
+ucs_status_t ucp_wireup_ep_create_on_demand(ucp_ep_h ep,
+                                            const ucp_address_entry_t *address,
+                                            unsigned path_index,
+                                            uct_ep_h *ep_p)
+{
+    ucp_wireup_ep_remote_addr_t *remote_addr;
+    ucp_wireup_ep_t *wireup_ep;
+    ucs_status_t status;
+    uct_ep_h uct_ep;
+    void *ptr;
+
+    remote_addr = ucs_malloc(sizeof(*remote_addr) + address->dev_addr_len +
+                             address->iface_addr_len, "wireup_remote_addr");
+    if (remote_addr == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    status = ucp_wireup_ep_create(ep, NULL, &uct_ep);
+    if (status != UCS_OK) {
+        ucs_free(remote_addr);
+        return status;
+    }
+
+    ptr                     = remote_addr + 1;
+    remote_addr->dev_addr   = (address->dev_addr != NULL) ? ptr : NULL;
+    memcpy(ptr, address->dev_addr, address->dev_addr_len);
+    ptr                     = UCS_PTR_BYTE_OFFSET(ptr, address->dev_addr_len);
+    remote_addr->iface_addr = (address->iface_addr != NULL) ? ptr : NULL;
+    memcpy(ptr, address->iface_addr, address->iface_addr_len);
+    remote_addr->path_index = path_index;
+
+    /* The lane may stay unconnected for the whole endpoint lifetime, so it
+     * must not hold off worker flush */
+    wireup_ep               = ucp_wireup_ep(uct_ep);
+    wireup_ep->remote_addr  = remote_addr;
+    wireup_ep->flags       |= UCP_WIREUP_EP_FLAG_ON_DEMAND;
+    UCS_ASYNC_BLOCK(&ep->worker->async);
+    ucp_worker_flush_ops_count_add(ep->worker, -1);
+    UCS_ASYNC_UNBLOCK(&ep->worker->async);
+
+    *ep_p = uct_ep;
+    return UCS_OK;
+}
+
 void ucp_wireup_ep_set_aux(ucp_wireup_ep_t *wireup_ep, uct_ep_h uct_ep,
                            ucp_rsc_index_t rsc_index, int is_p2p)
 {
@@ -294,6 +345,13 @@ static ucs_status_t ucp_wireup_ep_flush(uct_ep_h uct_ep, unsigned flags,
         }
         return UCS_OK;
     }
+
+    if ((wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND) &&
+        ucs_queue_is_empty(&wireup_ep->pending_q)) {
+        /* Nothing was sent on a lane which is not connected yet */
+        return UCS_OK;
+    }
+
     return UCS_ERR_NO_RESOURCE;
 }
 
@@ -346,6 +404,12 @@ static ucs_status_t ucp_wireup_ep_check(uct_ep_h uct_ep, unsigned flags,
 }
 
 
+static int
+ucp_wireup_ep_on_demand_filter(const ucs_callbackq_elem_t *elem, void *arg)
+{
+    return (elem->cb == ucp_wireup_on_demand_progress) && (elem->arg == arg);
+}
+
 UCS_CLASS_INIT_FUNC(ucp_wireup_ep_t, ucp_ep_h ucp_ep,
                     const ucp_rsc_index_t *dst_rsc_indices)
 {
@@ -386,6 +450,7 @@ UCS_CLASS_INIT_FUNC(ucp_wireup_ep_t, ucp_ep_h ucp_ep,
     self->aux_rsc_index = UCP_NULL_RESOURCE;
     self->pending_count = 0;
     self->flags         = 0;
+    self->remote_addr   = NULL;
     ucs_queue_head_init(&self->pending_q);
     UCS_BITMAP_CLEAR(&self->cm_resolve_tl_bitmap);
 
@@ -431,6 +496,14 @@ static UCS_CLASS_CLEANUP_FUNC(ucp_wireup_ep_t)
         ucp_proxy_ep_set_uct_ep(&self->super, NULL, 0, UCP_NULL_RESOURCE);
     }
 
+    if (self->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND) {
+        /* On-demand wireup EP is not counted as a flush operation */
+        ucs_callbackq_remove_oneshot(&worker->uct->progress_q, self,
+                                     ucp_wireup_ep_on_demand_filter, self);
+        ucs_free(self->remote_addr);
+        return;
+    }
+
     UCS_ASYNC_BLOCK(&worker->async);
     ucp_worker_flush_ops_count_add(worker, -1);
     UCS_ASYNC_UNBLOCK(&worker->async);
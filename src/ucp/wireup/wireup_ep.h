@@ -32,10 +32,27 @@ enum {
     UCP_WIREUP_EP_FLAG_SEND_CLIENT_ID   = UCS_BIT(3),
 
     /* Indicates that aux_ep is CONNECT_TO_EP */
-    UCP_WIREUP_EP_FLAG_AUX_P2P          = UCS_BIT(4)
+    UCP_WIREUP_EP_FLAG_AUX_P2P          = UCS_BIT(4),
+
+    /* next_ep is created when the lane is used for the first time */
+    UCP_WIREUP_EP_FLAG_ON_DEMAND        = UCS_BIT(5),
+
+    /* On-demand connection of next_ep is scheduled */
+    UCP_WIREUP_EP_FLAG_CONNECT_SCHED    = UCS_BIT(6)
 };
 
 
+/**
+ * Remote interface address of a lane which is connected on demand
+ */
+typedef struct {
+    const uct_device_addr_t   *dev_addr;     /**< Remote device address */
+    const uct_iface_addr_t    *iface_addr;   /**< Remote interface address */
+    unsigned                  path_index;    /**< Path index to connect with */
+    /* Followed by device and interface addresses */
+} ucp_wireup_ep_remote_addr_t;
+
+
 /**
  * Wireup proxy endpoint, to hold off send requests until wireup process completes.
  * It is placed instead UCT endpoint before it's fully connected, and for AM
@@ -60,6 +77,8 @@ struct ucp_wireup_ep {
     /**< Destination resource indicies used for checking intersection between
          two configurations in case of CM */
     ucp_rsc_index_t           dst_rsc_indices[UCP_MAX_LANES];
+    /**< Address to connect next_ep to, if the lane is connected on demand */
+    ucp_wireup_ep_remote_addr_t *remote_addr;
 };
 
 
@@ -71,6 +90,22 @@ ucs_status_t ucp_wireup_ep_create(ucp_ep_h ep,
                                   uct_ep_h *ep_p);
 
 
+/**
+ * Create a proxy endpoint for a lane connected to a remote interface, which
+ * creates the transport endpoint only when a send operation is first queued
+ * on it.
+ *
+ * @param [in]  ep          UCP endpoint of the lane.
+ * @param [in]  address     Remote address entry to connect to.
+ * @param [in]  path_index  Path index the transport endpoint should use.
+ * @param [out] ep_p        Filled with the created proxy endpoint.
+ */
+ucs_status_t ucp_wireup_ep_create_on_demand(ucp_ep_h ep,
+                                            const ucp_address_entry_t *address,
+                                            unsigned path_index,
+                                            uct_ep_h *ep_p);
+
+
 /**
  * @return Auxiliary resource index used by the wireup endpoint.
  *   If the endpoint is not a wireup endpoint, return UCP_NULL_RESOURCE.
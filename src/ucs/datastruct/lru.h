@@ -130,6 +130,47 @@ static UCS_F_ALWAYS_INLINE void ucs_lru_push(ucs_lru_h lru, void *key)
 }
 
 
+/**
+ * @brief Remove an element from the cache, if present.
+ *
+ * @param [in] lru  Handle to the LRU cache.
+ * @param [in] key  Element's key.
+ */
+static UCS_F_ALWAYS_INLINE void ucs_lru_remove(ucs_lru_h lru, void *key)
+{
+    ucs_lru_element_t *elem;
+    khint_t iter;
+
+    iter = kh_get(ucs_lru_hash, &lru->hash, (uint64_t)key);
+    if (iter == kh_end(&lru->hash)) {
+        return;
+    }
+
+    elem = kh_val(&lru->hash, iter);
+    ucs_list_del(&elem->list);
+    kh_del(ucs_lru_hash, &lru->hash, iter);
+    ucs_free(elem);
+}
+
+
+/**
+ * @brief Get the least recently used element of the cache.
+ *
+ * @param [in] lru  Handle to the LRU cache.
+ *
+ * @return Key of the least recently used element, or NULL if the cache is
+ *         empty.
+ */
+static UCS_F_ALWAYS_INLINE void *ucs_lru_tail(ucs_lru_h lru)
+{
+    if (ucs_list_is_empty(&lru->list)) {
+        return NULL;
+    }
+
+    return ucs_list_tail(&lru->list, ucs_lru_element_t, list)->key;
+}
+
+
 /**
  * @brief Resets an LRU object.
  *
@@ -19,16 +19,34 @@
 #include <stdint.h>
 #include <sched.h>
 #include <dirent.h>
+#include <sys/syscall.h>
 
-#define UCS_NUMA_MIN_DISTANCE       10
 #define UCS_NUMA_NODE_MAX           INT16_MAX
 #define UCS_NUMA_CORE_DIR_PATH      UCS_SYS_FS_CPUS_PATH "/cpu%d"
 #define UCS_NUMA_NODES_DIR_PATH     UCS_SYS_FS_SYSTEM_PATH "/node"
 #define UCS_NUMA_NODE_DISTANCE_PATH UCS_NUMA_NODES_DIR_PATH "/node%d/distance"
 
+/* Maximal node index which can be passed to ucs_numa_mem_bind() */
+#define UCS_NUMA_BIND_NODE_MAX      1024
+#define UCS_NUMA_NODEMASK_WORD_BITS (sizeof(unsigned long) * 8)
+
+/* Memory policy definitions from linux/mempolicy.h */
+#define UCS_NUMA_MPOL_PREFERRED     1
+#define UCS_NUMA_MPOL_BIND          2
+#define UCS_NUMA_MPOL_MF_MOVE       UCS_BIT(1)
+#define UCS_NUMA_MPOL_F_NODE        UCS_BIT(0)
+#define UCS_NUMA_MPOL_F_ADDR        UCS_BIT(1)
+
 
 KHASH_MAP_INIT_INT(numa_distance, ucs_numa_distance_t);
 
+const char *ucs_numa_policy_names[] = {
+    [UCS_NUMA_POLICY_DEFAULT]   = "default",
+    [UCS_NUMA_POLICY_BIND]      = "bind",
+    [UCS_NUMA_POLICY_PREFERRED] = "preferred",
+    [UCS_NUMA_POLICY_LAST]      = NULL
+};
+
 typedef struct {
     unsigned     max_index;
     const char   *prefix;
@@ -243,6 +261,78 @@ ucs_numa_distance(ucs_numa_node_t node1, ucs_numa_node_t node2)
     return distance;
 }
 
+ucs_numa_node_t ucs_numa_node_of_current_cpu()
+{
+    int cpu = sched_getcpu();
+
+    if ((cpu < 0) || (cpu >= __CPU_SETSIZE)) {
+        return UCS_NUMA_NODE_UNDEFINED;
+    }
+
+    return ucs_numa_node_of_cpu(cpu);
+}
+
+ucs_status_t ucs_numa_mem_bind(void *address, size_t length,
+                               ucs_numa_policy_t policy, ucs_numa_node_t node)
+{
+#ifdef __NR_mbind
+    unsigned long nodemask[UCS_NUMA_BIND_NODE_MAX /
+                           UCS_NUMA_NODEMASK_WORD_BITS] = {0};
+    int mode, ret;
+
+    switch (policy) {
+    case UCS_NUMA_POLICY_BIND:
+        mode = UCS_NUMA_MPOL_BIND;
+        break;
+    case UCS_NUMA_POLICY_PREFERRED:
+        mode = UCS_NUMA_MPOL_PREFERRED;
+        break;
+    default:
+        return UCS_OK;
+    }
+
+    if ((node < 0) || (node >= UCS_NUMA_BIND_NODE_MAX)) {
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    /* Nothing to place on a single-node system */
+    if (ucs_numa_num_configured_nodes() <= 1) {
+        return UCS_OK;
+    }
+
+    nodemask[node / UCS_NUMA_NODEMASK_WORD_BITS] =
+            UCS_BIT(node % UCS_NUMA_NODEMASK_WORD_BITS);
+    ret = syscall(__NR_mbind, address, length, mode, nodemask,
+                  UCS_NUMA_BIND_NODE_MAX + 1, UCS_NUMA_MPOL_MF_MOVE);
+    if (ret != 0) {
+        ucs_debug("mbind(address=%p length=%zu mode=%d node=%d) failed: %m",
+                  address, length, mode, node);
+        return UCS_ERR_IO_ERROR;
+    }
+
+    return UCS_OK;
+#else
+    return (policy == UCS_NUMA_POLICY_DEFAULT) ? UCS_OK : UCS_ERR_UNSUPPORTED;
+#endif
+}
+
+ucs_numa_node_t ucs_numa_node_of_address(const void *address)
+{
+#ifdef __NR_get_mempolicy
+    int node;
+
+    if (syscall(__NR_get_mempolicy, &node, NULL, 0, address,
+                UCS_NUMA_MPOL_F_NODE | UCS_NUMA_MPOL_F_ADDR) != 0) {
+        ucs_debug("get_mempolicy(address=%p) failed: %m", address);
+        return UCS_NUMA_NODE_UNDEFINED;
+    }
+
+    return node;
+#else
+    return UCS_NUMA_NODE_UNDEFINED;
+#endif
+}
+
 void ucs_numa_init()
 {
     ucs_spinlock_init(&ucs_numa_global_ctx.lock, 0);
@@ -7,10 +7,13 @@
 #ifndef UCS_NUMA_H_
 #define UCS_NUMA_H_
 
+#include <ucs/type/status.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define UCS_NUMA_NODE_DEFAULT    0
 #define UCS_NUMA_NODE_UNDEFINED -1
+#define UCS_NUMA_MIN_DISTANCE    10
 
 typedef int ucs_numa_distance_t;
 
@@ -18,6 +21,17 @@ typedef int ucs_numa_distance_t;
 typedef int16_t ucs_numa_node_t;
 
 
+/**
+ * Memory placement policy
+ */
+typedef enum {
+    UCS_NUMA_POLICY_DEFAULT,   /* Keep the policy of the calling thread */
+    UCS_NUMA_POLICY_BIND,      /* Allocate strictly on the given node */
+    UCS_NUMA_POLICY_PREFERRED, /* Prefer the given node, fall back to others */
+    UCS_NUMA_POLICY_LAST
+} ucs_numa_policy_t;
+
+
 extern const char *ucs_numa_policy_names[];
 
 
@@ -66,4 +80,37 @@ ucs_numa_node_t ucs_numa_node_of_device(const char *dev_path);
 ucs_numa_distance_t
 ucs_numa_distance(ucs_numa_node_t node1, ucs_numa_node_t node2);
 
+
+/**
+ * @return The NUMA node of the CPU the calling thread is running on, or
+ *         @ref UCS_NUMA_NODE_UNDEFINED if it cannot be determined.
+ */
+ucs_numa_node_t ucs_numa_node_of_current_cpu();
+
+
+/**
+ * Apply a memory placement policy to a memory range. Pages which were already
+ * faulted in are migrated to the requested node on a best-effort basis.
+ *
+ * @param [in]  address  Start of the range, must be page-aligned.
+ * @param [in]  length   Length of the range.
+ * @param [in]  policy   Placement policy to apply.
+ * @param [in]  node     NUMA node to place the memory on.
+ *
+ * @return UCS_OK if the policy was applied or there is nothing to do,
+ *         error code otherwise.
+ */
+ucs_status_t ucs_numa_mem_bind(void *address, size_t length,
+                               ucs_numa_policy_t policy, ucs_numa_node_t node);
+
+
+/**
+ * @param [in]  address Address to query.
+ *
+ * @return The NUMA node where the page containing @a address resides (the
+ *         page is faulted in if needed), or @ref UCS_NUMA_NODE_UNDEFINED if
+ *         the node cannot be determined.
+ */
+ucs_numa_node_t ucs_numa_node_of_address(const void *address);
+
 #endif
@@ -1523,6 +1523,40 @@ ucs_status_t ucs_sys_check_fd_limit_per_process()
     return UCS_OK;
 }
 
+ucs_status_t ucs_sys_dup_remote_fd(pid_t pid, int remote_fd, int *fd_p)
+{
+#if defined(__NR_pidfd_open) && defined(__NR_pidfd_getfd)
+    int pidfd, fd, ret;
+
+    pidfd = syscall(__NR_pidfd_open, pid, 0);
+    if (pidfd < 0) {
+        ucs_debug("pidfd_open(pid=%d) failed: %m", pid);
+        return (errno == ENOSYS) ? UCS_ERR_UNSUPPORTED : UCS_ERR_IO_ERROR;
+    }
+
+    fd = syscall(__NR_pidfd_getfd, pidfd, remote_fd, 0);
+    if (fd < 0) {
+        ucs_debug("pidfd_getfd(pid=%d, fd=%d) failed: %m", pid, remote_fd);
+        ret = errno;
+        close(pidfd);
+        switch (ret) {
+        case ENOSYS:
+            return UCS_ERR_UNSUPPORTED;
+        case EPERM:
+            return UCS_ERR_REJECTED;
+        default:
+            return UCS_ERR_IO_ERROR;
+        }
+    }
+
+    close(pidfd);
+    *fd_p = fd;
+    return UCS_OK;
+#else
+    return UCS_ERR_UNSUPPORTED;
+#endif
+}
+
 ucs_status_t ucs_pthread_create(pthread_t *thread_id_p,
                                 void *(*start_routine)(void*), void *arg,
                                 const char *fmt, ...)
@@ -639,6 +639,21 @@ ucs_status_t ucs_sys_enum_threads(ucs_sys_enum_threads_cb_t cb, void *arg);
 ucs_status_t ucs_sys_check_fd_limit_per_process();
 
 
+/**
+ * Duplicate a file descriptor of another process into the current process,
+ * using pidfd_getfd(2). The new descriptor has the close-on-exec flag set.
+ *
+ * @param [in]  pid        Process which owns the file descriptor.
+ * @param [in]  remote_fd  File descriptor number in the process @a pid.
+ * @param [out] fd_p       Filled with the duplicated file descriptor.
+ *
+ * @return UCS_OK on success, UCS_ERR_UNSUPPORTED if the system does not
+ *         support it, UCS_ERR_REJECTED if not allowed to access the process,
+ *         or UCS_ERR_IO_ERROR on another error.
+ */
+ucs_status_t ucs_sys_dup_remote_fd(pid_t pid, int remote_fd, int *fd_p);
+
+
 /*
  * Create a named thread.
  *
@@ -306,6 +306,9 @@ UCS_CLASS_INIT_FUNC(uct_cm_t, uct_cm_ops_t* ops, uct_iface_ops_t* iface_ops,
     self->config.failure_level    = config->failure;
     self->config.reuse_addr       = config->reuse_addr;
 
+    /* Connection managers are progressed by async events */
+    self->iface.config.progress_max_skip = 0;
+
     return UCS_STATS_NODE_ALLOC(&self->iface.stats, &uct_cm_stats_class,
                                 ucs_stats_get_root(), "%s-%p", "iface",
                                 &self->iface);
@@ -23,6 +23,11 @@
 #include <ucs/vfs/base/vfs_obj.h>
 
 
+/* Number of progress calls without events after which the interface is
+ * considered idle */
+#define UCT_IFACE_PROGRESS_IDLE_THRESH 16
+
+
 const char *uct_ep_operation_names[] = {
     [UCT_EP_OP_AM_SHORT]     = "am_short",
     [UCT_EP_OP_AM_BCOPY]     = "am_bcopy",
@@ -71,12 +76,13 @@ static ucs_stats_class_t uct_iface_stats_class = {
     .num_counters  = UCT_IFACE_STAT_LAST,
     .class_id      = UCS_STATS_CLASS_ID_INVALID,
     .counter_names = {
-        [UCT_IFACE_STAT_RX_AM]       = "rx_am",
-        [UCT_IFACE_STAT_RX_AM_BYTES] = "rx_am_bytes",
-        [UCT_IFACE_STAT_TX_NO_DESC]  = "tx_no_desc",
-        [UCT_IFACE_STAT_FLUSH]       = "flush",
-        [UCT_IFACE_STAT_FLUSH_WAIT]  = "flush_wait",
-        [UCT_IFACE_STAT_FENCE]       = "fence"
+        [UCT_IFACE_STAT_RX_AM]         = "rx_am",
+        [UCT_IFACE_STAT_RX_AM_BYTES]   = "rx_am_bytes",
+        [UCT_IFACE_STAT_TX_NO_DESC]    = "tx_no_desc",
+        [UCT_IFACE_STAT_FLUSH]         = "flush",
+        [UCT_IFACE_STAT_FLUSH_WAIT]    = "flush_wait",
+        [UCT_IFACE_STAT_FENCE]         = "fence",
+        [UCT_IFACE_STAT_PROGRESS_SKIP] = "progress_skip"
     }
 };
 #endif
@@ -352,6 +358,38 @@ void uct_base_iface_progress_enable(uct_iface_h tl_iface, unsigned flags)
                                       flags);
 }
 
+/*
+ * Poll an interface which has been idle for a while at an exponentially
+ * decaying frequency, up to one poll every progress_max_skip + 1 calls. The
+ * first event brings the interface back to polling on every call.
+ */
+static unsigned uct_base_iface_progress_sched(void *arg)
+{
+    uct_base_iface_t *iface = arg;
+    unsigned count, interval;
+
+    if (iface->prog_sched.skip > 0) {
+        --iface->prog_sched.skip;
+        UCS_STATS_UPDATE_COUNTER(iface->stats, UCT_IFACE_STAT_PROGRESS_SKIP,
+                                 1);
+        return 0;
+    }
+
+    count = iface->prog_sched.cb(iface);
+    if (count > 0) {
+        iface->prog_sched.idle_count = 0;
+        iface->prog_sched.interval   = 0;
+    } else if (++iface->prog_sched.idle_count >=
+               UCT_IFACE_PROGRESS_IDLE_THRESH) {
+        interval                   = ucs_max(iface->prog_sched.interval * 2, 1);
+        iface->prog_sched.interval = ucs_min(interval,
+                                             iface->config.progress_max_skip);
+        iface->prog_sched.skip     = iface->prog_sched.interval;
+    }
+
+    return count;
+}
+
 void uct_base_iface_progress_enable_cb(uct_base_iface_t *iface,
                                        ucs_callback_t cb, unsigned flags)
 {
@@ -366,6 +404,14 @@ void uct_base_iface_progress_enable_cb(uct_base_iface_t *iface,
     /* Add callback only if previous flags are 0 and new flags != 0 */
     if ((!iface->progress_flags && flags) &&
         (iface->prog.id == UCS_CALLBACKQ_ID_NULL)) {
+        if (iface->config.progress_max_skip > 0) {
+            iface->prog_sched.cb         = cb;
+            iface->prog_sched.idle_count = 0;
+            iface->prog_sched.interval   = 0;
+            iface->prog_sched.skip       = 0;
+            cb                           = uct_base_iface_progress_sched;
+        }
+
         if (thread_safe) {
             iface->prog.id = ucs_callbackq_add_safe(&worker->super.progress_q,
                                                     cb, iface);
@@ -634,8 +680,9 @@ UCS_CLASS_INIT_FUNC(uct_base_iface_t, uct_iface_ops_t *ops,
         alloc_methods_bitmap |= UCS_BIT(method);
     }
 
-    self->config.failure_level = (ucs_log_level_t)config->failure;
-    self->config.max_num_eps   = config->max_num_eps;
+    self->config.failure_level     = (ucs_log_level_t)config->failure;
+    self->config.max_num_eps       = config->max_num_eps;
+    self->config.progress_max_skip = config->progress_idle_backoff;
 
     return UCS_STATS_NODE_ALLOC(&self->stats, &uct_iface_stats_class,
                                 stats_parent, "-%s-%p", iface_name, self);
@@ -828,6 +875,15 @@ ucs_config_field_t uct_iface_config_table[] = {
    "Maximum number of endpoints that the transport interface is able to create",
    ucs_offsetof(uct_iface_config_t, max_num_eps), UCS_CONFIG_TYPE_ULUNITS},
 
+  {"PROGRESS_IDLE_BACKOFF", "0",
+   "Maximal number of worker progress calls to skip polling the interface when\n"
+   "it is idle. After the interface has no events for a while, the polling\n"
+   "interval grows exponentially up to this value, and it is reset to polling\n"
+   "on every call by the first event. This reduces the overhead of polling idle\n"
+   "transports while another transport is busy. 0 disables skipping.",
+   ucs_offsetof(uct_iface_config_t, progress_idle_backoff),
+   UCS_CONFIG_TYPE_UINT},
+
   {NULL}
 };
 
@@ -58,6 +58,7 @@ enum {
     UCT_IFACE_STAT_FLUSH,
     UCT_IFACE_STAT_FLUSH_WAIT,  /* number of times flush called while in progress */
     UCT_IFACE_STAT_FENCE,
+    UCT_IFACE_STAT_PROGRESS_SKIP, /* number of progress calls skipped while idle */
     UCT_IFACE_STAT_LAST
 };
 
@@ -331,11 +332,20 @@ typedef struct uct_base_iface {
                                                   support progress control */
     unsigned                 progress_flags;   /* Which progress is currently enabled */
 
+    /* Skipping progress calls while the interface is idle */
+    struct {
+        ucs_callback_t       cb;               /* Transport progress function */
+        unsigned             idle_count;       /* Progress calls without events */
+        unsigned             interval;         /* Current polling interval */
+        unsigned             skip;             /* Progress calls left to skip */
+    } prog_sched;
+
     struct {
         unsigned             num_alloc_methods;
         uct_alloc_method_t   alloc_methods[UCT_ALLOC_METHOD_LAST];
         ucs_log_level_t      failure_level;
         size_t               max_num_eps;
+        unsigned             progress_max_skip;
     } config;
 
     UCS_STATS_NODE_DECLARE(stats)            /* Statistics */
@@ -542,6 +552,7 @@ struct uct_iface_config {
 
     int               failure;   /* Level of failure reports */
     size_t            max_num_eps;
+    unsigned          progress_idle_backoff; /* Max progress calls to skip */
 };
 
 
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "sm_calib.h"
+
+#include <ucs/debug/log.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/sys/math.h>
+#include <ucs/sys/string.h>
+#include <ucs/sys/sys.h>
+#include <ucs/time/time.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <float.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/* Minimal time to measure a single message size, in seconds */
+#define UCT_SM_CALIB_MIN_TIME 1e-3
+
+/* Number of measurements of every message size, the fastest one is used */
+#define UCT_SM_CALIB_REPEAT   3
+
+
+/* Message sizes to measure, in ascending order */
+static const size_t uct_sm_calib_sizes[] = {
+    16 * UCS_KBYTE, 256 * UCS_KBYTE, 4 * UCS_MBYTE
+};
+
+
+static ucs_status_t
+uct_sm_calib_measure_size(const uct_sm_calib_ops_t *ops, void *arg, void *dst,
+                          const void *src, size_t length, double *time_p)
+{
+    double best_time = DBL_MAX;
+    double elapsed;
+    ucs_time_t start;
+    ucs_status_t status;
+    unsigned i, iters;
+
+    for (i = 0; i < UCT_SM_CALIB_REPEAT; ++i) {
+        iters = 0;
+        start = ucs_get_time();
+        do {
+            status = ops->copy(arg, dst, src, length);
+            if (status != UCS_OK) {
+                return status;
+            }
+
+            ++iters;
+            elapsed = ucs_time_to_sec(ucs_get_time() - start);
+        } while (elapsed < UCT_SM_CALIB_MIN_TIME);
+
+        best_time = ucs_min(best_time, elapsed / iters);
+    }
+
+    *time_p = best_time;
+    return UCS_OK;
+}
+
+/* Fit the copy time to 'overhead + length / bandwidth' by least squares */
+static ucs_status_t
+uct_sm_calib_fit(const double *times, uct_sm_calib_result_t *result)
+{
+    const unsigned n = ucs_static_array_size(uct_sm_calib_sizes);
+    double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    double x, slope;
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        x       = uct_sm_calib_sizes[i];
+        sum_x  += x;
+        sum_y  += times[i];
+        sum_xx += x * x;
+        sum_xy += x * times[i];
+    }
+
+    slope = ((n * sum_xy) - (sum_x * sum_y)) / ((n * sum_xx) - (sum_x * sum_x));
+    if (slope <= 0) {
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    result->bandwidth = 1.0 / slope;
+    result->overhead  = ucs_max((sum_y - (slope * sum_x)) / n, 0);
+    return UCS_OK;
+}
+
+static ucs_status_t uct_sm_calib_measure(const char *name,
+                                         const uct_sm_calib_ops_t *ops,
+                                         void *arg,
+                                         uct_sm_calib_result_t *result)
+{
+    const size_t max_length =
+            uct_sm_calib_sizes[ucs_static_array_size(uct_sm_calib_sizes) - 1];
+    double times[ucs_static_array_size(uct_sm_calib_sizes)];
+    void *buffer, *dst;
+    ucs_status_t status;
+    unsigned i;
+    int ret;
+
+    ret = ucs_posix_memalign(&buffer, ucs_get_page_size(), 2 * max_length,
+                             "sm_calib_buffer");
+    if (ret != 0) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    /* Fault in the pages before measuring */
+    memset(buffer, 0, 2 * max_length);
+    dst = UCS_PTR_BYTE_OFFSET(buffer, max_length);
+
+    if (ops->init != NULL) {
+        status = ops->init(arg, dst, max_length);
+        if (status != UCS_OK) {
+            goto out_free;
+        }
+    }
+
+    /* Warm up */
+    status = ops->copy(arg, dst, buffer, max_length);
+    if (status != UCS_OK) {
+        goto out_cleanup;
+    }
+
+    for (i = 0; i < ucs_static_array_size(uct_sm_calib_sizes); ++i) {
+        status = uct_sm_calib_measure_size(ops, arg, dst, buffer,
+                                           uct_sm_calib_sizes[i], &times[i]);
+        if (status != UCS_OK) {
+            goto out_cleanup;
+        }
+    }
+
+    status = uct_sm_calib_fit(times, result);
+    if (status != UCS_OK) {
+        ucs_diag("%s: failed to fit measured copy times: %.3f us for %zu "
+                 "bytes, %.3f us for %zu bytes", name, times[0] * 1e6,
+                 uct_sm_calib_sizes[0], times[i - 1] * 1e6, max_length);
+    }
+
+out_cleanup:
+    if (ops->cleanup != NULL) {
+        ops->cleanup(arg);
+    }
+out_free:
+    ucs_free(buffer);
+    return status;
+}
+
+static void uct_sm_calib_boot_id_str(char *buf, size_t max)
+{
+    uint64_t high, low;
+
+    if (ucs_sys_get_boot_id(&high, &low) != UCS_OK) {
+        high = low = 0;
+    }
+
+    ucs_snprintf_zero(buf, max, "%016" PRIx64 "%016" PRIx64, high, low);
+}
+
+/* Look up the results of the mechanism in the cache, measured since boot */
+static int uct_sm_calib_cache_lookup(FILE *stream, const char *name,
+                                     const char *boot_id,
+                                     uct_sm_calib_result_t *result)
+{
+    char line_name[64], line_boot_id[64];
+    double bandwidth, overhead;
+    char line[256];
+
+    while (fgets(line, sizeof(line), stream) != NULL) {
+        if ((sscanf(line, "%63s %63s %lf %lf", line_name, line_boot_id,
+                    &bandwidth, &overhead) == 4) &&
+            !strcmp(line_name, name) && !strcmp(line_boot_id, boot_id) &&
+            (bandwidth > 0) && (overhead >= 0)) {
+            result->bandwidth = bandwidth;
+            result->overhead  = overhead;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+ucs_status_t uct_sm_calib_get(const char *name, const uct_sm_calib_ops_t *ops,
+                              void *arg, const char *cache_tmpl,
+                              uct_sm_calib_result_t *result)
+{
+    char path[PATH_MAX], boot_id[64];
+    ucs_status_t status;
+    FILE *stream;
+    int fd;
+
+    if (!strcmp(cache_tmpl, "")) {
+        stream = NULL;
+    } else {
+        ucs_fill_filename_template(cache_tmpl, path, sizeof(path));
+        fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            ucs_debug("%s: failed to open calibration cache '%s': %m", name,
+                      path);
+            stream = NULL;
+        } else {
+            /* The lock is released when the file is closed. Processes which
+             * wait on it find the results of the process which holds it. */
+            if (flock(fd, LOCK_EX) != 0) {
+                ucs_debug("%s: failed to lock calibration cache '%s': %m",
+                          name, path);
+            }
+
+            stream = fdopen(fd, "r+");
+            if (stream == NULL) {
+                close(fd);
+            }
+        }
+    }
+
+    uct_sm_calib_boot_id_str(boot_id, sizeof(boot_id));
+    if ((stream != NULL) &&
+        uct_sm_calib_cache_lookup(stream, name, boot_id, result)) {
+        ucs_debug("%s: cached copy bandwidth %.2f MB/s, overhead %.3f us",
+                  name, result->bandwidth / UCS_MBYTE,
+                  result->overhead * 1e6);
+        status = UCS_OK;
+        goto out;
+    }
+
+    status = uct_sm_calib_measure(name, ops, arg, result);
+    if (status != UCS_OK) {
+        goto out;
+    }
+
+    ucs_debug("%s: measured copy bandwidth %.2f MB/s, overhead %.3f us", name,
+              result->bandwidth / UCS_MBYTE, result->overhead * 1e6);
+
+    if (stream != NULL) {
+        fseek(stream, 0, SEEK_END);
+        /* Full precision, so all processes use exactly the same values */
+        fprintf(stream, "%s %s %.17g %.17g\n", name, boot_id,
+                result->bandwidth, result->overhead);
+    }
+
+out:
+    if (stream != NULL) {
+        fclose(stream);
+    }
+    return status;
+}
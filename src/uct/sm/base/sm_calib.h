@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCT_SM_CALIB_H_
+#define UCT_SM_CALIB_H_
+
+#include <ucs/type/status.h>
+#include <stddef.h>
+
+
+/**
+ * Measured performance of a copy mechanism
+ */
+typedef struct uct_sm_calib_result {
+    double bandwidth; /* Bytes per second */
+    double overhead;  /* Fixed cost of a copy operation, in seconds */
+} uct_sm_calib_result_t;
+
+
+/**
+ * Copy mechanism to measure
+ */
+typedef struct uct_sm_calib_ops {
+    /* Prepare copying to the destination buffer of @a length bytes, optional */
+    ucs_status_t (*init)(void *arg, void *dst, size_t length);
+
+    /* Copy @a length bytes from @a src to @a dst, within the buffer passed to
+     * init() */
+    ucs_status_t (*copy)(void *arg, void *dst, const void *src, size_t length);
+
+    /* Release the resources allocated by init(), optional */
+    void         (*cleanup)(void *arg);
+} uct_sm_calib_ops_t;
+
+
+/**
+ * Get the performance of a copy mechanism on the local host. The copy time is
+ * measured for several message sizes and fitted to a linear function. The
+ * results are cached in a file, so all processes on the host which use the
+ * same cache file get the same results, and the mechanism is measured only
+ * once.
+ *
+ * @param [in]  name        Mechanism name, used as the key of cached results.
+ * @param [in]  ops         Copy operations.
+ * @param [in]  arg         Argument for copy operations.
+ * @param [in]  cache_tmpl  Cache file name template, as accepted by
+ *                          @ref ucs_fill_filename_template, or an empty string
+ *                          to disable caching.
+ * @param [out] result      Filled with the mechanism performance.
+ *
+ * @return UCS_OK if the performance was measured or found in the cache.
+ */
+ucs_status_t uct_sm_calib_get(const char *name, const uct_sm_calib_ops_t *ops,
+                              void *arg, const char *cache_tmpl,
+                              uct_sm_calib_result_t *result);
+
+#endif
@@ -12,6 +12,7 @@
 #include "sm_iface.h"
 
 #include <uct/base/uct_md.h>
+#include <ucs/debug/memtrack_int.h>
 #include <ucs/sys/string.h>
 #include <ucs/sys/sys.h>
 #include <ucs/arch/cpu.h>
@@ -27,6 +28,22 @@ ucs_config_field_t uct_sm_iface_config_table[] = {
      "Effective memory bandwidth",
      ucs_offsetof(uct_sm_iface_config_t, bandwidth), UCS_CONFIG_TYPE_BW},
 
+    {"CALIBRATE", "n",
+     "Measure the bandwidth and the overhead of the copy mechanism of the\n"
+     "transport on the local host, and use them for protocol selection instead\n"
+     "of BW and the built-in estimations. The measurement takes a few\n"
+     "milliseconds when the transport is first used.",
+     ucs_offsetof(uct_sm_iface_config_t, calibrate), UCS_CONFIG_TYPE_BOOL},
+
+    {"CALIBRATE_CACHE", "/dev/shm/ucx_sm_calib_%u",
+     "File which caches calibration results, so every copy mechanism is\n"
+     "measured once per host, and all processes on the host use the same\n"
+     "results. The following substitutions are performed on this string:\n"
+     "  %u - Replaced with user name.\n"
+     "  %h - Replaced with host name.\n"
+     "Empty value disables the cache.",
+     ucs_offsetof(uct_sm_iface_config_t, calib_cache), UCS_CONFIG_TYPE_STRING},
+
     {NULL}
 };
 
@@ -69,6 +86,31 @@ ucs_status_t uct_sm_ep_fence(uct_ep_t *tl_ep, unsigned flags)
     return UCS_OK;
 }
 
+const uct_sm_calib_result_t *
+uct_sm_iface_calib(uct_sm_iface_t *iface, const char *name,
+                   const uct_sm_calib_ops_t *ops, void *arg)
+{
+    ucs_status_t status;
+
+    if (ucs_likely(iface->calib.state == UCT_SM_IFACE_CALIB_DONE)) {
+        return &iface->calib.result;
+    } else if (iface->calib.state == UCT_SM_IFACE_CALIB_DISABLED) {
+        return NULL;
+    }
+
+    status = uct_sm_calib_get(name, ops, arg, iface->config.calib_cache,
+                              &iface->calib.result);
+    if (status != UCS_OK) {
+        ucs_diag("%s: failed to calibrate copy performance: %s", name,
+                 ucs_status_string(status));
+        iface->calib.state = UCT_SM_IFACE_CALIB_DISABLED;
+        return NULL;
+    }
+
+    iface->calib.state = UCT_SM_IFACE_CALIB_DONE;
+    return &iface->calib.result;
+}
+
 size_t uct_sm_iface_get_device_addr_len()
 {
     return ucs_sys_ns_is_default(UCS_SYS_NS_TYPE_IPC) ?
@@ -98,13 +140,22 @@ UCS_CLASS_INIT_FUNC(uct_sm_iface_t, uct_iface_ops_t *ops,
                             params->stats_root :
                             NULL) UCS_STATS_ARG(params->mode.device.dev_name));
 
-    self->config.bandwidth = sm_config->bandwidth;
+    self->config.bandwidth   = sm_config->bandwidth;
+    self->config.calib_cache = ucs_strdup(sm_config->calib_cache,
+                                          "sm_iface_calib_cache");
+    if (self->config.calib_cache == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    self->calib.state = sm_config->calibrate ? UCT_SM_IFACE_CALIB_PENDING :
+                                               UCT_SM_IFACE_CALIB_DISABLED;
 
     return UCS_OK;
 }
 
 static UCS_CLASS_CLEANUP_FUNC(uct_sm_iface_t)
 {
+    ucs_free(self->config.calib_cache);
 }
 
 UCS_CLASS_DEFINE(uct_sm_iface_t, uct_base_iface_t);
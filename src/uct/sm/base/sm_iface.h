@@ -7,6 +7,8 @@
 #ifndef SM_IFACE_H_
 #define SM_IFACE_H_
 
+#include "sm_calib.h"
+
 #include <uct/api/uct.h>
 #include <uct/base/uct_iface.h>
 #include <ucs/sys/math.h>
@@ -22,13 +24,26 @@ extern ucs_config_field_t uct_sm_iface_config_table[];
 typedef struct uct_sm_iface_common_config {
     uct_iface_config_t     super;
     double                 bandwidth; /* Memory bandwidth in bytes per second */
+    int                    calibrate; /* Measure the copy performance */
+    char                   *calib_cache; /* Calibration cache file template */
 } uct_sm_iface_config_t;
 
+typedef enum {
+    UCT_SM_IFACE_CALIB_DISABLED, /* Calibration is disabled or failed */
+    UCT_SM_IFACE_CALIB_PENDING,  /* Calibration was not done yet */
+    UCT_SM_IFACE_CALIB_DONE      /* Calibration results are valid */
+} uct_sm_iface_calib_state_t;
+
 typedef struct uct_sm_iface {
     uct_base_iface_t       super;
     struct {
         double             bandwidth; /* Memory bandwidth in bytes per second */
+        char               *calib_cache; /* Calibration cache file template */
     } config;
+    struct {
+        uct_sm_iface_calib_state_t state;
+        uct_sm_calib_result_t      result;
+    } calib;
 } uct_sm_iface_t;
 
 
@@ -48,6 +63,17 @@ size_t uct_sm_iface_get_device_addr_len();
 
 ucs_status_t uct_sm_ep_fence(uct_ep_t *tl_ep, unsigned flags);
 
+/**
+ * Get the measured performance of the copy mechanism of the interface. The
+ * mechanism is measured on first use, if calibration is enabled.
+ *
+ * @return Measured performance, or NULL if it should be estimated by the
+ *         configured values.
+ */
+const uct_sm_calib_result_t *
+uct_sm_iface_calib(uct_sm_iface_t *iface, const char *name,
+                   const uct_sm_calib_ops_t *ops, void *arg);
+
 UCS_CLASS_DECLARE(uct_sm_iface_t, uct_iface_ops_t*, uct_iface_internal_ops_t*,
                   uct_md_h, uct_worker_h, const uct_iface_params_t*,
                   const uct_iface_config_t*);
@@ -103,6 +103,55 @@ uct_mm_ep_get_remote_seg(uct_mm_ep_t *ep, uct_mm_seg_id_t seg_id, size_t length,
     return uct_mm_ep_attach_remote_seg(ep, seg_id, length, address_p);
 }
 
+/* Get access to the eventfd of the remote interface, if it has one. This is
+ * done on the first signal, since most endpoints never signal their peer */
+static void uct_mm_ep_signal_init(uct_mm_ep_t *ep)
+{
+    const uct_mm_fifo_ctl_t *fifo_ctl = ep->fifo_ctl;
+    ucs_status_t status;
+
+    ep->signal_eventfd = -1;
+
+    /* The remote pid is meaningful only in the same PID namespace */
+    if ((fifo_ctl->signal_eventfd < 0) ||
+        (fifo_ctl->pid_ns != ucs_sys_get_ns(UCS_SYS_NS_TYPE_PID))) {
+        return;
+    }
+
+    status = ucs_sys_dup_remote_fd(fifo_ctl->pid, fifo_ctl->signal_eventfd,
+                                   &ep->signal_eventfd);
+    if (status != UCS_OK) {
+        ucs_debug("mm ep %p: cannot access eventfd %d of pid %d (%s), using "
+                  "unix domain socket for signaling", ep,
+                  fifo_ctl->signal_eventfd, fifo_ctl->pid,
+                  ucs_status_string(status));
+        ep->signal_eventfd = -1;
+    }
+}
+
+/* send a signal to remote interface using its eventfd */
+static void uct_mm_ep_signal_remote_eventfd(uct_mm_ep_t *ep)
+{
+    uint64_t value = 1;
+    int ret;
+
+    do {
+        ret = write(ep->signal_eventfd, &value, sizeof(value));
+    } while ((ret < 0) && (errno == EINTR));
+
+    if (ucs_unlikely(ret < 0)) {
+        /* EAGAIN means the counter is saturated, so the remote side would get
+         * a signal anyway */
+        if (errno != EAGAIN) {
+            ucs_warn("failed to send wakeup signal: %m");
+        }
+        return;
+    }
+
+    ucs_assert(ret == sizeof(value));
+    ucs_trace("sent wakeup to eventfd %d", ep->signal_eventfd);
+}
+
 /* send a signal to remote interface using Unix-domain socket */
 static void uct_mm_ep_signal_remote(uct_mm_ep_t *ep)
 {
@@ -112,6 +161,15 @@ static void uct_mm_ep_signal_remote(uct_mm_ep_t *ep)
 
     ucs_trace("ep %p: signal remote", ep);
 
+    if (ucs_unlikely(ep->signal_eventfd == UCT_MM_EP_SIGNAL_EVENTFD_INIT)) {
+        uct_mm_ep_signal_init(ep);
+    }
+
+    if (ep->signal_eventfd >= 0) {
+        uct_mm_ep_signal_remote_eventfd(ep);
+        return;
+    }
+
     for (;;) {
         ret = sendto(iface->signal_fd, &dummy, sizeof(dummy), 0,
                      (const struct sockaddr*)&ep->fifo_ctl->signal_sockaddr,
@@ -194,12 +252,15 @@ static UCS_CLASS_INIT_FUNC(uct_mm_ep_t, const uct_ep_params_t *params)
     uct_mm_iface_set_fifo_ptrs(fifo_ptr, &self->fifo_ctl, &self->fifo_elems);
     self->cached_tail = self->fifo_ctl->tail;
     ucs_arbiter_elem_init(&self->arb_elem);
+    uct_mm_iface_numa_update_distance(iface, self->fifo_ctl);
 
     status = uct_ep_keepalive_init(&self->keepalive, self->fifo_ctl->pid);
     if (status != UCS_OK) {
         goto err_free_segs;
     }
 
+    self->signal_eventfd = UCT_MM_EP_SIGNAL_EVENTFD_INIT;
+
     ucs_debug("created mm ep %p, connected to remote FIFO id 0x%"PRIx64,
               self, addr->fifo_seg_id);
 
@@ -216,6 +277,9 @@ err:
 static UCS_CLASS_CLEANUP_FUNC(uct_mm_ep_t)
 {
     uct_mm_ep_pending_purge(&self->super.super, NULL, NULL);
+    if (self->signal_eventfd >= 0) {
+        close(self->signal_eventfd);
+    }
     uct_mm_ep_cleanup_remote_segs(self);
     ucs_free(self->remote_iface_addr);
 }
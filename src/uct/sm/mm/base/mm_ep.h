@@ -18,6 +18,10 @@ KHASH_INIT(uct_mm_remote_seg, uintptr_t, uct_mm_remote_seg_t, 1,
            kh_int64_hash_func, kh_int64_hash_equal)
 
 
+/* The remote eventfd is duplicated on the first signal */
+#define UCT_MM_EP_SIGNAL_EVENTFD_INIT -2
+
+
 /**
  * MM transport endpoint
  */
@@ -49,6 +53,11 @@ typedef struct uct_mm_ep {
     ucs_arbiter_elem_t         arb_elem;
 
     uct_keepalive_info_t       keepalive; /* keepalive info */
+
+    /* duplicate of the remote interface's eventfd, -1 to signal the remote
+       interface on its unix domain socket, or UCT_MM_EP_SIGNAL_EVENTFD_INIT
+       before the first signal */
+    int                        signal_eventfd;
 } uct_mm_ep_t;
 
 
@@ -18,6 +18,7 @@
 #include <ucs/arch/bitops.h>
 #include <ucs/async/async.h>
 #include <ucs/sys/string.h>
+#include <sys/eventfd.h>
 #include <sys/poll.h>
 
 
@@ -27,6 +28,9 @@
 #define UCT_MM_IFACE_OVERHEAD 10e-9
 #define UCT_MM_IFACE_LATENCY  ucs_linear_func_make(80e-9, 0)
 
+/* Extra latency per NUMA distance unit above the local distance */
+#define UCT_MM_IFACE_NUMA_LATENCY 5e-9
+
 ucs_config_field_t uct_mm_iface_config_table[] = {
     {"SM_", "ALLOC=md,mmap,heap;BW=15360MBs", NULL,
      ucs_offsetof(uct_mm_iface_config_t, super),
@@ -67,6 +71,31 @@ ucs_config_field_t uct_mm_iface_config_table[] = {
     {"ERROR_HANDLING", "n", "Expose error handling support capability",
      ucs_offsetof(uct_mm_iface_config_t, error_handling), UCS_CONFIG_TYPE_BOOL},
 
+    {"NUMA_POLICY", "preferred",
+     "NUMA placement of the receive FIFO and receive buffers, relative to the\n"
+     "node of the thread which creates the interface:\n"
+     " default   - Keep the memory policy of the process.\n"
+     " bind      - Allocate memory only on the local node.\n"
+     " preferred - Prefer the local node, fall back to other nodes if it is\n"
+     "             out of memory.",
+     ucs_offsetof(uct_mm_iface_config_t, numa_policy),
+     UCS_CONFIG_TYPE_ENUM(ucs_numa_policy_names)},
+
+    {"SIGNAL_EVENTFD", "y",
+     "Receive wakeup signals from local peers on an eventfd, which the peers\n"
+     "duplicate with pidfd_getfd(2). Peers which are not allowed to duplicate\n"
+     "it signal the receiver on a unix domain socket instead.",
+     ucs_offsetof(uct_mm_iface_config_t, signal_eventfd),
+     UCS_CONFIG_TYPE_BOOL},
+
+    {"SIGNAL_SPIN_TIME", "0",
+     "Time to poll the receive FIFO before arming the interface for wakeup\n"
+     "events. A message which arrives during this time is handled without\n"
+     "going to sleep, and without a wakeup signal from the sender. The FIFO is\n"
+     "not polled again by an arm call while it stays armed.",
+     ucs_offsetof(uct_mm_iface_config_t, signal_spin_time),
+     UCS_CONFIG_TYPE_TIME},
+
     {NULL}
 };
 
@@ -145,6 +174,21 @@ ucs_status_t uct_mm_iface_flush(uct_iface_h tl_iface, unsigned flags,
     return UCS_OK;
 }
 
+static ucs_linear_func_t uct_mm_iface_latency(uct_mm_iface_t *iface)
+{
+    ucs_linear_func_t latency = UCT_MM_IFACE_LATENCY;
+
+    latency.c += (iface->config.numa_distance - UCS_NUMA_MIN_DISTANCE) *
+                 UCT_MM_IFACE_NUMA_LATENCY;
+    return latency;
+}
+
+static double uct_mm_iface_bandwidth(uct_mm_iface_t *iface, double bandwidth)
+{
+    /* Scale by the relative NUMA distance of the peer receive memory */
+    return (bandwidth * UCS_NUMA_MIN_DISTANCE) / iface->config.numa_distance;
+}
+
 static ucs_status_t uct_mm_iface_query(uct_iface_h tl_iface,
                                        uct_iface_attr_t *iface_attr)
 {
@@ -400,7 +444,13 @@ static unsigned uct_mm_iface_progress(uct_iface_h tl_iface)
 
 static ucs_status_t uct_mm_iface_event_fd_get(uct_iface_h tl_iface, int *fd_p)
 {
-    *fd_p = ucs_derived_of(tl_iface, uct_mm_iface_t)->signal_fd;
+    uct_mm_iface_t *iface = ucs_derived_of(tl_iface, uct_mm_iface_t);
+
+    if (iface->signal_event_set != NULL) {
+        return ucs_event_set_fd_get(iface->signal_event_set, fd_p);
+    }
+
+    *fd_p = iface->signal_fd;
     return UCS_OK;
 }
 
@@ -410,7 +460,8 @@ uct_mm_iface_event_fd_arm(uct_iface_h tl_iface, unsigned events)
 {
     uct_mm_iface_t *iface = ucs_derived_of(tl_iface, uct_mm_iface_t);
     char dummy[UCT_MM_IFACE_MAX_SIG_EVENTS]; /* pop multiple signals at once */
-    uint64_t head, prev_head;
+    uint64_t head, prev_head, value;
+    ucs_time_t spin_end;
     int ret;
 
     if ((events & UCT_EVENT_SEND_COMP) &&
@@ -424,8 +475,21 @@ uct_mm_iface_event_fd_arm(uct_iface_h tl_iface, unsigned events)
         return UCS_OK;
     }
 
-    /* Make the next sender which writes to the FIFO signal the receiver */
     head = iface->recv_fifo_ctl->head;
+    if (!(head & UCT_MM_IFACE_FIFO_HEAD_EVENT_ARMED) &&
+        (iface->config.signal_spin_time > 0)) {
+        /* Poll the FIFO for a short while before going to sleep, so a message
+         * which arrives meanwhile does not cost a signal and a wakeup. If the
+         * FIFO is still armed, a previous call already polled it and no
+         * message arrived since then. */
+        spin_end = ucs_get_time() + iface->config.signal_spin_time;
+        while (((head & ~UCT_MM_IFACE_FIFO_HEAD_EVENT_ARMED) <=
+                iface->read_index) &&
+               (ucs_get_time() < spin_end)) {
+            head = iface->recv_fifo_ctl->head;
+        }
+    }
+
     if ((head & ~UCT_MM_IFACE_FIFO_HEAD_EVENT_ARMED) > iface->read_index) {
         /* head element was not read yet */
         ucs_trace("iface %p: cannot arm, head %" PRIu64 " read_index %" PRIu64,
@@ -434,6 +498,8 @@ uct_mm_iface_event_fd_arm(uct_iface_h tl_iface, unsigned events)
         return UCS_ERR_BUSY;
     }
 
+    /* Make the next sender which writes to the FIFO signal the receiver */
+
     if (!(head & UCT_MM_IFACE_FIFO_HEAD_EVENT_ARMED)) {
         /* Try to mark the head index as armed in an atomic way; fail if any
            sender managed to update the head at the same time */
@@ -450,7 +516,22 @@ uct_mm_iface_event_fd_arm(uct_iface_h tl_iface, unsigned events)
         }
     }
 
-    /* check for pending events */
+    /* check for pending events; the eventfd counter accumulates all signals
+     * since it was last read, so a single read clears them */
+    if (iface->signal_eventfd >= 0) {
+        ret = read(iface->signal_eventfd, &value, sizeof(value));
+        if (ret > 0) {
+            ucs_trace("iface %p: cannot arm, got %" PRIu64 " signals", iface,
+                      value);
+            return UCS_ERR_BUSY;
+        } else if (errno == EINTR) {
+            return UCS_ERR_BUSY;
+        } else if (errno != EAGAIN) {
+            ucs_error("iface %p: failed to read from eventfd: %m", iface);
+            return UCS_ERR_IO_ERROR;
+        }
+    }
+
     ret = recvfrom(iface->signal_fd, &dummy, sizeof(dummy), 0, NULL, 0);
     if (ret > 0) {
         ucs_trace("iface %p: cannot arm, got a signal", iface);
@@ -511,6 +592,20 @@ static uct_iface_ops_t uct_mm_iface_ops = {
     .iface_is_reachable       = uct_base_iface_is_reachable
 };
 
+static ucs_status_t
+uct_mm_iface_calib_copy(void *arg, void *dst, const void *src, size_t length)
+{
+    memcpy(dst, src, length);
+    return UCS_OK;
+}
+
+/* All mm transports copy data by the CPU from and to the shared segments */
+static const uct_sm_calib_ops_t uct_mm_iface_calib_ops = {
+    .init    = NULL,
+    .copy    = uct_mm_iface_calib_copy,
+    .cleanup = NULL
+};
+
 static ucs_status_t
 uct_mm_estimate_perf(uct_iface_h tl_iface, uct_perf_attr_t *perf_attr)
 {
@@ -518,10 +613,17 @@ uct_mm_estimate_perf(uct_iface_h tl_iface, uct_perf_attr_t *perf_attr)
     uct_ep_operation_t op = UCT_ATTR_VALUE(PERF, perf_attr, operation,
                                            OPERATION, UCT_EP_OP_LAST);
     double short_overhead, am_overhead;
+    const uct_sm_calib_result_t *calib;
 
     if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_BANDWIDTH) {
-        perf_attr->bandwidth.shared = 0;
-        perf_attr->bandwidth.dedicated = iface->super.config.bandwidth;
+        /* Measured bandwidth is used only for local estimations, since
+         * iface_query() values must be the same on all peers */
+        calib = uct_sm_iface_calib(&iface->super, "memcpy",
+                                   &uct_mm_iface_calib_ops, NULL);
+        perf_attr->bandwidth.shared    = 0;
+        perf_attr->bandwidth.dedicated = uct_mm_iface_bandwidth(
+                iface, (calib != NULL) ? calib->bandwidth :
+                                         iface->super.config.bandwidth);
     }
 
     switch (ucs_arch_get_cpu_vendor()) {
@@ -568,7 +670,7 @@ uct_mm_estimate_perf(uct_iface_h tl_iface, uct_perf_attr_t *perf_attr)
     }
 
     if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_LATENCY) {
-        perf_attr->latency = UCT_MM_IFACE_LATENCY;
+        perf_attr->latency = uct_mm_iface_latency(iface);
     }
 
     if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_MAX_INFLIGHT_EPS) {
@@ -588,6 +690,31 @@ static uct_iface_internal_ops_t uct_mm_iface_internal_ops = {
     .ep_is_connected       = uct_mm_ep_is_connected
 };
 
+static void uct_mm_iface_numa_bind(uct_mm_iface_t *iface, void *address,
+                                   size_t length, const char *name)
+{
+    size_t page_size = ucs_get_page_size();
+    ucs_status_t status;
+    void *start;
+
+    if ((iface->config.numa_policy == UCS_NUMA_POLICY_DEFAULT) ||
+        (iface->config.numa_node == UCS_NUMA_NODE_UNDEFINED)) {
+        return;
+    }
+
+    start  = ucs_align_down_pow2_ptr(address, page_size);
+    length = ucs_align_up_pow2(UCS_PTR_BYTE_DIFF(start, address) + length,
+                               page_size);
+    status = ucs_numa_mem_bind(start, length, iface->config.numa_policy,
+                               iface->config.numa_node);
+    if (status != UCS_OK) {
+        ucs_diag("failed to apply NUMA policy '%s' node %d to %s %p length "
+                 "%zu: %s", ucs_numa_policy_names[iface->config.numa_policy],
+                 iface->config.numa_node, name, start, length,
+                 ucs_status_string(status));
+    }
+}
+
 static void uct_mm_iface_recv_desc_init(uct_iface_h tl_iface, void *obj,
                                         uct_mem_h memh)
 {
@@ -604,6 +731,13 @@ static void uct_mm_iface_recv_desc_init(uct_iface_h tl_iface, void *obj,
         return;
     }
 
+    if (seg != iface->last_bound_seg) {
+        /* First descriptor of a new chunk */
+        uct_mm_iface_numa_bind(iface, seg->address, seg->length,
+                               "mm_recv_desc");
+        iface->last_bound_seg = seg;
+    }
+
     offset = UCS_PTR_BYTE_DIFF(seg->address, desc + 1) + iface->rx_headroom;
     ucs_assert(offset <= UINT_MAX);
 
@@ -704,14 +838,92 @@ err:
     return status;
 }
 
+static ucs_status_t uct_mm_iface_create_signal_eventfd(uct_mm_iface_t *iface)
+{
+    ucs_status_t status;
+
+    iface->signal_eventfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (iface->signal_eventfd < 0) {
+        ucs_error("failed to create eventfd for signal: %m");
+        status = UCS_ERR_IO_ERROR;
+        goto err;
+    }
+
+    /* Senders which are not able to duplicate the eventfd keep signaling the
+     * unix domain socket, so wait for both of them */
+    status = ucs_event_set_create(&iface->signal_event_set);
+    if (status != UCS_OK) {
+        goto err_close;
+    }
+
+    status = ucs_event_set_add(iface->signal_event_set, iface->signal_fd,
+                               UCS_EVENT_SET_EVREAD, NULL);
+    if (status != UCS_OK) {
+        goto err_cleanup_event_set;
+    }
+
+    status = ucs_event_set_add(iface->signal_event_set, iface->signal_eventfd,
+                               UCS_EVENT_SET_EVREAD, NULL);
+    if (status != UCS_OK) {
+        goto err_cleanup_event_set;
+    }
+
+    iface->recv_fifo_ctl->signal_eventfd = iface->signal_eventfd;
+    return UCS_OK;
+
+err_cleanup_event_set:
+    ucs_event_set_cleanup(iface->signal_event_set);
+err_close:
+    close(iface->signal_eventfd);
+err:
+    iface->signal_eventfd   = -1;
+    iface->signal_event_set = NULL;
+    return status;
+}
+
+static void uct_mm_iface_close_signal_fds(uct_mm_iface_t *iface)
+{
+    if (iface->signal_event_set != NULL) {
+        ucs_event_set_cleanup(iface->signal_event_set);
+        close(iface->signal_eventfd);
+    }
+
+    close(iface->signal_fd);
+}
+
 static void uct_mm_iface_log_created(uct_mm_iface_t *iface)
 {
     uct_mm_seg_t *seg = iface->recv_fifo_mem.memh;
 
     ucs_debug("created mm iface %p FIFO id 0x%"PRIx64
-              " va %p size %zu (%u x %u elems)",
+              " va %p size %zu (%u x %u elems) numa node %d",
               iface, seg->seg_id, seg->address, seg->length,
-              iface->config.fifo_elem_size, iface->config.fifo_size);
+              iface->config.fifo_elem_size, iface->config.fifo_size,
+              iface->config.numa_node);
+}
+
+void uct_mm_iface_numa_update_distance(uct_mm_iface_t *iface,
+                                       const void *remote_fifo)
+{
+    ucs_numa_node_t fifo_node;
+
+    if ((iface->config.numa_node == UCS_NUMA_NODE_UNDEFINED) ||
+        (ucs_numa_num_configured_nodes() <= 1)) {
+        return;
+    }
+
+    /* The peer FIFO resides on the node of the peer, or on another node if
+     * the peer placement policy could not be applied */
+    fifo_node = ucs_numa_node_of_address(remote_fifo);
+    if ((fifo_node == UCS_NUMA_NODE_UNDEFINED) ||
+        (fifo_node >= ucs_numa_num_configured_nodes())) {
+        return;
+    }
+
+    iface->config.numa_distance = ucs_max(iface->config.numa_distance,
+                                          ucs_numa_distance(
+                                                  iface->config.numa_node,
+                                                  fifo_node));
 }
 
 static UCS_CLASS_INIT_FUNC(uct_mm_iface_t, uct_md_h md, uct_worker_h worker,
@@ -780,6 +992,12 @@ static UCS_CLASS_INIT_FUNC(uct_mm_iface_t, uct_md_h md, uct_worker_h worker,
                                       UCT_IFACE_PARAM_FIELD_RX_HEADROOM) ?
                                      params->rx_headroom : 0;
     self->release_desc.cb          = uct_mm_iface_release_desc;
+    self->last_bound_seg           = NULL;
+    self->config.numa_policy       = mm_config->numa_policy;
+    self->config.numa_node         = ucs_numa_node_of_current_cpu();
+    self->config.numa_distance     = UCS_NUMA_MIN_DISTANCE;
+    self->config.signal_spin_time  = ucs_time_from_sec(
+                                             mm_config->signal_spin_time);
 
     /* Allocate the receive FIFO */
     status = uct_iface_mem_alloc(&self->super.super.super,
@@ -791,11 +1009,16 @@ static UCS_CLASS_INIT_FUNC(uct_mm_iface_t, uct_md_h md, uct_worker_h worker,
         return status;
     }
 
+    /* Place the FIFO before touching it, so it is polled from local memory */
+    uct_mm_iface_numa_bind(self, self->recv_fifo_mem.address,
+                           self->recv_fifo_mem.length, "mm_recv_fifo");
     uct_mm_iface_set_fifo_ptrs(self->recv_fifo_mem.address,
                                &self->recv_fifo_ctl, &self->recv_fifo_elems);
     self->recv_fifo_ctl->head = 0;
     self->recv_fifo_ctl->tail = 0;
     self->recv_fifo_ctl->pid  = getpid();
+    self->recv_fifo_ctl->pid_ns = ucs_sys_get_ns(UCS_SYS_NS_TYPE_PID);
+    self->recv_fifo_ctl->signal_eventfd = -1;
     self->read_index          = 0;
     self->read_index_elem     = UCT_MM_IFACE_GET_FIFO_ELEM(self,
                                                            self->recv_fifo_elems,
@@ -808,6 +1031,15 @@ static UCS_CLASS_INIT_FUNC(uct_mm_iface_t, uct_md_h md, uct_worker_h worker,
         goto err_free_fifo;
     }
 
+    self->signal_eventfd   = -1;
+    self->signal_event_set = NULL;
+    if (mm_config->signal_eventfd) {
+        status = uct_mm_iface_create_signal_eventfd(self);
+        if (status != UCS_OK) {
+            goto err_close_signal_fd;
+        }
+    }
+
     status = uct_iface_param_am_alignment(params, self->config.seg_size,
                                           payload_offset, payload_offset,
                                           &alignment, &align_offset);
@@ -859,7 +1091,7 @@ destroy_descs:
 destroy_recv_mpool:
     ucs_mpool_cleanup(&self->recv_desc_mp, 1);
 err_close_signal_fd:
-    close(self->signal_fd);
+    uct_mm_iface_close_signal_fds(self);
 err_free_fifo:
     uct_iface_mem_free(&self->recv_fifo_mem);
 err:
@@ -877,7 +1109,7 @@ static UCS_CLASS_CLEANUP_FUNC(uct_mm_iface_t)
 
     ucs_mpool_put(self->last_recv_desc);
     ucs_mpool_cleanup(&self->recv_desc_mp, 1);
-    close(self->signal_fd);
+    uct_mm_iface_close_signal_fds(self);
     uct_iface_mem_free(&self->recv_fifo_mem);
     ucs_arbiter_cleanup(&self->arbiter);
 }
@@ -15,7 +15,9 @@
 #include <ucs/arch/cpu.h>
 #include <ucs/debug/memtrack_int.h>
 #include <ucs/datastruct/arbiter.h>
+#include <ucs/memory/numa.h>
 #include <ucs/sys/compiler.h>
+#include <ucs/sys/event_set.h>
 #include <ucs/sys/sys.h>
 #include <sys/shm.h>
 #include <sys/un.h>
@@ -102,6 +104,9 @@ typedef struct uct_mm_iface_config {
                                                    * shared memory buffers */
     unsigned                 fifo_elem_size;      /* Size of the FIFO element size */
     int                      error_handling; /* Exposing of error handling cap */
+    ucs_numa_policy_t        numa_policy;    /* Placement of receive buffers */
+    int                      signal_eventfd; /* Receive signals on an eventfd */
+    double                   signal_spin_time; /* Polling time before arming */
     uct_iface_mpool_config_t mp;
 } uct_mm_iface_config_t;
 
@@ -130,6 +135,9 @@ typedef struct uct_mm_fifo_ctl {
     /* 2nd cacheline */
     volatile uint64_t         tail;           /* How much was consumed */
     pid_t                     pid;            /* Process owner pid */
+    int                       signal_eventfd; /* Owner's eventfd number for
+                                                 signaling, -1 if not used */
+    ucs_sys_ns_t              pid_ns;         /* Owner's PID namespace */
 } UCS_S_PACKED UCS_V_ALIGNED(UCS_SYS_CACHE_LINE_SIZE) uct_mm_fifo_ctl_t;
 
 
@@ -207,8 +215,14 @@ typedef struct uct_mm_iface {
 
     ucs_mpool_t             recv_desc_mp;
     uct_mm_recv_desc_t      *last_recv_desc;  /* next receive descriptor to use */
+    uct_mm_seg_t            *last_bound_seg;  /* last receive descriptors chunk
+                                                 placed on the NUMA node */
 
     int                     signal_fd;        /* Unix socket for receiving remote signal */
+    int                     signal_eventfd;   /* eventfd for receiving remote
+                                                 signal, -1 if not used */
+    ucs_sys_event_set_t     *signal_event_set;/* Both signal descriptors, if
+                                                 the eventfd is used */
 
     size_t                  rx_headroom;
     ucs_arbiter_t           arbiter;
@@ -220,6 +234,13 @@ typedef struct uct_mm_iface {
         unsigned            seg_size;         /* size of the receive descriptor (for payload)*/
         unsigned            fifo_max_poll;
         uint64_t            extra_cap_flags;
+        ucs_numa_policy_t   numa_policy;
+        ucs_numa_node_t     numa_node;        /* node to place receive memory */
+        ucs_numa_distance_t numa_distance;    /* largest distance from the
+                                                 creating thread to a peer
+                                                 FIFO */
+        ucs_time_t          signal_spin_time; /* FIFO polling time before
+                                                 arming the event */
     } config;
 } uct_mm_iface_t;
 
@@ -287,6 +308,9 @@ UCS_CLASS_DECLARE_NEW_FUNC(uct_mm_iface_t, uct_iface_t, uct_md_h, uct_worker_h,
                            const uct_iface_params_t*, const uct_iface_config_t*);
 
 
+void uct_mm_iface_numa_update_distance(uct_mm_iface_t *iface,
+                                       const void *remote_fifo);
+
 void uct_mm_iface_release_desc(uct_recv_desc_t *self, void *desc);
 
 
@@ -48,13 +48,15 @@
 #define UCT_POSIX_SHM_OPEN_DIR          "/dev/shm"       /* directory path for shm_open() */
 #define UCT_POSIX_FILE_FMT              "/ucx_shm_posix_%"PRIx64
 #define UCT_POSIX_PROCFS_FILE_FMT       "/proc/%d/fd/%d" /* file pattern for procfs mode */
+#define UCT_POSIX_MEMFD_NAME            "ucx_shm_posix"  /* name of memfd segments */
 
 
 typedef struct uct_posix_md_config {
-    uct_mm_md_config_t super;
-    char               *dir;
-    int                use_proc_link;
-    size_t             shm_min_size;
+    uct_mm_md_config_t       super;
+    char                     *dir;
+    int                      use_proc_link;
+    size_t                   shm_min_size;
+    ucs_ternary_auto_value_t memfd_mode;
 } uct_posix_md_config_t;
 
 typedef struct uct_posix_packed_rkey {
@@ -87,6 +89,17 @@ static ucs_config_field_t uct_posix_md_config_table[] = {
      " n   - Use original file path to share posix file.\n",
      ucs_offsetof(uct_posix_md_config_t, use_proc_link), UCS_CONFIG_TYPE_BOOL},
 
+    {"MEMFD", "try",
+     "Create shared memory segments by memfd_create() and share them using\n"
+     "/proc/<pid>/fd/<fd>, so they do not occupy the backing directory. When\n"
+     "huge pages are enabled by HUGETLB_MODE, the segments are allocated with\n"
+     "MFD_HUGETLB, or advised to use transparent huge pages. Requires\n"
+     "USE_PROC_LINK=y. Possible values are:\n"
+     " y   - Use memfd_create() only.\n"
+     " n   - Use shm_open() or open() in DIR.\n"
+     " try - Try to use memfd_create() and if it fails, fall back to DIR.",
+     ucs_offsetof(uct_posix_md_config_t, memfd_mode), UCS_CONFIG_TYPE_TERNARY},
+
     {NULL}
 };
 
@@ -172,6 +185,13 @@ static void uct_posix_mmid_procfs_unpack(uint64_t mmid, int *pid_p, int *fd_p)
     *pid_p = mmid & UCS_MASK(UCT_POSIX_PROCFS_MMID_PID_BITS);
 }
 
+static uint64_t uct_posix_seg_id_procfs(int fd)
+{
+    return uct_posix_mmid_procfs_pack(fd) | UCT_POSIX_SEG_FLAG_PROCFS |
+           (ucs_sys_ns_is_default(UCS_SYS_NS_TYPE_PID) ? 0 :
+            UCT_POSIX_SEG_FLAG_PID_NS);
+}
+
 static ucs_status_t uct_posix_test_mem(int shm_fd, size_t length)
 {
     const size_t chunk_size = 64 * UCS_KBYTE;
@@ -476,6 +496,131 @@ uct_posix_segment_open(uct_mm_md_t *md, uct_mm_seg_id_t *seg_id_p, int *fd_p)
     }
 }
 
+static void uct_posix_madvise_thp(const uct_posix_md_config_t *posix_config,
+                                  void *address, size_t length)
+{
+#ifdef MADV_HUGEPAGE
+    ssize_t huge_page_size = ucs_get_huge_page_size();
+
+    if ((posix_config->super.hugetlb_mode == UCS_NO) ||
+        (huge_page_size <= 0) || (length < huge_page_size) ||
+        !ucs_is_thp_enabled()) {
+        return;
+    }
+
+    if (madvise(address, length, MADV_HUGEPAGE) != 0) {
+        ucs_debug("madvise(address=%p, length=%zu, HUGEPAGE) failed: %m",
+                  address, length);
+    }
+#endif
+}
+
+#if HAVE_DECL_MEMFD_CREATE
+static ucs_status_t
+uct_posix_memfd_create(unsigned memfd_flags, size_t length,
+                       ucs_log_level_t err_level, int *fd_p)
+{
+    int fd;
+
+    fd = memfd_create(UCT_POSIX_MEMFD_NAME, memfd_flags);
+    if (fd < 0) {
+        ucs_log(err_level, "memfd_create(flags=0x%x) failed: %m", memfd_flags);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    if (ftruncate(fd, length) != 0) {
+        ucs_log(err_level, "ftruncate(fd=%d, length=%zu) failed: %m", fd,
+                length);
+        close(fd);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    *fd_p = fd;
+    return UCS_OK;
+}
+#endif
+
+/* Allocate a segment backed by an anonymous memfd file, which is shared with
+ * the peers by its procfs link */
+static ucs_status_t
+uct_posix_memfd_alloc(uct_mm_md_t *md, uct_mm_seg_t *seg, int mmap_flags,
+                      const char *alloc_name, int *fd_p)
+{
+    uct_posix_md_config_t *posix_config = ucs_derived_of(md->config,
+                                                         uct_posix_md_config_t);
+    ucs_log_level_t err_level           =
+            (posix_config->memfd_mode == UCS_YES) ? UCS_LOG_LEVEL_ERROR :
+                                                    UCS_LOG_LEVEL_DEBUG;
+#if HAVE_DECL_MEMFD_CREATE
+    size_t length = ucs_align_up_pow2(seg->length, ucs_get_page_size());
+    ucs_status_t status;
+    int fd;
+#  if HAVE_DECL_MFD_HUGETLB
+    ssize_t huge_page_size;
+    size_t huge_length;
+#  endif
+#endif
+
+    if (!posix_config->use_proc_link) {
+        ucs_log(err_level, "memfd shared memory requires USE_PROC_LINK=y");
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+#if HAVE_DECL_MEMFD_CREATE
+#  if HAVE_DECL_MFD_HUGETLB
+    huge_page_size = ucs_get_huge_page_size();
+    if ((posix_config->super.hugetlb_mode != UCS_NO) &&
+        !(mmap_flags & MAP_FIXED) && (huge_page_size > 0)) {
+        huge_length = ucs_align_up_pow2(length, huge_page_size);
+        if ((huge_length <= (2 * length)) &&
+            (uct_posix_memfd_create(MFD_HUGETLB, huge_length,
+                                    UCS_LOG_LEVEL_DEBUG, &fd) == UCS_OK)) {
+            status = uct_posix_mmap(&seg->address, &seg->length,
+                                    mmap_flags | MAP_HUGETLB, fd, alloc_name,
+                                    UCS_LOG_LEVEL_DEBUG);
+            if (status == UCS_OK) {
+                seg->seg_id = UCT_POSIX_SEG_FLAG_HUGETLB |
+                              uct_posix_seg_id_procfs(fd);
+                goto out;
+            }
+
+            close(fd);
+        }
+    }
+#  endif
+
+    if (posix_config->super.hugetlb_mode == UCS_YES) {
+        ucs_log(err_level, "could not allocate memfd shared memory of %zu "
+                "bytes using huge pages", length);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    status = uct_posix_memfd_create(0, length, err_level, &fd);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    status = uct_posix_mmap(&seg->address, &seg->length, mmap_flags, fd,
+                            alloc_name, UCS_LOG_LEVEL_ERROR);
+    if (status != UCS_OK) {
+        close(fd);
+        return status;
+    }
+
+    /* Pages are populated on first touch, so they can be transparent huge
+     * pages if shmem THP is enabled in "advise" mode */
+    uct_posix_madvise_thp(posix_config, seg->address, seg->length);
+    seg->seg_id = uct_posix_seg_id_procfs(fd);
+
+out:
+    *fd_p = fd;
+    return UCS_OK;
+#else
+    ucs_log(err_level, "memfd_create() is not supported on the system");
+    return UCS_ERR_UNSUPPORTED;
+#endif
+}
+
 static ucs_status_t
 uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
                     ucs_memory_type_t mem_type, unsigned flags,
@@ -488,7 +633,6 @@ uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
     uct_mm_seg_t *seg;
     int force_hugetlb;
     int mmap_flags;
-    void *address;
     int fd;
 
     if (mem_type != UCS_MEMORY_TYPE_HOST) {
@@ -500,6 +644,22 @@ uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
         goto err;
     }
 
+    if (flags & UCT_MD_MEM_FLAG_FIXED) {
+        mmap_flags   = MAP_FIXED;
+    } else {
+        seg->address = NULL;
+        mmap_flags   = 0;
+    }
+
+    if (posix_config->memfd_mode != UCS_NO) {
+        status = uct_posix_memfd_alloc(md, seg, mmap_flags, alloc_name, &fd);
+        if (status == UCS_OK) {
+            goto out;
+        } else if (posix_config->memfd_mode == UCS_YES) {
+            goto err_free_seg;
+        }
+    }
+
     status = uct_posix_segment_open(md, &seg->seg_id, &fd);
     if (status != UCS_OK) {
         goto err_free_seg;
@@ -521,23 +681,12 @@ uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
         }
 
         /* Replace mmid by pid+fd. Keep previous SHM_OPEN flag for mkey_pack() */
-        seg->seg_id = uct_posix_mmid_procfs_pack(fd) |
-                      (seg->seg_id & UCT_POSIX_SEG_FLAG_SHM_OPEN) |
-                      UCT_POSIX_SEG_FLAG_PROCFS |
-                      (ucs_sys_ns_is_default(UCS_SYS_NS_TYPE_PID) ? 0 :
-                       UCT_POSIX_SEG_FLAG_PID_NS);
+        seg->seg_id = uct_posix_seg_id_procfs(fd) |
+                      (seg->seg_id & UCT_POSIX_SEG_FLAG_SHM_OPEN);
     }
 
-    /* mmap the shared memory segment that was created by shm_open */
-    if (flags & UCT_MD_MEM_FLAG_FIXED) {
-        mmap_flags   = MAP_FIXED;
-    } else {
-        seg->address = NULL;
-        mmap_flags   = 0;
-    }
-
-    /* try HUGETLB mmap */
-    address = MAP_FAILED;
+    /* mmap the shared memory segment that was created by shm_open, try
+     * HUGETLB mmap first */
     if (posix_config->super.hugetlb_mode != UCS_NO) {
         force_hugetlb = (posix_config->super.hugetlb_mode == UCS_YES);
 #ifdef MAP_HUGETLB
@@ -560,7 +709,7 @@ uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
     }
 
     /* fallback to regular mmap */
-    if (address == MAP_FAILED) {
+    if (!(seg->seg_id & UCT_POSIX_SEG_FLAG_HUGETLB)) {
         ucs_assert(posix_config->super.hugetlb_mode != UCS_YES);
         status = uct_posix_mmap(&seg->address, &seg->length, mmap_flags, fd,
                                 alloc_name, UCS_LOG_LEVEL_ERROR);
@@ -569,15 +718,16 @@ uct_posix_mem_alloc(uct_md_h tl_md, size_t *length_p, void **address_p,
         }
     }
 
-    /* create new memory segment */
-    ucs_debug("allocated posix shared memory at %p length %zu", seg->address,
-              seg->length);
-
     if (!posix_config->use_proc_link) {
         /* closing the file here since the peers will open it by file system path */
         close(fd);
     }
 
+out:
+    /* create new memory segment */
+    ucs_debug("allocated posix shared memory at %p length %zu seg_id 0x%"
+              PRIx64, seg->address, seg->length, seg->seg_id);
+
     *address_p = seg->address;
     *length_p  = seg->length;
      *memh_p   = seg;
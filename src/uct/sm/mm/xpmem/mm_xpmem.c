@@ -19,22 +19,47 @@
 #include <ucs/type/spinlock.h>
 #include <ucs/memory/rcache.h>
 #include <ucs/debug/log.h>
+#include <ucs/stats/stats.h>
+#include <ucs/time/time.h>
 #include <uct/api/v2/uct_v2.h>
 
 
+/* The packed remote key is followed by uct_xpmem_packed_rkey_ext_t. Set in the
+ * packed segment id, which is never negative. */
+#define UCT_XPMEM_RKEY_FLAG_EXT   UCS_BIT(63)
+
+
 /* XPMEM memory domain configuration */
 typedef struct uct_xpmem_md_config {
     uct_mm_md_config_t      super;
+    int                     attach_vma;   /* Export the whole VMA of a buffer */
+    size_t                  prefault_max; /* Pre-fault limit for a new attach */
 } uct_xpmem_md_config_t;
 
+/* XPMEM attachment statistics */
+enum {
+    UCT_XPMEM_STAT_ATTACH,
+    UCT_XPMEM_STAT_ATTACH_NSEC,
+    UCT_XPMEM_STAT_PREFAULT_BYTES,
+    UCT_XPMEM_STAT_LAST
+};
+
 /* Remote process memory */
 typedef struct uct_xpmem_remote_mem {
     xpmem_apid_t            apid;
     xpmem_segid_t           xsegid;
     ucs_rcache_t            *rcache;
     int                     refcount;
+    UCS_STATS_NODE_DECLARE(stats)
 } uct_xpmem_remote_mem_t;
 
+/* Registered local memory */
+typedef struct uct_xpmem_seg {
+    uct_mm_seg_t            super;
+    uintptr_t               attach_start; /* Range exposed in the remote key */
+    uintptr_t               attach_end;
+} uct_xpmem_seg_t;
+
 /* Cache entry for remote memory region */
 typedef struct uct_xpmem_remote_region {
     ucs_rcache_region_t     super;
@@ -47,11 +72,34 @@ typedef struct uct_xpmem_iface_addr {
 } UCS_S_PACKED uct_xpmem_iface_addr_t;
 
 typedef struct uct_xpmem_packed_rkey {
-    xpmem_segid_t           xsegid;
-    uintptr_t               address;
+    xpmem_segid_t           xsegid;       /* Segment id and flags */
+    uintptr_t               address;      /* Registered range */
     size_t                  length;
 } UCS_S_PACKED uct_xpmem_packed_rkey_t;
 
+/* Remote key extension, packed only if enabled by the memory domain
+ * configuration, so that peers which do not support it can still unpack the
+ * keys of the default configuration */
+typedef struct uct_xpmem_packed_rkey_ext {
+    uintptr_t               attach_address; /* Range to attach, contains the
+                                               registered range */
+    size_t                  attach_length;
+    size_t                  prefault_length; /* How much of the registered
+                                                range to pre-fault */
+} UCS_S_PACKED uct_xpmem_packed_rkey_ext_t;
+
+/* Argument of the attachment cache memory registration callback */
+typedef struct uct_xpmem_attach_arg {
+    uintptr_t               prefault_start;
+    size_t                  prefault_length;
+} uct_xpmem_attach_arg_t;
+
+/* Context of looking up the VMA which contains a registered buffer */
+typedef struct uct_xpmem_vma_ctx {
+    uintptr_t               start;
+    uintptr_t               end;
+} uct_xpmem_vma_ctx_t;
+
 KHASH_INIT(xpmem_remote_mem, xpmem_segid_t, uct_xpmem_remote_mem_t*, 1,
            kh_int64_hash_func, kh_int64_hash_equal)
 
@@ -68,9 +116,37 @@ static ucs_config_field_t uct_xpmem_md_config_table[] = {
    ucs_offsetof(uct_xpmem_md_config_t, super),
    UCS_CONFIG_TYPE_TABLE(uct_mm_md_config_table)},
 
+  {"ATTACH_VMA", "n",
+   "Make the remote key of a registered buffer cover the whole virtual memory\n"
+   "area which contains it, so that a peer attaches the area once and serves\n"
+   "other buffers from the same area from its attachment cache.\n"
+   "Enabling it or PREFAULT_MAX extends the remote key, which requires all\n"
+   "peers to support the extended format.",
+   ucs_offsetof(uct_xpmem_md_config_t, attach_vma), UCS_CONFIG_TYPE_BOOL},
+
+  {"PREFAULT_MAX", "0",
+   "Maximal number of bytes of a registered buffer which a peer faults in when\n"
+   "it first attaches the buffer by its remote key, moving the page fault cost\n"
+   "out of the first access. 0 disables pre-faulting.",
+   ucs_offsetof(uct_xpmem_md_config_t, prefault_max),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
   {NULL}
 };
 
+#ifdef ENABLE_STATS
+static ucs_stats_class_t uct_xpmem_remote_mem_stats_class = {
+    .name          = "xpmem_remote_mem",
+    .num_counters  = UCT_XPMEM_STAT_LAST,
+    .class_id      = UCS_STATS_CLASS_ID_INVALID,
+    .counter_names = {
+        [UCT_XPMEM_STAT_ATTACH]         = "attach",
+        [UCT_XPMEM_STAT_ATTACH_NSEC]    = "attach_nsec",
+        [UCT_XPMEM_STAT_PREFAULT_BYTES] = "prefault_bytes"
+    }
+};
+#endif
+
 static ucs_config_field_t uct_xpmem_iface_config_table[] = {
   {"MM_", "", NULL, 0, UCS_CONFIG_TYPE_TABLE(uct_mm_iface_config_table)},
 
@@ -95,6 +171,15 @@ static ucs_status_t uct_xpmem_query(int *attach_shm_file_p)
     return UCS_OK;
 }
 
+static int uct_xpmem_md_rkey_ext(uct_md_h md)
+{
+    uct_mm_md_t *mm_md               = ucs_derived_of(md, uct_mm_md_t);
+    uct_xpmem_md_config_t *md_config = ucs_derived_of(mm_md->config,
+                                                      uct_xpmem_md_config_t);
+
+    return md_config->attach_vma || (md_config->prefault_max > 0);
+}
+
 static ucs_status_t uct_xpmem_md_query(uct_md_h md, uct_md_attr_v2_t *md_attr)
 {
     uct_mm_md_query(md, md_attr, 0);
@@ -105,6 +190,9 @@ static ucs_status_t uct_xpmem_md_query(uct_md_h md, uct_md_attr_v2_t *md_attr)
     md_attr->reg_mem_types          = UCS_BIT(UCS_MEMORY_TYPE_HOST);
     md_attr->reg_nonblock_mem_types = UCS_BIT(UCS_MEMORY_TYPE_HOST);
     md_attr->rkey_packed_size       = sizeof(uct_xpmem_packed_rkey_t);
+    if (uct_xpmem_md_rkey_ext(md)) {
+        md_attr->rkey_packed_size  += sizeof(uct_xpmem_packed_rkey_ext_t);
+    }
 
     return UCS_OK;
 }
@@ -115,6 +203,38 @@ uct_xpmem_rcache_region_length(uct_xpmem_remote_region_t *xpmem_region)
     return xpmem_region->super.super.end - xpmem_region->super.super.start;
 }
 
+static void
+uct_xpmem_prefault(uct_xpmem_remote_mem_t *rmem,
+                   uct_xpmem_remote_region_t *xpmem_region,
+                   const uct_xpmem_attach_arg_t *attach_arg)
+{
+    size_t page_size = ucs_get_page_size();
+    uintptr_t start, end, ptr;
+    size_t length;
+
+    /* Touch only the registered buffer, since the rest of the attached range
+     * may be unmapped by the peer and would raise SIGBUS */
+    start  = ucs_max(attach_arg->prefault_start,
+                     xpmem_region->super.super.start);
+    end    = ucs_min(attach_arg->prefault_start + attach_arg->prefault_length,
+                     xpmem_region->super.super.end);
+    if (end <= start) {
+        return;
+    }
+
+    length = end - start;
+
+    ptr = (uintptr_t)xpmem_region->attach_address +
+          (start - xpmem_region->super.super.start);
+    for (end = ptr + length; ptr < end;
+         ptr = ucs_align_down_pow2(ptr, page_size) + page_size) {
+        (void)*(const volatile char*)ptr;
+    }
+
+    UCS_STATS_UPDATE_COUNTER(rmem->stats, UCT_XPMEM_STAT_PREFAULT_BYTES,
+                             length);
+}
+
 static ucs_status_t
 uct_xpmem_rcache_mem_reg(void *context, ucs_rcache_t *rcache, void *arg,
                          ucs_rcache_region_t *region, uint16_t flags)
@@ -122,6 +242,7 @@ uct_xpmem_rcache_mem_reg(void *context, ucs_rcache_t *rcache, void *arg,
     uct_xpmem_remote_mem_t    *rmem         = context;
     uct_xpmem_remote_region_t *xpmem_region =
                     ucs_derived_of(region, uct_xpmem_remote_region_t);
+    ucs_time_t UCS_V_UNUSED start_time = ucs_get_time();
     struct xpmem_addr addr;
     size_t length;
 
@@ -140,11 +261,18 @@ uct_xpmem_rcache_mem_reg(void *context, ucs_rcache_t *rcache, void *arg,
 
     xpmem_region->rmem = rmem;
 
+    VALGRIND_MAKE_MEM_DEFINED(xpmem_region->attach_address, length);
+
+    if (arg != NULL) {
+        uct_xpmem_prefault(rmem, xpmem_region, arg);
+    }
+
+    UCS_STATS_UPDATE_COUNTER(rmem->stats, UCT_XPMEM_STAT_ATTACH, 1);
+    UCS_STATS_UPDATE_TIME(rmem->stats, UCT_XPMEM_STAT_ATTACH_NSEC, start_time);
+
     ucs_trace("xpmem attached apid 0x%lx offset 0x%lx length %zu at %p",
               (unsigned long)addr.apid, addr.offset, length,
               xpmem_region->attach_address);
-
-    VALGRIND_MAKE_MEM_DEFINED(xpmem_region->attach_address, length);
     return UCS_OK;
 }
 
@@ -239,12 +367,20 @@ uct_xpmem_rmem_add(xpmem_segid_t xsegid, uct_xpmem_remote_mem_t **rmem_p)
     rmem->refcount = 0;
     rmem->xsegid   = xsegid;
 
+    status = UCS_STATS_NODE_ALLOC(&rmem->stats,
+                                  &uct_xpmem_remote_mem_stats_class,
+                                  ucs_stats_get_root(), "-0x%lx",
+                                  (unsigned long)xsegid);
+    if (status != UCS_OK) {
+        goto err_free;
+    }
+
     rmem->apid = xpmem_get(xsegid, XPMEM_RDWR, XPMEM_PERMIT_MODE, NULL);
     VALGRIND_MAKE_MEM_DEFINED(&rmem->apid, sizeof(rmem->apid));
     if (rmem->apid < 0) {
         ucs_error("xpmem_get(segid=0x%lx) failed: %m", (unsigned long)xsegid);
         status = UCS_ERR_SHMEM_SEGMENT;
-        goto err_free;
+        goto err_free_stats;
     }
 
     rcache_params.region_struct_size = sizeof(uct_xpmem_remote_region_t);
@@ -279,6 +415,8 @@ uct_xpmem_rmem_add(xpmem_segid_t xsegid, uct_xpmem_remote_mem_t **rmem_p)
 
 err_release_seg:
     xpmem_release(rmem->apid);
+err_free_stats:
+    UCS_STATS_NODE_FREE(rmem->stats);
 err_free:
     ucs_free(rmem);
 err:
@@ -309,6 +447,7 @@ uct_xpmem_rmem_del(uct_xpmem_remote_mem_t *rmem)
                  (unsigned long)rmem->apid);
     }
 
+    UCS_STATS_NODE_FREE(rmem->stats);
     ucs_free(rmem);
 }
 
@@ -352,7 +491,9 @@ static void uct_xpmem_rmem_put(uct_xpmem_remote_mem_t *rmem)
 
 static ucs_status_t
 uct_xpmem_mem_attach_common(xpmem_segid_t xsegid, uintptr_t remote_address,
-                            size_t length, uct_xpmem_remote_region_t **region_p)
+                            size_t length,
+                            const uct_xpmem_attach_arg_t *attach_arg,
+                            uct_xpmem_remote_region_t **region_p)
 {
     ucs_rcache_region_t *rcache_region;
     uct_xpmem_remote_mem_t *rmem;
@@ -368,8 +509,8 @@ uct_xpmem_mem_attach_common(xpmem_segid_t xsegid, uintptr_t remote_address,
     end   = ucs_align_up_pow2  (remote_address + length, ucs_get_page_size());
 
     status = ucs_rcache_get(rmem->rcache, (void*)start, end - start,
-			    ucs_get_page_size(), PROT_READ | PROT_WRITE, NULL,
-			    &rcache_region);
+			    ucs_get_page_size(), PROT_READ | PROT_WRITE,
+			    (void*)attach_arg, &rcache_region);
     if (status != UCS_OK) {
         goto err_rmem_put;
     }
@@ -391,20 +532,43 @@ static void uct_xpmem_mem_detach_common(uct_xpmem_remote_region_t *xpmem_region)
     uct_xpmem_rmem_put(rmem);
 }
 
+static void uct_xpmem_vma_cb(ucs_sys_vma_info_t *info, void *ctx)
+{
+    uct_xpmem_vma_ctx_t *vma = ctx;
+
+    /* Expand to the areas which overlap the registered range */
+    vma->start = ucs_min(vma->start, info->start);
+    vma->end   = ucs_max(vma->end, info->end);
+}
+
 static ucs_status_t
 uct_xmpem_mem_reg(uct_md_h md, void *address, size_t length,
                   const uct_md_mem_reg_params_t *params, uct_mem_h *memh_p)
 {
-    ucs_status_t status;
-    uct_mm_seg_t *seg;
+    uct_mm_md_t *mm_md               = ucs_derived_of(md, uct_mm_md_t);
+    uct_xpmem_md_config_t *md_config = ucs_derived_of(mm_md->config,
+                                                      uct_xpmem_md_config_t);
+    uct_xpmem_vma_ctx_t vma;
+    uct_xpmem_seg_t *seg;
+
+    seg = ucs_malloc(sizeof(*seg), "xpmem_seg");
+    if (seg == NULL) {
+        ucs_error("failed to allocate xpmem segment");
+        return UCS_ERR_NO_MEMORY;
+    }
 
-    status = uct_mm_seg_new(address, length, &seg);
-    if (status != UCS_OK) {
-        return status;
+    vma.start = (uintptr_t)address;
+    vma.end   = (uintptr_t)address + length;
+    if (md_config->attach_vma) {
+        ucs_sys_iterate_vm(address, length, uct_xpmem_vma_cb, &vma);
     }
 
-    seg->seg_id  = (uintptr_t)address; /* to be used by mem_attach */
-    *memh_p      = seg;
+    seg->super.address = address;
+    seg->super.length  = length;
+    seg->super.seg_id  = (uintptr_t)address; /* to be used by mem_attach */
+    seg->attach_start  = vma.start;
+    seg->attach_end    = vma.end;
+    *memh_p            = seg;
     return UCS_OK;
 }
 
@@ -426,12 +590,15 @@ uct_xpmem_mkey_pack(uct_md_h tl_md, uct_mem_h memh, void *address,
 		    size_t length, const uct_md_mkey_pack_params_t *params,
 		    void *mkey_buffer)
 {
-    uct_mm_seg_t                    *seg = memh;
+    uct_mm_md_t *md                      = ucs_derived_of(tl_md, uct_mm_md_t);
+    uct_xpmem_seg_t                 *seg = memh;
     uct_xpmem_packed_rkey_t *packed_rkey = mkey_buffer;
+    uct_xpmem_packed_rkey_ext_t *packed_ext;
+    uct_xpmem_md_config_t *md_config;
     xpmem_segid_t xsegid;
     ucs_status_t status;
 
-    ucs_assert((uintptr_t)seg->address == seg->seg_id); /* sanity */
+    ucs_assert((uintptr_t)seg->super.address == seg->super.seg_id); /* sanity */
 
     status = uct_xpmem_get_global_xsegid(&xsegid);
     if (status != UCS_OK) {
@@ -439,8 +606,20 @@ uct_xpmem_mkey_pack(uct_md_h tl_md, uct_mem_h memh, void *address,
     }
 
     packed_rkey->xsegid  = xsegid;
-    packed_rkey->address = (uintptr_t)seg->address;
-    packed_rkey->length  = seg->length;
+    packed_rkey->address = (uintptr_t)seg->super.address;
+    packed_rkey->length  = seg->super.length;
+    if (!uct_xpmem_md_rkey_ext(tl_md)) {
+        return UCS_OK;
+    }
+
+    md_config                   = ucs_derived_of(md->config,
+                                                 uct_xpmem_md_config_t);
+    packed_ext                  = (uct_xpmem_packed_rkey_ext_t*)(packed_rkey + 1);
+    packed_rkey->xsegid         = (uint64_t)xsegid | UCT_XPMEM_RKEY_FLAG_EXT;
+    packed_ext->attach_address  = seg->attach_start;
+    packed_ext->attach_length   = seg->attach_end - seg->attach_start;
+    packed_ext->prefault_length = ucs_min(seg->super.length,
+                                          md_config->prefault_max);
     return UCS_OK;
 }
 
@@ -468,15 +647,22 @@ static ucs_status_t uct_xpmem_mem_attach(uct_mm_md_t *md, uct_mm_seg_id_t seg_id
                                          size_t length, const void *iface_addr,
                                          uct_mm_remote_seg_t *rseg)
 {
+    uct_xpmem_md_config_t *md_config = ucs_derived_of(md->config,
+                                                      uct_xpmem_md_config_t);
     const uct_xpmem_iface_addr_t *xpmem_iface_addr = iface_addr;
     uintptr_t                       remote_address = seg_id;
     uct_xpmem_remote_region_t *xpmem_region;
+    uct_xpmem_attach_arg_t attach_arg;
     ucs_status_t status;
     ptrdiff_t offset;
 
     ucs_assert(xpmem_iface_addr != NULL);
+    attach_arg.prefault_start  = remote_address;
+    attach_arg.prefault_length = ucs_min(length, md_config->prefault_max);
+
     status = uct_xpmem_mem_attach_common(xpmem_iface_addr->xsegid,
-                                         remote_address, length, &xpmem_region);
+                                         remote_address, length, &attach_arg,
+                                         &xpmem_region);
     if (status != UCS_OK) {
         return status;
     }
@@ -504,12 +690,27 @@ uct_xpmem_rkey_unpack(uct_component_t *component, const void *rkey_buffer,
                       uct_rkey_t *rkey_p, void **handle_p)
 {
     const uct_xpmem_packed_rkey_t *packed_rkey = rkey_buffer;
+    uint64_t xsegid                            = packed_rkey->xsegid;
+    uintptr_t address                          = packed_rkey->address;
+    size_t length                              = packed_rkey->length;
+    const uct_xpmem_packed_rkey_ext_t *packed_ext;
     uct_xpmem_remote_region_t *xpmem_region;
+    uct_xpmem_attach_arg_t attach_arg;
     ucs_status_t status;
 
-    status = uct_xpmem_mem_attach_common(packed_rkey->xsegid,
-                                         packed_rkey->address,
-                                         packed_rkey->length,
+    attach_arg.prefault_start  = packed_rkey->address;
+    attach_arg.prefault_length = 0;
+
+    if (xsegid & UCT_XPMEM_RKEY_FLAG_EXT) {
+        packed_ext                 = (const uct_xpmem_packed_rkey_ext_t*)
+                                     (packed_rkey + 1);
+        xsegid                    &= ~UCT_XPMEM_RKEY_FLAG_EXT;
+        address                    = packed_ext->attach_address;
+        length                     = packed_ext->attach_length;
+        attach_arg.prefault_length = packed_ext->prefault_length;
+    }
+
+    status = uct_xpmem_mem_attach_common(xsegid, address, length, &attach_arg,
                                          &xpmem_region);
     if (status != UCS_OK) {
         return status;
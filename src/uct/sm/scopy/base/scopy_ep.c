@@ -11,6 +11,11 @@
 #include "scopy_ep.h"
 
 #include <uct/base/uct_iov.inl>
+#include <ucs/arch/atomic.h>
+#include <ucs/arch/cpu.h>
+#include <ucs/debug/memtrack_int.h>
+
+#include <sched.h>
 
 
 const char* uct_scopy_tx_op_str[] = {
@@ -25,12 +30,40 @@ UCS_CLASS_INIT_FUNC(uct_scopy_ep_t, const uct_ep_params_t *params)
     UCS_CLASS_CALL_SUPER_INIT(uct_base_ep_t, &iface->super.super);
 
     ucs_arbiter_group_init(&self->arb_group);
+    self->copy_inflight = 0;
 
     return UCS_OK;
 }
 
+static ucs_arbiter_cb_result_t
+uct_scopy_ep_purge_cb(ucs_arbiter_t *arbiter, ucs_arbiter_group_t *group,
+                      ucs_arbiter_elem_t *elem, void *arg)
+{
+    uct_scopy_tx_t *tx = ucs_container_of(elem, uct_scopy_tx_t, arb_elem);
+
+    ucs_assert((tx->chunks == NULL) || (tx->copy_pending == 0));
+    ucs_free(tx->chunks);
+    if (!tx->batched && (tx->comp != NULL)) {
+        uct_invoke_completion(tx->comp, UCS_ERR_CANCELED);
+    }
+
+    ucs_mpool_put_inline(tx);
+    return UCS_ARBITER_CB_RESULT_REMOVE_ELEM;
+}
+
 static UCS_CLASS_CLEANUP_FUNC(uct_scopy_ep_t)
 {
+    uct_scopy_iface_t *iface = ucs_derived_of(self->super.super.iface,
+                                              uct_scopy_iface_t);
+
+    /* Helper threads must not access the endpoint after it is destroyed */
+    uct_scopy_iface_copy_cancel(iface, self);
+    while (self->copy_inflight != 0) {
+        sched_yield();
+    }
+
+    ucs_arbiter_group_purge(&iface->arbiter, &self->arb_group,
+                            uct_scopy_ep_purge_cb, NULL);
     ucs_arbiter_group_cleanup(&self->arb_group);
 }
 
@@ -40,8 +73,10 @@ static UCS_F_ALWAYS_INLINE void
 uct_scopy_ep_tx_init_common(uct_scopy_tx_t *tx, uct_scopy_tx_op_t tx_op,
                             uct_completion_t *comp)
 {
-    tx->comp = comp;
-    tx->op   = tx_op;
+    tx->comp    = comp;
+    tx->op      = tx_op;
+    tx->chunks  = NULL;
+    tx->batched = 0;
     ucs_arbiter_elem_init(&tx->arb_elem);
 }
 
@@ -124,6 +159,198 @@ ucs_status_t uct_scopy_ep_get_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
                                 rkey, comp, UCT_SCOPY_TX_GET_ZCOPY);
 }
 
+static void uct_scopy_iov_iter_advance(const uct_iov_t *iov, size_t iov_cnt,
+                                       ucs_iov_iter_t *iov_iter, size_t length)
+{
+    size_t remaining;
+
+    while ((length > 0) && (iov_iter->iov_index < iov_cnt)) {
+        remaining = uct_iov_get_length(&iov[iov_iter->iov_index]) -
+                    iov_iter->buffer_offset;
+        if (remaining > length) {
+            iov_iter->buffer_offset += length;
+            return;
+        }
+
+        length                 -= remaining;
+        iov_iter->buffer_offset = 0;
+        ++iov_iter->iov_index;
+    }
+}
+
+void uct_scopy_ep_copy_chunk_done(uct_scopy_copy_chunk_t *chunk,
+                                  ucs_status_t status)
+{
+    uct_scopy_tx_t *tx = chunk->tx;
+    uct_scopy_ep_t *ep = chunk->ep;
+
+    if (ucs_unlikely(status != UCS_OK)) {
+        tx->copy_status = status;
+    }
+
+    /* Publish the status before the counter, it is read by progress_tx. The
+     * chunk may be released once the counter drops to 0, and the endpoint
+     * once its own counter does */
+    ucs_memory_cpu_store_fence();
+    ucs_atomic_sub32(&tx->copy_pending, 1);
+    ucs_atomic_sub32(&ep->copy_inflight, 1);
+}
+
+void uct_scopy_ep_copy_chunk(uct_scopy_copy_chunk_t *chunk)
+{
+    uct_scopy_tx_t *tx       = chunk->tx;
+    uct_scopy_iface_t *iface = ucs_derived_of(chunk->ep->super.super.iface,
+                                              uct_scopy_iface_t);
+    uint64_t remote_addr     = chunk->remote_addr;
+    size_t remaining         = chunk->length;
+    ucs_iov_iter_t iov_iter  = chunk->iov_iter;
+    ucs_status_t status      = UCS_OK;
+    size_t length;
+
+    while ((remaining > 0) && (iov_iter.iov_index < tx->iov_cnt)) {
+        length = remaining;
+        status = iface->tx(&chunk->ep->super.super, tx->iov, tx->iov_cnt,
+                           &iov_iter, &length, remote_addr, tx->rkey, tx->op);
+        if (ucs_unlikely(UCS_STATUS_IS_ERR(status))) {
+            break;
+        }
+
+        status       = UCS_OK;
+        remote_addr += length;
+        remaining   -= length;
+    }
+
+    uct_scopy_ep_copy_chunk_done(chunk, status);
+}
+
+/* Split the TX operation to chunks of segment size and pass them to the
+ * helper threads */
+static ucs_status_t
+uct_scopy_ep_tx_offload(uct_scopy_iface_t *iface, uct_scopy_ep_t *ep,
+                        uct_scopy_tx_t *tx, size_t length)
+{
+    size_t seg_size         = iface->config.seg_size;
+    unsigned num_chunks     = ucs_div_round_up(length, seg_size);
+    ucs_iov_iter_t iov_iter = tx->iov_iter;
+    uct_scopy_copy_chunk_t *chunk;
+    unsigned i;
+
+    tx->chunks = ucs_malloc(num_chunks * sizeof(*tx->chunks),
+                            "scopy_copy_chunks");
+    if (tx->chunks == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    for (i = 0; i < num_chunks; ++i) {
+        chunk              = &tx->chunks[i];
+        chunk->ep          = ep;
+        chunk->tx          = tx;
+        chunk->iov_iter    = iov_iter;
+        chunk->length      = ucs_min(seg_size, length);
+        chunk->remote_addr = tx->remote_addr;
+        uct_scopy_iov_iter_advance(tx->iov, tx->iov_cnt, &iov_iter,
+                                   chunk->length);
+        tx->remote_addr   += chunk->length;
+        length            -= chunk->length;
+    }
+
+    ucs_trace("ep %p: tx %p offloaded in %u chunks", ep, tx, num_chunks);
+
+    tx->iov_iter     = iov_iter;
+    tx->copy_status  = UCS_OK;
+    tx->copy_pending = num_chunks;
+    ucs_atomic_add32(&ep->copy_inflight, num_chunks);
+    uct_scopy_iface_copy_post(iface, tx->chunks, num_chunks);
+    return UCS_OK;
+}
+
+static UCS_F_ALWAYS_INLINE size_t
+uct_scopy_ep_tx_remaining(const uct_scopy_tx_t *tx)
+{
+    return uct_iov_total_length(tx->iov, tx->iov_cnt) -
+           uct_iov_iter_flat_offset(tx->iov, tx->iov_cnt, &tx->iov_iter);
+}
+
+/* Transfer the TX operation together with the following operations of the
+ * same type on the endpoint by a single call, if they fit to a segment.
+ * Returns nonzero if the TX operation was completed by the batch. */
+static int uct_scopy_ep_tx_batch(uct_scopy_iface_t *iface, uct_scopy_ep_t *ep,
+                                 uct_scopy_tx_t *tx, size_t length)
+{
+    ucs_arbiter_elem_t *tail = ucs_arbiter_group_tail(&ep->arb_group);
+    ucs_arbiter_elem_t *elem = &tx->arb_elem;
+    size_t max_iov           = ucs_iov_get_max();
+    size_t iov_cnt           = tx->iov_cnt - tx->iov_iter.iov_index;
+    unsigned tx_cnt          = 1;
+    uct_scopy_tx_t *next_tx;
+    size_t next_length;
+    ucs_status_t status;
+    unsigned i;
+
+    /* The element is the head of the group being dispatched, so the
+     * following elements are linked from it up to the group tail */
+    if (ucs_arbiter_elem_is_only(elem)) {
+        return 0;
+    }
+
+    iface->batch_txs[0] = tx;
+    while ((tx_cnt < iface->config.tx_batch) && (elem != tail)) {
+        elem    = elem->next;
+        next_tx = ucs_container_of(elem, uct_scopy_tx_t, arb_elem);
+        if ((next_tx->op != tx->op) || next_tx->batched) {
+            break;
+        }
+
+        next_length = uct_scopy_ep_tx_remaining(next_tx);
+        if (((length + next_length) > iface->config.seg_size) ||
+            ((iov_cnt + next_tx->iov_cnt) > max_iov)) {
+            break;
+        }
+
+        iface->batch_txs[tx_cnt++] = next_tx;
+        length                    += next_length;
+        iov_cnt                   += next_tx->iov_cnt;
+    }
+
+    if (tx_cnt == 1) {
+        return 0;
+    }
+
+    status = iface->tx_batch(&ep->super.super, iface->batch_txs, tx_cnt,
+                             &length);
+    if (ucs_unlikely(status != UCS_OK)) {
+        /* Let the regular path retry and report the failure */
+        ucs_trace("ep %p: batch of %u tx failed: %s", ep, tx_cnt,
+                  ucs_status_string(status));
+        return 0;
+    }
+
+    ucs_trace("ep %p: tx %p batched with %u tx, length %zu", ep, tx,
+              tx_cnt - 1, length);
+
+    /* Complete the fully transferred operations in order, the rest are
+     * continued by the regular path */
+    for (i = 0; i < tx_cnt; ++i) {
+        next_tx     = iface->batch_txs[i];
+        next_length = uct_scopy_ep_tx_remaining(next_tx);
+        if (next_length > length) {
+            break;
+        }
+
+        uct_scopy_iov_iter_advance(next_tx->iov, next_tx->iov_cnt,
+                                   &next_tx->iov_iter, next_length);
+        length               -= next_length;
+        next_tx->remote_addr += next_length;
+        next_tx->batched      = 1;
+        uct_scopy_trace_data(next_tx);
+        if (next_tx->comp != NULL) {
+            uct_invoke_completion(next_tx->comp, UCS_OK);
+        }
+    }
+
+    return tx->batched;
+}
+
 ucs_arbiter_cb_result_t uct_scopy_ep_progress_tx(ucs_arbiter_t *arbiter,
                                                  ucs_arbiter_group_t *group,
                                                  ucs_arbiter_elem_t *elem,
@@ -137,16 +364,51 @@ ucs_arbiter_cb_result_t uct_scopy_ep_progress_tx(ucs_arbiter_t *arbiter,
                                                 arb_elem);
     unsigned *count          = (unsigned*)arg;
     ucs_status_t status      = UCS_OK;
-    size_t seg_size;
+    size_t seg_size, length;
+
+    if (tx->batched) {
+        /* Completed by a batch of a preceding TX operation */
+        ucs_mpool_put_inline(tx);
+        return UCS_ARBITER_CB_RESULT_REMOVE_ELEM;
+    }
 
     if (*count == iface->config.tx_quota) {
         return UCS_ARBITER_CB_RESULT_STOP;
     }
 
-    if (tx->op != UCT_SCOPY_TX_FLUSH_COMP) {
+    if (tx->chunks != NULL) {
+        /* The TX was offloaded to the helper threads */
+        if (tx->copy_pending != 0) {
+            return UCS_ARBITER_CB_RESULT_RESCHED_GROUP;
+        }
+
+        ucs_memory_cpu_load_fence();
+        status = tx->copy_status;
+        ucs_free(tx->chunks);
+        tx->chunks = NULL;
+        uct_scopy_trace_data(tx);
+    } else if (tx->op != UCT_SCOPY_TX_FLUSH_COMP) {
         ucs_assert((tx->op == UCT_SCOPY_TX_GET_ZCOPY) ||
                    (tx->op == UCT_SCOPY_TX_PUT_ZCOPY));
         seg_size = iface->config.seg_size;
+        length   = uct_scopy_ep_tx_remaining(tx);
+        if ((iface->tx_batch != NULL) && (length < seg_size) &&
+            uct_scopy_ep_tx_batch(iface, ep, tx, length)) {
+            (*count)++;
+            ucs_mpool_put_inline(tx);
+            return UCS_ARBITER_CB_RESULT_REMOVE_ELEM;
+        }
+
+        if ((iface->copy.num_threads > 0) && (length > seg_size)) {
+            status = uct_scopy_ep_tx_offload(iface, ep, tx, length);
+            if (status == UCS_OK) {
+                (*count)++;
+                return UCS_ARBITER_CB_RESULT_RESCHED_GROUP;
+            }
+
+            /* Copy on the calling thread if could not offload */
+        }
+
         status   = iface->tx(&ep->super.super, tx->iov, tx->iov_cnt,
                              &tx->iov_iter, &seg_size, tx->remote_addr,
                              tx->rkey, tx->op);
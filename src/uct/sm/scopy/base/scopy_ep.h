@@ -45,12 +45,41 @@ typedef ucs_status_t
                           uct_scopy_tx_op_t tx_op);
 
 
+struct uct_scopy_tx;
+
+
+/**
+ * Batched TX operations executor
+ *
+ * @param [in]     tl_ep             Transport EP.
+ * @param [in]     txs               TX operations of the same type to transfer
+ *                                   the remaining data of in a single call.
+ * @param [in]     tx_cnt            The number of the TX operations.
+ * @param [out]    length_p          The total length of the data that was
+ *                                   transferred, starting from the first
+ *                                   operation.
+ *
+ * @return UCS_OK if the operations were successfully completed, otherwise - error status.
+ */
+typedef ucs_status_t
+(*uct_scopy_ep_tx_batch_func_t)(uct_ep_h tl_ep,
+                                struct uct_scopy_tx *const *txs,
+                                unsigned tx_cnt, size_t *length_p);
+
+
 typedef struct uct_scopy_tx {
     ucs_arbiter_elem_t              arb_elem;           /* TX arbiter group element */
     uct_scopy_tx_op_t               op;                 /* TX operation identifier */
     uint64_t                        remote_addr;        /* The remote address */
     uct_rkey_t                      rkey;               /* User-passed UCT rkey */
     uct_completion_t                *comp;              /* The pointer to the user's passed completion */
+    struct uct_scopy_copy_chunk     *chunks;            /* Chunks copied by helper threads,
+                                                         * or NULL if the TX is not offloaded */
+    volatile uint32_t               copy_pending;       /* Number of chunks which are not
+                                                         * copied yet */
+    ucs_status_t                    copy_status;        /* Status of the offloaded copy */
+    int                             batched;            /* Completed as a part of a batch
+                                                         * started by a preceding TX */
     ucs_iov_iter_t                  iov_iter;           /* UCT IOVs iterator */
     size_t                          iov_cnt;            /* The number of the UCT IOVs */
     uct_iov_t                       iov[];              /* UCT IOVs */
@@ -60,9 +89,24 @@ typedef struct uct_scopy_tx {
 typedef struct uct_scopy_ep {
     uct_base_ep_t                   super;
     ucs_arbiter_group_t             arb_group;          /* TX arbiter group */
+    volatile uint32_t               copy_inflight;      /* Chunks posted to helper
+                                                         * threads and not completed */
 } uct_scopy_ep_t;
 
 
+/**
+ * Part of a TX operation which is copied by a helper thread
+ */
+typedef struct uct_scopy_copy_chunk {
+    ucs_queue_elem_t                queue;              /* Helper threads queue element */
+    uct_scopy_ep_t                  *ep;                /* Endpoint of the TX operation */
+    uct_scopy_tx_t                  *tx;                /* TX operation to copy a part of */
+    ucs_iov_iter_t                  iov_iter;           /* Start of the chunk in TX IOVs */
+    size_t                          length;             /* Length of the chunk */
+    uint64_t                        remote_addr;        /* The remote address of the chunk */
+} uct_scopy_copy_chunk_t;
+
+
 UCS_CLASS_DECLARE(uct_scopy_ep_t, const uct_ep_params_t *);
 
 ucs_status_t uct_scopy_ep_put_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
@@ -78,6 +122,11 @@ ucs_arbiter_cb_result_t uct_scopy_ep_progress_tx(ucs_arbiter_t *arbiter,
                                                  ucs_arbiter_elem_t *elem,
                                                  void *arg);
 
+void uct_scopy_ep_copy_chunk(uct_scopy_copy_chunk_t *chunk);
+
+void uct_scopy_ep_copy_chunk_done(uct_scopy_copy_chunk_t *chunk,
+                                  ucs_status_t status);
+
 ucs_status_t uct_scopy_ep_flush(uct_ep_h tl_ep, unsigned flags,
                                 uct_completion_t *comp);
 
@@ -11,10 +11,16 @@
 #include "scopy_ep.h"
 
 #include <ucs/arch/cpu.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/memory/numa.h>
+#include <ucs/sys/iovec.inl>
 #include <ucs/sys/string.h>
 
+#include <uct/base/uct_md.h>
 #include <uct/sm/base/sm_iface.h>
 
+#include <sched.h>
+
 
 /* Default overhead for iface_query, changing this value can break wire
   compatibility */
@@ -24,6 +30,15 @@
 #define UCT_SCOPY_IFACE_OVERHEAD 500e-9
 
 
+/* Loopback connection used to measure the TX function */
+typedef struct {
+    uct_scopy_iface_t *iface;
+    uct_ep_h          ep;
+    uct_mem_h         memh;
+    uct_rkey_bundle_t rkey_ob;
+} uct_scopy_iface_calib_t;
+
+
 ucs_config_field_t uct_scopy_iface_config_table[] = {
     {"SM_", "", NULL,
      ucs_offsetof(uct_scopy_iface_config_t, super),
@@ -48,6 +63,19 @@ ucs_config_field_t uct_scopy_iface_config_table[] = {
      "How many TX segments can be dispatched during iface progress",
      ucs_offsetof(uct_scopy_iface_config_t, tx_quota), UCS_CONFIG_TYPE_UINT},
 
+    {"COPY_THREADS", "0",
+     "Number of helper threads which copy GET/PUT Zcopy operations larger than\n"
+     "SEG_SIZE in parallel, in chunks of SEG_SIZE. The threads run on the CPUs\n"
+     "of the NUMA node where the interface is created. 0 means that the data\n"
+     "is copied by the thread which progresses the interface.",
+     ucs_offsetof(uct_scopy_iface_config_t, copy_threads), UCS_CONFIG_TYPE_UINT},
+
+    {"TX_BATCH", "64",
+     "Maximal number of GET/PUT Zcopy operations posted on the same endpoint\n"
+     "which are transferred by a single system call, if their total length\n"
+     "does not exceed SEG_SIZE. 1 disables batching.",
+     ucs_offsetof(uct_scopy_iface_config_t, tx_batch), UCS_CONFIG_TYPE_UINT},
+
     UCT_IFACE_MPOOL_CONFIG_FIELDS("TX_", -1, 8, 128m, 1.0, "send",
                                   ucs_offsetof(uct_scopy_iface_config_t, tx_mpool), ""),
 
@@ -95,17 +123,157 @@ void uct_scopy_iface_query(uct_scopy_iface_t *iface, uct_iface_attr_t *iface_att
                                           6e-6 : UCT_SCOPY_IFACE_DEFAULT_OVERHEAD;
 }
 
+static ucs_status_t
+uct_scopy_iface_calib_init(void *arg, void *dst, size_t length)
+{
+    uct_scopy_iface_calib_t *calib = arg;
+    uct_iface_h tl_iface           = &calib->iface->super.super.super;
+    uct_md_h md                    = calib->iface->super.super.md;
+    uct_device_addr_t *dev_addr;
+    uct_iface_addr_t *iface_addr;
+    uct_iface_attr_t iface_attr;
+    uct_ep_params_t ep_params;
+    uct_md_attr_t md_attr;
+    void *rkey_buffer;
+    ucs_status_t status;
+
+    status = uct_iface_query(tl_iface, &iface_attr);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    status = uct_md_query(md, &md_attr);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    dev_addr   = ucs_alloca(iface_attr.device_addr_len);
+    iface_addr = ucs_alloca(iface_attr.iface_addr_len);
+    status     = uct_iface_get_device_address(tl_iface, dev_addr);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    status = uct_iface_get_address(tl_iface, iface_addr);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    ep_params.field_mask = UCT_EP_PARAM_FIELD_IFACE |
+                           UCT_EP_PARAM_FIELD_DEV_ADDR |
+                           UCT_EP_PARAM_FIELD_IFACE_ADDR;
+    ep_params.iface      = tl_iface;
+    ep_params.dev_addr   = dev_addr;
+    ep_params.iface_addr = iface_addr;
+    status               = uct_ep_create(&ep_params, &calib->ep);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    status = uct_md_mem_reg(md, dst, length, UCT_MD_MEM_ACCESS_RMA,
+                            &calib->memh);
+    if (status != UCS_OK) {
+        goto err_destroy_ep;
+    }
+
+    rkey_buffer = ucs_alloca(md_attr.rkey_packed_size);
+    status      = uct_md_mkey_pack(md, calib->memh, rkey_buffer);
+    if (status != UCS_OK) {
+        goto err_dereg;
+    }
+
+    status = uct_rkey_unpack(md->component, rkey_buffer, &calib->rkey_ob);
+    if (status != UCS_OK) {
+        goto err_dereg;
+    }
+
+    return UCS_OK;
+
+err_dereg:
+    uct_md_mem_dereg(md, calib->memh);
+err_destroy_ep:
+    uct_ep_destroy(calib->ep);
+    return status;
+}
+
+static ucs_status_t
+uct_scopy_iface_calib_copy(void *arg, void *dst, const void *src, size_t length)
+{
+    uct_scopy_iface_calib_t *calib = arg;
+    uint64_t remote_addr           = (uintptr_t)dst;
+    ucs_iov_iter_t iov_iter;
+    size_t seg_size;
+    ucs_status_t status;
+    uct_iov_t iov;
+
+    iov.buffer = (void*)src;
+    iov.length = length;
+    iov.memh   = UCT_MEM_HANDLE_NULL;
+    iov.stride = 0;
+    iov.count  = 1;
+
+    /* Copy by segments, as the TX progress does */
+    ucs_iov_iter_init(&iov_iter);
+    while (iov_iter.iov_index < 1) {
+        seg_size = calib->iface->config.seg_size;
+        status   = calib->iface->tx(calib->ep, &iov, 1, &iov_iter, &seg_size,
+                                    remote_addr, calib->rkey_ob.rkey,
+                                    UCT_SCOPY_TX_PUT_ZCOPY);
+        if (status != UCS_OK) {
+            return status;
+        }
+
+        remote_addr += seg_size;
+    }
+
+    return UCS_OK;
+}
+
+static void uct_scopy_iface_calib_cleanup(void *arg)
+{
+    uct_scopy_iface_calib_t *calib = arg;
+    uct_md_h md                    = calib->iface->super.super.md;
+
+    uct_rkey_release(md->component, &calib->rkey_ob);
+    uct_md_mem_dereg(md, calib->memh);
+    uct_ep_destroy(calib->ep);
+}
+
+static const uct_sm_calib_ops_t uct_scopy_iface_calib_ops = {
+    .init    = uct_scopy_iface_calib_init,
+    .copy    = uct_scopy_iface_calib_copy,
+    .cleanup = uct_scopy_iface_calib_cleanup
+};
+
 ucs_status_t
-uct_scopy_iface_estimate_perf(uct_iface_h iface, uct_perf_attr_t *perf_attr)
+uct_scopy_iface_estimate_perf(uct_iface_h tl_iface, uct_perf_attr_t *perf_attr)
 {
+    uct_scopy_iface_t *iface      = ucs_derived_of(tl_iface,
+                                                   uct_scopy_iface_t);
+    uct_scopy_iface_calib_t calib = {.iface = iface};
+    const uct_sm_calib_result_t *calib_result;
     ucs_status_t status;
 
-    status = uct_base_iface_estimate_perf(iface, perf_attr);
+    status = uct_base_iface_estimate_perf(tl_iface, perf_attr);
     if (status != UCS_OK) {
         return status;
     }
 
-    if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_SEND_PRE_OVERHEAD) {
+    /* The measured performance of the system call is used only for local
+     * estimations, since iface_query() values must be the same on all peers */
+    calib_result = uct_sm_iface_calib(&iface->super,
+                                      iface->super.super.md->component->name,
+                                      &uct_scopy_iface_calib_ops, &calib);
+    if (calib_result != NULL) {
+        if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_BANDWIDTH) {
+            perf_attr->bandwidth.dedicated = calib_result->bandwidth;
+            perf_attr->bandwidth.shared    = 0;
+        }
+
+        if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_SEND_PRE_OVERHEAD) {
+            perf_attr->send_pre_overhead = calib_result->overhead;
+        }
+    } else if (perf_attr->field_mask & UCT_PERF_ATTR_FIELD_SEND_PRE_OVERHEAD) {
         perf_attr->send_pre_overhead = UCT_SCOPY_IFACE_OVERHEAD;
     }
 
@@ -116,6 +284,189 @@ uct_scopy_iface_estimate_perf(uct_iface_h iface, uct_perf_attr_t *perf_attr)
     return UCS_OK;
 }
 
+static void *uct_scopy_iface_copy_thread(void *arg)
+{
+    uct_scopy_iface_t *iface = arg;
+    uct_scopy_copy_chunk_t *chunk;
+
+    if (ucs_sys_setaffinity(&iface->copy.cpuset) == -1) {
+        ucs_diag("failed to set scopy copy thread affinity: %m");
+    }
+
+    pthread_mutex_lock(&iface->copy.lock);
+    for (;;) {
+        while (ucs_queue_is_empty(&iface->copy.queue) && !iface->copy.stop) {
+            pthread_cond_wait(&iface->copy.cond, &iface->copy.lock);
+        }
+
+        if (iface->copy.stop) {
+            break;
+        }
+
+        chunk = ucs_queue_pull_elem_non_empty(&iface->copy.queue,
+                                              uct_scopy_copy_chunk_t, queue);
+        pthread_mutex_unlock(&iface->copy.lock);
+        uct_scopy_ep_copy_chunk(chunk);
+        pthread_mutex_lock(&iface->copy.lock);
+    }
+    pthread_mutex_unlock(&iface->copy.lock);
+
+    return NULL;
+}
+
+static void uct_scopy_iface_copy_cpuset_init(uct_scopy_iface_t *iface)
+{
+    ucs_numa_node_t node;
+    int cpu, num_local;
+    long num_cpus;
+
+    if (ucs_sys_getaffinity(&iface->copy.cpuset) != 0) {
+        return;
+    }
+
+    cpu = sched_getcpu();
+    if (cpu < 0) {
+        return;
+    }
+
+    /* Keep only the CPUs which share the NUMA node with the creating thread */
+    node      = ucs_numa_node_of_cpu(cpu);
+    num_local = 0;
+    num_cpus  = ucs_sys_get_num_cpus();
+    for (cpu = 0; cpu < num_cpus; ++cpu) {
+        if (!CPU_ISSET(cpu, &iface->copy.cpuset)) {
+            continue;
+        }
+
+        if (ucs_numa_node_of_cpu(cpu) != node) {
+            CPU_CLR(cpu, &iface->copy.cpuset);
+        } else {
+            ++num_local;
+        }
+    }
+
+    ucs_assert(num_local > 0);
+}
+
+static void
+uct_scopy_iface_copy_cancel_locked(uct_scopy_iface_t *iface, uct_scopy_ep_t *ep)
+{
+    uct_scopy_copy_chunk_t *chunk;
+    ucs_queue_iter_t iter;
+
+    ucs_queue_for_each_safe(chunk, iter, &iface->copy.queue, queue) {
+        if ((ep == NULL) || (chunk->ep == ep)) {
+            ucs_queue_del_iter(&iface->copy.queue, iter);
+            uct_scopy_ep_copy_chunk_done(chunk, UCS_ERR_CANCELED);
+        }
+    }
+}
+
+void uct_scopy_iface_copy_cancel(uct_scopy_iface_t *iface, uct_scopy_ep_t *ep)
+{
+    if (iface->copy.num_threads == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&iface->copy.lock);
+    uct_scopy_iface_copy_cancel_locked(iface, ep);
+    pthread_mutex_unlock(&iface->copy.lock);
+}
+
+static void uct_scopy_iface_copy_stop(uct_scopy_iface_t *iface,
+                                      unsigned num_threads)
+{
+    unsigned i;
+
+    pthread_mutex_lock(&iface->copy.lock);
+    /* Complete the chunks which were not copied, so their TX operations are
+     * released by the endpoints */
+    uct_scopy_iface_copy_cancel_locked(iface, NULL);
+    iface->copy.stop = 1;
+    pthread_cond_broadcast(&iface->copy.cond);
+    pthread_mutex_unlock(&iface->copy.lock);
+
+    for (i = 0; i < num_threads; ++i) {
+        pthread_join(iface->copy.threads[i], NULL);
+    }
+}
+
+static ucs_status_t
+uct_scopy_iface_copy_init(uct_scopy_iface_t *iface, unsigned num_threads)
+{
+    ucs_status_t status;
+    unsigned i;
+
+    iface->copy.num_threads = 0;
+    iface->copy.threads     = NULL;
+    iface->copy.stop        = 0;
+    ucs_queue_head_init(&iface->copy.queue);
+
+    if (num_threads == 0) {
+        return UCS_OK;
+    }
+
+    /* Helper threads may report transport errors */
+    if ((iface->super.super.err_handler != NULL) &&
+        !(iface->super.super.err_handler_flags & UCT_CB_FLAG_ASYNC)) {
+        ucs_diag("iface %p: copy threads are disabled, since error handler "
+                 "is not thread-safe", iface);
+        return UCS_OK;
+    }
+
+    iface->copy.threads = ucs_calloc(num_threads, sizeof(*iface->copy.threads),
+                                     "scopy_copy_threads");
+    if (iface->copy.threads == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    pthread_mutex_init(&iface->copy.lock, NULL);
+    pthread_cond_init(&iface->copy.cond, NULL);
+    uct_scopy_iface_copy_cpuset_init(iface);
+
+    for (i = 0; i < num_threads; ++i) {
+        status = ucs_pthread_create(&iface->copy.threads[i],
+                                    uct_scopy_iface_copy_thread, iface,
+                                    "scopy_copy#%u", i);
+        if (status != UCS_OK) {
+            uct_scopy_iface_copy_stop(iface, i);
+            pthread_cond_destroy(&iface->copy.cond);
+            pthread_mutex_destroy(&iface->copy.lock);
+            ucs_free(iface->copy.threads);
+            return status;
+        }
+    }
+
+    iface->copy.num_threads = num_threads;
+    return UCS_OK;
+}
+
+static void uct_scopy_iface_copy_cleanup(uct_scopy_iface_t *iface)
+{
+    if (iface->copy.num_threads == 0) {
+        return;
+    }
+
+    uct_scopy_iface_copy_stop(iface, iface->copy.num_threads);
+    pthread_cond_destroy(&iface->copy.cond);
+    pthread_mutex_destroy(&iface->copy.lock);
+    ucs_free(iface->copy.threads);
+}
+
+void uct_scopy_iface_copy_post(uct_scopy_iface_t *iface,
+                               uct_scopy_copy_chunk_t *chunks,
+                               unsigned num_chunks)
+{
+    unsigned i;
+
+    pthread_mutex_lock(&iface->copy.lock);
+    for (i = 0; i < num_chunks; ++i) {
+        ucs_queue_push(&iface->copy.queue, &chunks[i].queue);
+    }
+    pthread_cond_broadcast(&iface->copy.cond);
+    pthread_mutex_unlock(&iface->copy.lock);
+}
+
 UCS_CLASS_INIT_FUNC(uct_scopy_iface_t, uct_iface_ops_t *ops,
                     uct_scopy_iface_ops_t *scopy_ops, uct_md_h md,
                     uct_worker_h worker, const uct_iface_params_t *params,
@@ -134,6 +485,11 @@ UCS_CLASS_INIT_FUNC(uct_scopy_iface_t, uct_iface_ops_t *ops,
     self->config.max_iov  = ucs_min(config->max_iov, ucs_iov_get_max());
     self->config.seg_size = config->seg_size;
     self->config.tx_quota = config->tx_quota;
+    self->config.tx_batch = ucs_max(ucs_min(config->tx_batch,
+                                            ucs_iov_get_max()), 1);
+    self->tx_batch        = (self->config.tx_batch > 1) ?
+                            scopy_ops->ep_tx_batch : NULL;
+    self->batch_txs       = NULL;
 
     elem_size             = sizeof(uct_scopy_tx_t) +
                             self->config.max_iov * sizeof(uct_iov_t);
@@ -146,14 +502,42 @@ UCS_CLASS_INIT_FUNC(uct_scopy_iface_t, uct_iface_ops_t *ops,
     mp_params.ops             = &uct_scopy_mpool_ops;
     mp_params.name            = "uct_scopy_iface_tx_mp";
     status = ucs_mpool_init(&mp_params, &self->tx_mpool);
+    if (status != UCS_OK) {
+        goto err_arbiter_cleanup;
+    }
+
+    if (self->tx_batch != NULL) {
+        self->batch_txs = ucs_malloc(self->config.tx_batch *
+                                     sizeof(*self->batch_txs),
+                                     "scopy_batch_txs");
+        if (self->batch_txs == NULL) {
+            status = UCS_ERR_NO_MEMORY;
+            goto err_mpool_cleanup;
+        }
+    }
 
+    status = uct_scopy_iface_copy_init(self, config->copy_threads);
+    if (status != UCS_OK) {
+        goto err_free_batch_txs;
+    }
+
+    return UCS_OK;
+
+err_free_batch_txs:
+    ucs_free(self->batch_txs);
+err_mpool_cleanup:
+    ucs_mpool_cleanup(&self->tx_mpool, 1);
+err_arbiter_cleanup:
+    ucs_arbiter_cleanup(&self->arbiter);
     return status;
 }
 
 static UCS_CLASS_CLEANUP_FUNC(uct_scopy_iface_t)
 {
+    uct_scopy_iface_copy_cleanup(self);
     uct_worker_progress_unregister_safe(&self->super.super.worker->super,
                                         &self->super.super.prog.id);
+    ucs_free(self->batch_txs);
     ucs_mpool_cleanup(&self->tx_mpool, 1);
     ucs_arbiter_cleanup(&self->arbiter);
 }
@@ -10,6 +10,9 @@
 
 #include <uct/base/uct_iface.h>
 #include <uct/sm/base/sm_iface.h>
+#include <ucs/sys/sys.h>
+
+#include <pthread.h>
 
 #define uct_scopy_trace_data(_tx) \
     ucs_trace_data("%s [tx %p iov %zu/%zu length %zu/%zu] to %" PRIx64 "(%+ld)", \
@@ -31,6 +34,9 @@ typedef struct uct_scopy_iface_config {
                                                * data transfer for RMA operations */
     unsigned                      tx_quota;   /* How many TX segments can be dispatched
                                                * during iface progress */
+    unsigned                      copy_threads; /* Number of helper copy threads */
+    unsigned                      tx_batch;   /* Maximal number of TX operations
+                                               * submitted by a single call */
     uct_iface_mpool_config_t      tx_mpool;   /* TX memory pool configuration */
 } uct_scopy_iface_config_t;
 
@@ -40,6 +46,9 @@ typedef struct uct_scopy_iface {
     ucs_arbiter_t                 arbiter;     /* TX arbiter */
     ucs_mpool_t                   tx_mpool;    /* TX memory pool */
     uct_scopy_ep_tx_func_t        tx;          /* TX function */
+    uct_scopy_ep_tx_batch_func_t  tx_batch;    /* Batched TX function, or NULL
+                                                * if batching is disabled */
+    uct_scopy_tx_t                **batch_txs; /* TX operations of the batch */
     struct {
         size_t                    max_iov;     /* Maximum supported IOVs limited by
                                                 * user configuration and system
@@ -49,13 +58,26 @@ typedef struct uct_scopy_iface {
                                                 * Zcopy transfers */
         unsigned                  tx_quota;    /* How many TX segments can be dispatched
                                                 * during iface progress */
+        unsigned                  tx_batch;    /* Maximal number of TX operations
+                                                * submitted by a single call */
     } config;
+    struct {
+        pthread_mutex_t           lock;        /* Protects the chunks queue */
+        pthread_cond_t            cond;        /* Signals new chunks or stop */
+        ucs_queue_head_t          queue;       /* Chunks to be copied */
+        ucs_sys_cpuset_t          cpuset;      /* CPUs to run the threads on */
+        int                       stop;        /* Threads should exit */
+        unsigned                  num_threads; /* Number of helper threads,
+                                                * 0 - copy on the calling thread */
+        pthread_t                 *threads;    /* Helper threads */
+    } copy;
 } uct_scopy_iface_t;
 
 
 typedef struct uct_scopy_iface_ops {
     uct_iface_internal_ops_t super;
-    uct_scopy_ep_tx_func_t   ep_tx;
+    uct_scopy_ep_tx_func_t       ep_tx;
+    uct_scopy_ep_tx_batch_func_t ep_tx_batch; /* Optional */
 } uct_scopy_iface_ops_t;
 
 
@@ -70,6 +92,12 @@ UCS_CLASS_DECLARE(uct_scopy_iface_t, uct_iface_ops_t*, uct_scopy_iface_ops_t*,
 
 unsigned uct_scopy_iface_progress(uct_iface_h tl_iface);
 
+void uct_scopy_iface_copy_post(uct_scopy_iface_t *iface,
+                               uct_scopy_copy_chunk_t *chunks,
+                               unsigned num_chunks);
+
+void uct_scopy_iface_copy_cancel(uct_scopy_iface_t *iface, uct_scopy_ep_t *ep);
+
 ucs_status_t uct_scopy_iface_event_arm(uct_iface_h tl_iface, unsigned events);
 
 ucs_status_t uct_scopy_iface_flush(uct_iface_h tl_iface, unsigned flags,
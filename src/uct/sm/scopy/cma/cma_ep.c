@@ -138,6 +138,48 @@ ucs_status_t uct_cma_ep_tx(uct_ep_h tl_ep, const uct_iov_t *iov, size_t iov_cnt,
     return UCS_OK;
 }
 
+ucs_status_t uct_cma_ep_tx_batch(uct_ep_h tl_ep, uct_scopy_tx_t *const *txs,
+                                 unsigned tx_cnt, size_t *length_p)
+{
+    uct_cma_ep_t *ep         = ucs_derived_of(tl_ep, uct_cma_ep_t);
+    uct_cma_iface_t *iface   = ucs_derived_of(tl_ep->iface, uct_cma_iface_t);
+    struct iovec *local_iov  = iface->batch.local_iov;
+    struct iovec *remote_iov = iface->batch.remote_iov;
+    uct_scopy_tx_op_t tx_op  = txs[0]->op;
+    size_t local_iov_cnt     = 0;
+    ucs_iov_iter_t iov_iter;
+    size_t iov_cnt;
+    unsigned i;
+    ssize_t ret;
+
+    ucs_assert(tx_cnt <= iface->super.config.tx_batch);
+
+    for (i = 0; i < tx_cnt; ++i) {
+        ucs_assert(txs[i]->op == tx_op);
+        iov_iter               = txs[i]->iov_iter;
+        iov_cnt                = ucs_iov_get_max() - local_iov_cnt;
+        remote_iov[i].iov_base = (void*)(uintptr_t)txs[i]->remote_addr;
+        remote_iov[i].iov_len  = uct_iov_to_iovec(&local_iov[local_iov_cnt],
+                                                  &iov_cnt, txs[i]->iov,
+                                                  txs[i]->iov_cnt, SIZE_MAX,
+                                                  &iov_iter);
+        ucs_assert(iov_iter.iov_index == txs[i]->iov_cnt);
+        local_iov_cnt += iov_cnt;
+    }
+
+    ret = uct_cma_ep_fn[tx_op].fn(ep->remote_pid, local_iov, local_iov_cnt,
+                                  remote_iov, tx_cnt, 0);
+    if (ucs_unlikely(ret < 0)) {
+        ucs_debug("%s(pid=%d, local_iov_cnt=%zu, remote_iov_cnt=%u) "
+                  "returned %zd: %m", uct_cma_ep_fn[tx_op].name,
+                  ep->remote_pid, local_iov_cnt, tx_cnt, ret);
+        return UCS_ERR_IO_ERROR;
+    }
+
+    *length_p = ret;
+    return UCS_OK;
+}
+
 ucs_status_t uct_cma_ep_check(const uct_ep_h tl_ep, unsigned flags,
                               uct_completion_t *comp)
 {
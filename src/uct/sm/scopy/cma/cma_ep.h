@@ -27,6 +27,9 @@ ucs_status_t uct_cma_ep_tx(uct_ep_h tl_ep, const uct_iov_t *iov, size_t iov_cnt,
                            uint64_t remote_addr, uct_rkey_t rkey,
                            uct_scopy_tx_op_t tx_op);
 
+ucs_status_t uct_cma_ep_tx_batch(uct_ep_h tl_ep, uct_scopy_tx_t *const *txs,
+                                 unsigned tx_cnt, size_t *length_p);
+
 ucs_status_t uct_cma_ep_check(const uct_ep_h tl_ep, unsigned flags,
                               uct_completion_t *comp);
 
@@ -13,6 +13,8 @@
 #include "cma_ep.h"
 
 #include <uct/base/uct_md.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/sys/iovec.h>
 #include <ucs/sys/string.h>
 
 
@@ -144,7 +146,8 @@ static uct_scopy_iface_ops_t uct_cma_iface_ops = {
         .iface_is_reachable_v2 = uct_cma_iface_is_reachable_v2,
         .ep_is_connected       = uct_cma_ep_is_connected
     },
-    .ep_tx = uct_cma_ep_tx,
+    .ep_tx       = uct_cma_ep_tx,
+    .ep_tx_batch = uct_cma_ep_tx_batch
 };
 
 static UCS_CLASS_INIT_FUNC(uct_cma_iface_t, uct_md_h md, uct_worker_h worker,
@@ -155,12 +158,31 @@ static UCS_CLASS_INIT_FUNC(uct_cma_iface_t, uct_md_h md, uct_worker_h worker,
                               &uct_cma_iface_ops, md, worker, params,
                               tl_config);
 
+    self->batch.local_iov  = NULL;
+    self->batch.remote_iov = NULL;
+    if (self->super.tx_batch == NULL) {
+        return UCS_OK;
+    }
+
+    self->batch.local_iov  = ucs_malloc(ucs_iov_get_max() *
+                                        sizeof(*self->batch.local_iov),
+                                        "cma_batch_local_iov");
+    self->batch.remote_iov = ucs_malloc(self->super.config.tx_batch *
+                                        sizeof(*self->batch.remote_iov),
+                                        "cma_batch_remote_iov");
+    if ((self->batch.local_iov == NULL) || (self->batch.remote_iov == NULL)) {
+        ucs_free(self->batch.local_iov);
+        ucs_free(self->batch.remote_iov);
+        return UCS_ERR_NO_MEMORY;
+    }
+
     return UCS_OK;
 }
 
 static UCS_CLASS_CLEANUP_FUNC(uct_cma_iface_t)
 {
-    /* No op */
+    ucs_free(self->batch.local_iov);
+    ucs_free(self->batch.remote_iov);
 }
 
 UCS_CLASS_DEFINE(uct_cma_iface_t, uct_scopy_iface_t);
@@ -21,6 +21,10 @@ typedef struct uct_cma_iface_config {
 
 typedef struct uct_cma_iface {
     uct_scopy_iface_t             super;
+    struct {
+        struct iovec              *local_iov;  /* Local IOVs of a TX batch */
+        struct iovec              *remote_iov; /* Remote IOVs of a TX batch */
+    } batch;
 } uct_cma_iface_t;
 
 
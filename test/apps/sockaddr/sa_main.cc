@@ -15,6 +15,7 @@
 #include <sys/epoll.h>
 #include <getopt.h>
 #include <netdb.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 
@@ -92,6 +93,8 @@ private:
     static void pton(const dest_t& dst, struct sockaddr_storage& saddr,
                      socklen_t &addrlen);
 
+    static double get_time();
+
     template <typename O>
     friend typename O::__basic_ostream& operator<<(O& os, connection_type conn_type);
 
@@ -101,6 +104,7 @@ private:
     conn_map_t              m_connections;
     int                     m_num_conns_inflight;
     int                     m_num_conns_started;
+    int                     m_num_conns_completed;
 };
 
 
@@ -109,7 +113,7 @@ application::usage_exception::usage_exception(const std::string& message) :
 };
 
 application::application(int argc, char **argv) : m_num_conns_inflight(0),
-                m_num_conns_started(0) {
+                m_num_conns_started(0), m_num_conns_completed(0) {
     int c;
 
     while ( (c = getopt(argc, argv, "p:f:m:r:n:S:s:vh")) != -1 ) {
@@ -163,7 +167,8 @@ int application::run() {
 
     create_worker();
 
-    while ((m_num_conns_started > m_params.total_conns) || !m_connections.empty()) {
+    double start_time = get_time();
+    while ((m_num_conns_started < m_params.total_conns) || !m_connections.empty()) {
         initiate_connections();
         m_worker->wait(m_evpoll,
                        [this](conn_ptr_t conn) {
@@ -182,7 +187,10 @@ int application::run() {
                        -1);
     }
 
-    LOG_INFO << "all connections completed";
+    double elapsed = get_time() - start_time;
+    LOG_INFO << "all connections completed: " << m_num_conns_completed
+             << " client connections in " << elapsed << " seconds, "
+             << (m_num_conns_completed / elapsed) << " connections/sec";
 
     m_worker.reset();
     return 0;
@@ -310,8 +318,17 @@ void application::advance_connection(conn_state_ptr_t s, uint32_t events) {
 
 void application::connection_completed(conn_state_ptr_t s) {
     LOG_DEBUG << "completed " << s->conn_type << " connection id " << s->conn_ptr->id();
+    if (s->conn_type == CONNECTION_CLIENT) {
+        --m_num_conns_inflight;
+        ++m_num_conns_completed;
+    }
     m_connections.erase(s->conn_ptr->id());
-    --m_num_conns_inflight;
+}
+
+double application::get_time() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + (tv.tv_usec * 1e-6);
 }
 
 void application::pton(const dest_t& dst, struct sockaddr_storage& saddr,
@@ -363,7 +380,7 @@ void application::usage(const std::string& error) {
     params defaults;
     std::cout << "Usage: ./sa [ options ]" << std::endl;
     std::cout << "Options:"                                                           << std::endl;
-    std::cout << "    -m <mode>    Application mode (tcp)"                            << std::endl;
+    std::cout << "    -m <mode>    Application mode (tcp, ucx)"                       << std::endl;
     std::cout << "    -p <port>    Local port number to listen on"                    << std::endl;
     std::cout << "    -f <file>    File with list of hosts and ports to connect to"   << std::endl;
     std::cout << "                 Each line in the file is formatter as follows:"    << std::endl;
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include "sa_ucx.h"
+
+#include <sys/epoll.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+static const int max_wait_ms = 10;
+
+
+static void ucx_check_status(ucs_status_t status, const std::string& message) {
+    if (status != UCS_OK) {
+        throw error(message + ": " + ucs_status_string(status));
+    }
+}
+
+ucx_connection::ucx_connection(ucx_worker& worker, const struct sockaddr *addr,
+                               socklen_t addrlen) :
+                m_worker(worker), m_ep(NULL), m_is_closed(false) {
+    ucp_ep_params_t ep_params;
+    ep_params.field_mask       = UCP_EP_PARAM_FIELD_FLAGS |
+                                 UCP_EP_PARAM_FIELD_SOCK_ADDR;
+    ep_params.flags            = UCP_EP_PARAMS_FLAGS_CLIENT_SERVER;
+    ep_params.sockaddr.addr    = addr;
+    ep_params.sockaddr.addrlen = addrlen;
+    create_ep(ep_params);
+}
+
+ucx_connection::ucx_connection(ucx_worker& worker,
+                               ucp_conn_request_h conn_request) :
+                m_worker(worker), m_ep(NULL), m_is_closed(false) {
+    ucp_ep_params_t ep_params;
+    ep_params.field_mask   = UCP_EP_PARAM_FIELD_CONN_REQUEST;
+    ep_params.conn_request = conn_request;
+    create_ep(ep_params);
+}
+
+ucx_connection::~ucx_connection() {
+    ucp_request_param_t param;
+
+    param.op_attr_mask = UCP_OP_ATTR_FIELD_FLAGS;
+    param.flags        = m_is_closed ? UCP_EP_CLOSE_FLAG_FORCE : 0;
+    m_worker.wait_request(ucp_ep_close_nbx(m_ep, &param));
+    m_worker.m_conns.erase(id());
+}
+
+void ucx_connection::create_ep(ucp_ep_params_t& ep_params) {
+    ep_params.field_mask     |= UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE |
+                                UCP_EP_PARAM_FIELD_ERR_HANDLER;
+    ep_params.err_mode        = UCP_ERR_HANDLING_MODE_PEER;
+    ep_params.err_handler.cb  = err_cb;
+    ep_params.err_handler.arg = this;
+
+    ucs_status_t status = ucp_ep_create(m_worker.m_worker, &ep_params, &m_ep);
+    ucx_check_status(status, "failed to create ucp endpoint");
+
+    set_id(m_worker.m_next_conn_id++);
+    m_worker.m_conns[id()] = this;
+}
+
+void ucx_connection::err_cb(void *arg, ucp_ep_h ep, ucs_status_t status) {
+    ucx_connection *conn = reinterpret_cast<ucx_connection*>(arg);
+
+    LOG_DEBUG << "connection id " << conn->id() << " closed: "
+              << ucs_status_string(status);
+    conn->m_is_closed = true;
+}
+
+void ucx_connection::add_to_evpoll(evpoll_set& evpoll) {
+    /* all connections are signaled by the worker event fd */
+}
+
+size_t ucx_connection::send(const char *buffer, size_t size) {
+    ucp_request_param_t param;
+    ucs_status_ptr_t request;
+
+    if (m_is_closed) {
+        return 0;
+    }
+
+    /* the buffer is kept by the application until the connection completes,
+     * so the request may be released before it is finished */
+    param.op_attr_mask = 0;
+    request            = ucp_stream_send_nbx(m_ep, buffer, size, &param);
+    if (UCS_PTR_IS_ERR(request)) {
+        throw error(std::string("failed to send on ucx endpoint: ") +
+                    ucs_status_string(UCS_PTR_STATUS(request)));
+    } else if (request != NULL) {
+        ucp_request_free(request);
+    }
+
+    return size;
+}
+
+size_t ucx_connection::recv(char *buffer, size_t size) {
+    size_t length;
+    void *data;
+
+    while (m_recv_data.size() < size) {
+        data = ucp_stream_recv_data_nb(m_ep, &length);
+        if (UCS_PTR_IS_ERR(data)) {
+            if (m_is_closed) {
+                break;
+            }
+            throw error(std::string("failed to receive from ucx endpoint: ") +
+                        ucs_status_string(UCS_PTR_STATUS(data)));
+        } else if (data == NULL) {
+            break;
+        }
+
+        m_recv_data.append(reinterpret_cast<char*>(data), length);
+        ucp_stream_data_release(m_ep, data);
+    }
+
+    length = std::min(size, m_recv_data.size());
+    memcpy(buffer, m_recv_data.data(), length);
+    m_recv_data.erase(0, length);
+    return length;
+}
+
+bool ucx_connection::is_closed() const {
+    return m_is_closed;
+}
+
+ucx_worker::ucx_worker(const struct sockaddr *listen_addr, socklen_t addrlen) :
+                m_next_conn_id(0) {
+    ucp_params_t params;
+    params.field_mask = UCP_PARAM_FIELD_FEATURES;
+    params.features   = UCP_FEATURE_STREAM | UCP_FEATURE_WAKEUP;
+
+    ucs_status_t status = ucp_init(&params, NULL, &m_context);
+    ucx_check_status(status, "failed to create ucp context");
+
+    ucp_worker_params_t worker_params;
+    worker_params.field_mask  = UCP_WORKER_PARAM_FIELD_THREAD_MODE;
+    worker_params.thread_mode = UCS_THREAD_MODE_SINGLE;
+
+    status = ucp_worker_create(m_context, &worker_params, &m_worker);
+    if (status != UCS_OK) {
+        ucp_cleanup(m_context);
+        ucx_check_status(status, "failed to create ucp worker");
+    }
+
+    ucp_listener_params_t listener_params;
+    listener_params.field_mask       = UCP_LISTENER_PARAM_FIELD_SOCK_ADDR |
+                                       UCP_LISTENER_PARAM_FIELD_CONN_HANDLER;
+    listener_params.sockaddr.addr    = listen_addr;
+    listener_params.sockaddr.addrlen = addrlen;
+    listener_params.conn_handler.cb  = conn_request_cb;
+    listener_params.conn_handler.arg = this;
+
+    status = ucp_listener_create(m_worker, &listener_params, &m_listener);
+    if (status != UCS_OK) {
+        ucp_worker_destroy(m_worker);
+        ucp_cleanup(m_context);
+        ucx_check_status(status, "failed to create ucp listener");
+    }
+}
+
+ucx_worker::~ucx_worker() {
+    ucp_listener_destroy(m_listener);
+    ucp_worker_destroy(m_worker);
+    ucp_cleanup(m_context);
+}
+
+void ucx_worker::add_to_evpoll(evpoll_set& evpoll) {
+    int efd;
+
+    ucs_status_t status = ucp_worker_get_efd(m_worker, &efd);
+    ucx_check_status(status, "failed to get ucp worker event fd");
+    evpoll.add(efd, EPOLLIN | EPOLLERR);
+}
+
+conn_ptr_t ucx_worker::connect(const struct sockaddr *addr, socklen_t addrlen) {
+    return std::make_shared<ucx_connection>(*this, addr, addrlen);
+}
+
+void ucx_worker::wait(const evpoll_set& evpoll, conn_handler_t conn_handler,
+                      data_handler_t data_handler, int timeout_ms) {
+    std::vector<evpoll_set::event> events;
+    std::vector<uint64_t> conn_ids;
+
+    /* sleep on the event fd for a bounded time, so a missed wakeup would not
+     * stall the benchmark */
+    progress();
+    if (m_conn_requests.empty() && (ucp_worker_arm(m_worker) == UCS_OK)) {
+        evpoll.wait(events, (timeout_ms < 0) ? max_wait_ms :
+                            std::min(timeout_ms, max_wait_ms));
+        progress();
+    }
+
+    while (!m_conn_requests.empty()) {
+        ucp_conn_request_h conn_request = m_conn_requests.front();
+        m_conn_requests.pop_front();
+        conn_handler(std::make_shared<ucx_connection>(*this, conn_request));
+    }
+
+    /* the worker does not tell which endpoints have new events, so let all
+     * connections make progress; a connection may be released by the handler
+     * of another one */
+    for (auto& it : m_conns) {
+        conn_ids.push_back(it.first);
+    }
+
+    for (auto conn_id : conn_ids) {
+        if (m_conns.find(conn_id) != m_conns.end()) {
+            data_handler(conn_id, EPOLLIN | EPOLLOUT);
+        }
+    }
+}
+
+void ucx_worker::progress() {
+    while (ucp_worker_progress(m_worker) != 0) {
+    }
+}
+
+void ucx_worker::wait_request(void *request) {
+    if (UCS_PTR_IS_PTR(request)) {
+        while (ucp_request_check_status(request) == UCS_INPROGRESS) {
+            ucp_worker_progress(m_worker);
+        }
+        ucp_request_free(request);
+    }
+}
+
+void ucx_worker::conn_request_cb(ucp_conn_request_h conn_request, void *arg) {
+    ucx_worker *self = reinterpret_cast<ucx_worker*>(arg);
+
+    self->m_conn_requests.push_back(conn_request);
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef SA_UCX_H_
+#define SA_UCX_H_
+
+#include "sa_base.h"
+#include "sa_util.h"
+
+#include <ucp/api/ucp.h>
+#include <deque>
+#include <map>
+
+
+class ucx_worker;
+
+
+class ucx_connection : public connection {
+public:
+    ucx_connection(ucx_worker& worker, const struct sockaddr *addr,
+                   socklen_t addrlen);
+
+    ucx_connection(ucx_worker& worker, ucp_conn_request_h conn_request);
+
+    virtual ~ucx_connection();
+
+    virtual void add_to_evpoll(evpoll_set& evpoll);
+
+    virtual size_t send(const char *buffer, size_t size);
+
+    virtual size_t recv(char *buffer, size_t size);
+
+    virtual bool is_closed() const;
+
+private:
+    void create_ep(ucp_ep_params_t& ep_params);
+
+    static void err_cb(void *arg, ucp_ep_h ep, ucs_status_t status);
+
+    ucx_worker& m_worker;
+    ucp_ep_h    m_ep;
+    std::string m_recv_data;
+    bool        m_is_closed;
+};
+
+
+class ucx_worker : public worker {
+public:
+    ucx_worker(const struct sockaddr *listen_addr, socklen_t addrlen);
+
+    virtual ~ucx_worker();
+
+    virtual void add_to_evpoll(evpoll_set& evpoll);
+
+    virtual conn_ptr_t connect(const struct sockaddr *addr, socklen_t addrlen);
+
+    virtual void wait(const evpoll_set& evpoll, conn_handler_t conn_handler,
+                      data_handler_t data_handler, int timeout_ms);
+
+private:
+    friend class ucx_connection;
+
+    typedef std::map<uint64_t, ucx_connection*> conn_map_t;
+
+    void progress();
+
+    void wait_request(void *request);
+
+    static void conn_request_cb(ucp_conn_request_h conn_request, void *arg);
+
+    ucp_context_h                  m_context;
+    ucp_worker_h                   m_worker;
+    ucp_listener_h                 m_listener;
+    std::deque<ucp_conn_request_h> m_conn_requests;
+    conn_map_t                     m_conns;
+    uint64_t                       m_next_conn_id;
+};
+
+#endif
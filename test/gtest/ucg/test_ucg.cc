@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2026. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#include <common/test.h>
+extern "C" {
+#include <ucg/api/ucg.h>
+}
+
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+/* Group members are threads of the test process, exchanging their shared
+ * memory segments through a buffer protected by a barrier.
+ * A rank must not leave the test function early, since the other ranks would
+ * wait for it in the next collective operation forever. Data errors are
+ * recorded and the rank continues, and a failed collective operation aborts
+ * the test process. */
+class test_ucg : public ucs::test {
+protected:
+    static const unsigned GROUP_SIZE = 4;
+    static const size_t   FRAG_SIZE  = 256;
+
+    typedef enum {
+        TOPO_FLAT,      /* All ranks in the same locality domain */
+        TOPO_TWO_LEVEL, /* Two ranks in every domain */
+        TOPO_DISTINCT,  /* Every rank in its own domain */
+        TOPO_LAST
+    } topo_t;
+
+    typedef std::function<void(ucg_group_h group, unsigned rank)> func_t;
+
+    struct oob_arg {
+        test_ucg *self;
+        unsigned rank;
+    };
+
+    virtual void init()
+    {
+        ucs::test::init();
+        pthread_barrier_init(&m_barrier, NULL, GROUP_SIZE);
+    }
+
+    virtual void cleanup()
+    {
+        pthread_barrier_destroy(&m_barrier);
+        ucs::test::cleanup();
+    }
+
+    static ucs_status_t
+    oob_allgather(const void *sbuf, void *rbuf, size_t length, void *arg)
+    {
+        oob_arg *oob   = (oob_arg*)arg;
+        test_ucg *self = oob->self;
+
+        if (oob->rank == 0) {
+            self->m_oob_data.resize(length * GROUP_SIZE);
+        }
+        pthread_barrier_wait(&self->m_barrier);
+
+        memcpy(&self->m_oob_data[oob->rank * length], sbuf, length);
+        pthread_barrier_wait(&self->m_barrier);
+
+        memcpy(rbuf, &self->m_oob_data[0], length * GROUP_SIZE);
+        pthread_barrier_wait(&self->m_barrier);
+        return UCS_OK;
+    }
+
+    static void check_status(ucs_status_t status, const char *operation,
+                             unsigned rank)
+    {
+        if (status != UCS_OK) {
+            /* Other ranks are blocked in the same operation */
+            ucs_fatal("rank %u: %s failed: %s", rank, operation,
+                      ucs_status_string(status));
+        }
+    }
+
+    template <typename T>
+    static void check_buffer(const T *buffer, size_t count,
+                             const std::function<T(size_t)> &expected_func,
+                             const std::string &title)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            if (buffer[i] != expected_func(i)) {
+                /* Unary plus prints 8-bit values as numbers */
+                ADD_FAILURE() << title << " i=" << i << ": expected "
+                              << +expected_func(i) << ", actual "
+                              << +buffer[i];
+                break;
+            }
+        }
+    }
+
+    static int node_id(topo_t topo, unsigned rank)
+    {
+        switch (topo) {
+        case TOPO_FLAT:
+            return 0;
+        case TOPO_TWO_LEVEL:
+            return rank / 2;
+        default:
+            return rank;
+        }
+    }
+
+    void run_rank(topo_t topo, unsigned rank, const func_t &func)
+    {
+        oob_arg oob = {this, rank};
+        ucg_group_params_t params;
+        ucg_group_h group;
+
+        params.field_mask    = UCG_GROUP_PARAM_FIELD_RANK |
+                               UCG_GROUP_PARAM_FIELD_SIZE |
+                               UCG_GROUP_PARAM_FIELD_OOB |
+                               UCG_GROUP_PARAM_FIELD_FRAG_SIZE |
+                               UCG_GROUP_PARAM_FIELD_NODE_ID;
+        params.rank          = rank;
+        params.size          = GROUP_SIZE;
+        params.oob.allgather = oob_allgather;
+        params.oob.arg       = &oob;
+        params.frag_size     = FRAG_SIZE;
+        params.node_id       = node_id(topo, rank);
+
+        check_status(ucg_group_create(&params, &group), "ucg_group_create",
+                     rank);
+
+        func(group, rank);
+        ucg_group_destroy(group);
+    }
+
+    void run(const func_t &func)
+    {
+        for (int topo = 0; topo < TOPO_LAST; ++topo) {
+            std::vector<std::thread> threads;
+            for (unsigned rank = 0; rank < GROUP_SIZE; ++rank) {
+                threads.push_back(std::thread(&test_ucg::run_rank, this,
+                                              topo_t(topo), rank, func));
+            }
+
+            for (std::thread &thread : threads) {
+                thread.join();
+            }
+        }
+    }
+
+    /* Element 'i' contributed by 'rank' */
+    template <typename T>
+    static T value(unsigned rank, size_t i)
+    {
+        return T((rank + 1) * ((i % 100) + 1));
+    }
+
+    template <typename T>
+    static T expected(ucg_op_t op, size_t i)
+    {
+        switch (op) {
+        case UCG_OP_SUM:
+            return T(((i % 100) + 1) * GROUP_SIZE * (GROUP_SIZE + 1) / 2);
+        case UCG_OP_MIN:
+            return value<T>(0, i);
+        default:
+            return value<T>(GROUP_SIZE - 1, i);
+        }
+    }
+
+    template <typename T>
+    void check_reduce(ucg_dt_t dt, bool all, bool in_place)
+    {
+        /* Several fragments, the last one partial */
+        const size_t count = (FRAG_SIZE * 5 / sizeof(T)) + 3;
+
+        run([&](ucg_group_h group, unsigned rank) {
+            std::vector<T> sbuf(count), rbuf(count);
+            ucs_status_t status;
+            std::ostringstream title;
+
+            for (int op = 0; op < UCG_OP_LAST; ++op) {
+                for (unsigned root = 0; root < (all ? 1 : GROUP_SIZE);
+                     ++root) {
+                    for (size_t i = 0; i < count; ++i) {
+                        sbuf[i] = value<T>(rank, i);
+                        rbuf[i] = T(0);
+                    }
+
+                    T *dst = in_place ? &sbuf[0] : &rbuf[0];
+                    if (all) {
+                        status = ucg_allreduce(group, &sbuf[0], dst, count, dt,
+                                               ucg_op_t(op));
+                    } else {
+                        status = ucg_reduce(group, &sbuf[0], dst, count, dt,
+                                            ucg_op_t(op), root);
+                    }
+                    check_status(status, all ? "ucg_allreduce" : "ucg_reduce",
+                                 rank);
+
+                    if (!all && (rank != root)) {
+                        continue;
+                    }
+
+                    title.str("");
+                    title << "rank=" << rank << " op=" << op << " root="
+                          << root;
+                    check_buffer<T>(dst, count,
+                                    [op](size_t i) {
+                                        return expected<T>(ucg_op_t(op), i);
+                                    },
+                                    title.str());
+                }
+            }
+        });
+    }
+
+private:
+    pthread_barrier_t m_barrier;
+    std::vector<char> m_oob_data;
+};
+
+
+UCS_TEST_F(test_ucg, barrier) {
+    volatile unsigned arrived[GROUP_SIZE] = {};
+
+    run([&](ucg_group_h group, unsigned rank) {
+        for (unsigned iter = 1; iter <= 10; ++iter) {
+            arrived[rank] = iter;
+            check_status(ucg_barrier(group), "ucg_barrier", rank);
+            for (unsigned i = 0; i < GROUP_SIZE; ++i) {
+                EXPECT_GE(arrived[i], iter);
+            }
+            check_status(ucg_barrier(group), "ucg_barrier", rank);
+        }
+    });
+}
+
+UCS_TEST_F(test_ucg, bcast) {
+    const size_t length = (FRAG_SIZE * 3) + 17;
+
+    run([&](ucg_group_h group, unsigned rank) {
+        std::vector<uint8_t> buffer(length);
+
+        for (unsigned root = 0; root < GROUP_SIZE; ++root) {
+            for (size_t i = 0; i < length; ++i) {
+                buffer[i] = (rank == root) ? uint8_t(i + root) : 0;
+            }
+
+            check_status(ucg_bcast(group, &buffer[0], length, root),
+                         "ucg_bcast", rank);
+            check_buffer<uint8_t>(&buffer[0], length,
+                                  [root](size_t i) {
+                                      return uint8_t(i + root);
+                                  },
+                                  "rank=" + std::to_string(rank) + " root=" +
+                                  std::to_string(root));
+        }
+    });
+}
+
+UCS_TEST_F(test_ucg, bcast_slow_member) {
+    const unsigned num_iters = 64;
+
+    /* Fast members fill the other buffer slot while the slow one still reads
+     * the previous fragment */
+    run([&](ucg_group_h group, unsigned rank) {
+        std::vector<uint8_t> buffer(FRAG_SIZE);
+
+        for (unsigned iter = 0; iter < num_iters; ++iter) {
+            for (size_t i = 0; i < FRAG_SIZE; ++i) {
+                buffer[i] = (rank == 0) ? uint8_t(i + iter) : 0;
+            }
+
+            if (rank == (GROUP_SIZE - 1)) {
+                usleep(iter % 7);
+            }
+
+            check_status(ucg_bcast(group, &buffer[0], FRAG_SIZE, 0),
+                         "ucg_bcast", rank);
+            check_buffer<uint8_t>(&buffer[0], FRAG_SIZE,
+                                  [iter](size_t i) {
+                                      return uint8_t(i + iter);
+                                  },
+                                  "rank=" + std::to_string(rank) + " iter=" +
+                                  std::to_string(iter));
+        }
+    });
+}
+
+UCS_TEST_F(test_ucg, reduce) {
+    check_reduce<int32_t>(UCG_DT_INT32, false, false);
+    check_reduce<double>(UCG_DT_DOUBLE, false, true);
+}
+
+UCS_TEST_F(test_ucg, allreduce) {
+    check_reduce<int32_t>(UCG_DT_INT32, true, false);
+    check_reduce<int64_t>(UCG_DT_INT64, true, false);
+    check_reduce<float>(UCG_DT_FLOAT, true, false);
+    check_reduce<double>(UCG_DT_DOUBLE, true, false);
+}
+
+UCS_TEST_F(test_ucg, allreduce_in_place) {
+    check_reduce<int64_t>(UCG_DT_INT64, true, true);
+}
+
+UCS_TEST_F(test_ucg, invalid_params) {
+    ucg_group_params_t params;
+    ucg_group_h group;
+
+    params.field_mask = UCG_GROUP_PARAM_FIELD_RANK |
+                        UCG_GROUP_PARAM_FIELD_SIZE;
+    params.rank       = 0;
+    params.size       = 1;
+
+    scoped_log_handler wrap_err(wrap_errors_logger);
+    EXPECT_EQ(UCS_ERR_INVALID_PARAM, ucg_group_create(&params, &group));
+}
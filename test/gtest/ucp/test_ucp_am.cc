@@ -609,7 +609,8 @@ protected:
         EXPECT_EQ(has_reply_ep, rx_param->reply_ep != NULL);
 
         if (!(rx_param->recv_attr &
-              (UCP_AM_RECV_ATTR_FLAG_RNDV | UCP_AM_RECV_ATTR_FLAG_DATA))) {
+              (UCP_AM_RECV_ATTR_FLAG_RNDV | UCP_AM_RECV_ATTR_FLAG_DATA |
+               UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG))) {
             mem_buffer::pattern_check(data, length, SEED);
             m_recv_counter++;
             return UCS_OK;
@@ -1551,6 +1552,157 @@ UCS_TEST_SKIP_COND_P(test_ucp_am_nbx_dts, zcopy_send,
 UCP_INSTANTIATE_TEST_CASE(test_ucp_am_nbx_dts)
 
 
+class test_ucp_am_nbx_multi_frag : public test_ucp_am_nbx_reply {
+public:
+    test_ucp_am_nbx_multi_frag() : m_rx_desc(NULL)
+    {
+        modify_config("RNDV_THRESH", "inf");
+    }
+
+    virtual ucs_status_t
+    am_data_handler(const void *header, size_t header_length, void *data,
+                    size_t length, const ucp_am_recv_param_t *rx_param)
+    {
+        EXPECT_FALSE(rx_param->recv_attr & UCP_AM_RECV_ATTR_FLAG_RNDV);
+        if (rx_param->recv_attr & UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG) {
+            EXPECT_FALSE(rx_param->recv_attr & UCP_AM_RECV_ATTR_FLAG_DATA);
+        }
+
+        return test_ucp_am_nbx::am_data_handler(header, header_length, data,
+                                                length, rx_param);
+    }
+
+    static ucs_status_t am_data_hold_desc_cb(void *arg, const void *header,
+                                             size_t header_length, void *data,
+                                             size_t length,
+                                             const ucp_am_recv_param_t *param)
+    {
+        test_ucp_am_nbx_multi_frag *self =
+                reinterpret_cast<test_ucp_am_nbx_multi_frag*>(arg);
+
+        EXPECT_TRUE(param->recv_attr & UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG);
+        EXPECT_EQ(NULL, self->m_rx_desc);
+        self->m_rx_desc = data;
+        return UCS_INPROGRESS;
+    }
+
+    static ucs_status_t am_data_drop_cb(void *arg, const void *header,
+                                        size_t header_length, void *data,
+                                        size_t length,
+                                        const ucp_am_recv_param_t *param)
+    {
+        test_ucp_am_nbx_multi_frag *self =
+                reinterpret_cast<test_ucp_am_nbx_multi_frag*>(arg);
+
+        EXPECT_TRUE(param->recv_attr & UCP_AM_RECV_ATTR_FLAG_MULTI_FRAG);
+        self->m_recv_counter++;
+        return UCS_OK;
+    }
+
+    void test_multi_frag_recv(size_t size)
+    {
+        test_am_send_recv(size, 0, 0, UCP_AM_FLAG_MULTI_FRAG_RECV);
+        test_am_send_recv(size, 8, 0, UCP_AM_FLAG_MULTI_FRAG_RECV);
+    }
+
+    /* Receive the message after all its fragments arrived */
+    void test_deferred_recv(size_t size)
+    {
+        mem_buffer sbuf(size, tx_memtype());
+        sbuf.pattern_fill(SEED);
+        reset_counters();
+        m_hdr.clear();
+
+        set_am_data_handler(receiver(), TEST_AM_NBX_ID, am_data_hold_desc_cb,
+                            this, UCP_AM_FLAG_MULTI_FRAG_RECV);
+
+        ucp::data_type_desc_t sdt_desc(m_dt, sbuf.ptr(), size);
+        ucs_status_ptr_t sptr = send_am(sdt_desc, get_send_flag());
+        request_wait(sptr);
+        wait_for_flag(&m_rx_desc);
+        ASSERT_NE((void*)NULL, m_rx_desc);
+
+        /* Let the remaining fragments arrive before receiving */
+        short_progress_loop();
+
+        ucs_status_t status = am_data_rndv_handler(m_rx_desc, size);
+        ASSERT_FALSE(UCS_STATUS_IS_ERR(status));
+        wait_receives();
+        EXPECT_EQ(m_recv_counter, m_send_counter);
+        m_rx_desc = NULL;
+    }
+
+    void test_drop(size_t size)
+    {
+        mem_buffer sbuf(size, tx_memtype());
+        sbuf.pattern_fill(SEED);
+        reset_counters();
+
+        set_am_data_handler(receiver(), TEST_AM_NBX_ID, am_data_drop_cb, this,
+                            UCP_AM_FLAG_MULTI_FRAG_RECV);
+
+        ucp::data_type_desc_t sdt_desc(m_dt, sbuf.ptr(), size);
+        ucs_status_ptr_t sptr = send_am(sdt_desc, get_send_flag());
+        wait_receives();
+        request_wait(sptr);
+
+        /* Dropped fragments must not be left on the endpoint */
+        short_progress_loop();
+        ucp_ep_ext_cold_t *cold = receiver().ep()->ext->cold;
+        ASSERT_NE((void*)NULL, cold);
+        EXPECT_TRUE(ucs_queue_is_empty(&cold->am.mid_rdesc_q));
+        EXPECT_TRUE(ucs_list_is_empty(&cold->am.started_ams));
+    }
+
+protected:
+    void * volatile m_rx_desc;
+};
+
+UCS_TEST_P(test_ucp_am_nbx_multi_frag, bcopy, "ZCOPY_THRESH=inf")
+{
+    test_datatypes([&]() {
+        test_multi_frag_recv(fragment_size() / 2);
+        test_multi_frag_recv(fragment_size() * 4 + 7);
+    });
+}
+
+UCS_TEST_P(test_ucp_am_nbx_multi_frag, zcopy, "ZCOPY_THRESH=1")
+{
+    skip_no_am_lane_caps(UCT_IFACE_FLAG_AM_ZCOPY, "am_zcopy is not supported");
+    test_datatypes([&]() { test_multi_frag_recv(64 * UCS_KBYTE); });
+}
+
+UCS_TEST_P(test_ucp_am_nbx_multi_frag, deferred_recv, "ZCOPY_THRESH=inf")
+{
+    test_deferred_recv(fragment_size() * 8);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_multi_frag, drop, "ZCOPY_THRESH=inf")
+{
+    test_drop(fragment_size() * 8);
+    test_multi_frag_recv(fragment_size() * 3);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_multi_frag, invalid_flags)
+{
+    ucp_am_handler_param_t params;
+
+    params.field_mask = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                        UCP_AM_HANDLER_PARAM_FIELD_CB |
+                        UCP_AM_HANDLER_PARAM_FIELD_FLAGS;
+    params.id         = TEST_AM_NBX_ID;
+    params.cb         = am_data_cb;
+    params.flags      = UCP_AM_FLAG_MULTI_FRAG_RECV |
+                        UCP_AM_FLAG_PERSISTENT_DATA;
+
+    scoped_log_handler wrap_err(wrap_errors_logger);
+    EXPECT_EQ(UCS_ERR_INVALID_PARAM,
+              ucp_worker_set_am_recv_handler(receiver().worker(), &params));
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_am_nbx_multi_frag)
+
+
 class test_ucp_am_nbx_rndv : public test_ucp_am_nbx_prereg {
 public:
     struct am_cb_args {
@@ -10,6 +10,7 @@
 extern "C" {
 #include <ucp/core/ucp_types.h> /* for atomic mode */
 #include <ucp/core/ucp_mm.h>
+#include <ucp/core/ucp_worker.h>
 }
 
 template <typename T>
@@ -113,6 +114,94 @@ public:
         EXPECT_EQ(prev, reply_data); /* expect the previous value */
     }
 
+    void batch_add(size_t size, void *expected_data, ucp_mem_h memh,
+                   void *target_ptr, ucp_rkey_h rkey, void *arg)
+    {
+        /* Keep many operations in flight, to let the target execute and reply
+         * to several of them at once */
+        static const unsigned num_ops = 64;
+        const send_func_data* data    = (send_func_data*)arg;
+        std::vector<T> values(num_ops), replies(num_ops);
+        std::vector<void*> reqs;
+        T prev, result;
+
+        count_am(receiver(), UCP_AM_ID_ATOMIC_REQ, m_req_counter);
+        count_am(sender(), UCP_AM_ID_ATOMIC_REP_BATCH, m_rep_batch_counter);
+
+        mem_buffer::copy_from(&prev, target_ptr, sizeof(T),
+                              data->recv_mem_type);
+        result = prev;
+        for (unsigned i = 0; i < num_ops; ++i) {
+            values[i] = ucs::rand() % 1000;
+
+            ucp_request_param_t param;
+            param.op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE |
+                                 UCP_OP_ATTR_FIELD_REPLY_BUFFER;
+            param.datatype     = ucp_dt_make_contig(sizeof(T));
+            param.reply_buffer = &replies[i];
+
+            ucs_status_ptr_t status_ptr =
+                    ucp_atomic_op_nbx(sender().ep(), UCP_ATOMIC_OP_ADD,
+                                      &values[i], 1, (uintptr_t)target_ptr,
+                                      rkey, &param);
+            ASSERT_UCS_PTR_OK(status_ptr);
+            if (status_ptr != NULL) {
+                reqs.push_back(status_ptr);
+            }
+        }
+
+        ASSERT_UCS_OK(requests_wait(reqs));
+
+        /* The operations are executed in the order they were sent, so every
+         * operation fetches the sum of all previous ones */
+        for (unsigned i = 0; i < num_ops; ++i) {
+            EXPECT_EQ(result, replies[i]) << "i=" << i;
+            result += values[i];
+        }
+
+        mem_buffer::copy_to(expected_data, &result, sizeof(T),
+                            data->send_mem_type);
+    }
+
+    void batch_fence_put(size_t size, void *expected_data, ucp_mem_h memh,
+                         void *target_ptr, ucp_rkey_h rkey, void *arg)
+    {
+        static const unsigned num_ops = 64;
+        const send_func_data* data    = (send_func_data*)arg;
+        T value                       = 1;
+        T put_value                   = (T)ucs::rand() * (T)ucs::rand();
+        std::vector<void*> reqs;
+        ucp_request_param_t param;
+        ucs_status_ptr_t status_ptr;
+
+        param.op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE;
+        param.datatype     = ucp_dt_make_contig(sizeof(T));
+        for (unsigned i = 0; i < num_ops; ++i) {
+            status_ptr = ucp_atomic_op_nbx(sender().ep(), UCP_ATOMIC_OP_ADD,
+                                           &value, 1, (uintptr_t)target_ptr,
+                                           rkey, &param);
+            ASSERT_UCS_PTR_OK(status_ptr);
+            if (status_ptr != NULL) {
+                reqs.push_back(status_ptr);
+            }
+        }
+
+        /* The put must not be overwritten by the atomics issued before it */
+        ASSERT_UCS_OK(ucp_worker_fence(sender().worker()));
+
+        param.op_attr_mask = 0;
+        status_ptr         = ucp_put_nbx(sender().ep(), &put_value, sizeof(T),
+                                         (uintptr_t)target_ptr, rkey, &param);
+        ASSERT_UCS_PTR_OK(status_ptr);
+        if (status_ptr != NULL) {
+            reqs.push_back(status_ptr);
+        }
+
+        ASSERT_UCS_OK(requests_wait(reqs));
+        mem_buffer::copy_to(expected_data, &put_value, sizeof(T),
+                            data->send_mem_type);
+    }
+
 protected:
     static const uint64_t POST_ATOMIC_OPS  = UCS_BIT(UCP_ATOMIC_OP_ADD) |
                                              UCS_BIT(UCP_ATOMIC_OP_AND) |
@@ -133,6 +222,53 @@ protected:
         test_ucp_memheap::init();
     }
 
+    struct am_counter {
+        ucp_worker_h worker;
+        uint8_t      am_id;
+        unsigned     count;
+    };
+
+    static ucs_status_t
+    counting_am_handler(void *arg, void *data, size_t length, unsigned flags)
+    {
+        am_counter *counter = (am_counter*)arg;
+
+        ++counter->count;
+        return ucp_am_handlers[counter->am_id]->cb(counter->worker, data,
+                                                   length, flags);
+    }
+
+    /* Count the active messages with the given id received by the entity */
+    void count_am(entity &e, uint8_t am_id, am_counter &counter) {
+        ucp_worker_h worker = e.worker();
+
+        counter.worker = worker;
+        counter.am_id  = am_id;
+        for (unsigned i = 0; i < worker->num_ifaces; ++i) {
+            ucp_worker_iface_t *wiface = worker->ifaces[i];
+            if ((wiface->activate_count == 0) ||
+                !(wiface->attr.cap.flags & UCT_IFACE_FLAG_AM_BCOPY)) {
+                continue;
+            }
+
+            ASSERT_UCS_OK(uct_iface_set_am_handler(
+                    wiface->iface, am_id, counting_am_handler, &counter,
+                    ucp_am_handlers[am_id]->flags));
+        }
+    }
+
+    void test_batch(send_func_t send_func) {
+        m_req_counter.count       = 0;
+        m_rep_batch_counter.count = 0;
+        test(send_func, UCS_BIT(UCP_ATOMIC_OP_ADD));
+
+        if (m_req_counter.count > 0) {
+            /* Software atomics were used, so some replies had to be sent
+             * together */
+            EXPECT_GT(m_rep_batch_counter.count, 0u);
+        }
+    }
+
     static unsigned default_num_iters() {
         return ucs_max(100 / ucs::test_time_multiplier(), 1);
     }
@@ -182,6 +318,9 @@ private:
         }
     }
 
+    am_counter m_req_counter;
+    am_counter m_rep_batch_counter;
+
     ucs_status_t do_atomic(ucp_atomic_op_t op, size_t size, void *target_ptr,
                            ucp_rkey_h rkey, void* value, ucp_request_param_t &param) {
 
@@ -272,6 +411,10 @@ UCS_TEST_P(test_ucp_atomic32, fetch) {
     test(static_cast<send_func_t>(&test_ucp_atomic32::fetch), FETCH_ATOMIC_OPS);
 }
 
+UCS_TEST_P(test_ucp_atomic32, batch) {
+    test_batch(static_cast<send_func_t>(&test_ucp_atomic32::batch_add));
+}
+
 UCP_INSTANTIATE_TEST_CASE_GPU_AWARE(test_ucp_atomic32)
 
 class test_ucp_atomic64 : public test_ucp_atomic<uint64_t> {
@@ -285,6 +428,29 @@ UCS_TEST_P(test_ucp_atomic64, fetch) {
     test(static_cast<send_func_t>(&test_ucp_atomic64::fetch), FETCH_ATOMIC_OPS);
 }
 
+UCS_TEST_P(test_ucp_atomic64, batch) {
+    test_batch(static_cast<send_func_t>(&test_ucp_atomic64::batch_add));
+}
+
+class test_ucp_atomic_fence : public test_ucp_atomic<uint64_t> {
+public:
+    static void get_test_variants(std::vector<ucp_test_variant>& variants)
+    {
+        test_ucp_atomic<uint64_t>::get_test_variants(variants);
+        for (size_t i = 0; i < variants.size(); ++i) {
+            variants[i].ctx_params.features |= UCP_FEATURE_RMA;
+        }
+    }
+};
+
+UCS_TEST_P(test_ucp_atomic_fence, batch_put, "FENCE_MODE=weak") {
+    test(static_cast<send_func_t>(&test_ucp_atomic_fence::batch_fence_put),
+         UCS_BIT(UCP_ATOMIC_OP_ADD));
+}
+
+/* A weak fence orders operations only on the same lane, which is the case when
+ * both put and atomics are emulated over TCP active messages */
+UCP_INSTANTIATE_TEST_CASE_TLS(test_ucp_atomic_fence, tcp, "tcp")
 
 #if ENABLE_PARAMS_CHECK
 UCS_TEST_P(test_ucp_atomic32, misaligned_post) {
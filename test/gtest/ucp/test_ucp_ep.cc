@@ -6,6 +6,14 @@
 
 #include "ucp_test.h"
 #include <ucp/core/ucp_context.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/sys/sock.h>
+
+#include <ifaddrs.h>
+
+extern "C" {
+#include <ucp/core/ucp_ep.inl>
+}
 
 class test_ucp_ep : public ucp_test {
 public:
@@ -93,3 +101,270 @@ UCS_TEST_P(test_ucp_ep, ucp_query_transport)
 }
 
 UCP_INSTANTIATE_TEST_CASE(test_ucp_ep);
+
+
+class test_ucp_ep_memory : public ucp_test {
+public:
+    static void get_test_variants(std::vector<ucp_test_variant> &variants)
+    {
+        add_variant(variants, UCP_FEATURE_TAG | UCP_FEATURE_STREAM);
+    }
+
+    /// @override
+    virtual void init()
+    {
+        /* Track all allocations made by the workers and endpoints */
+        ucs_memtrack_cleanup();
+        push_config();
+        modify_config("MEMTRACK_DEST", "/dev/null");
+        ucs_memtrack_init();
+
+        ucp_test::init();
+    }
+
+    /// @override
+    virtual void cleanup()
+    {
+        ucp_test::cleanup();
+
+        ucs_memtrack_cleanup();
+        pop_config();
+        ucs_memtrack_init();
+    }
+
+protected:
+    static size_t allocated_size()
+    {
+        ucs_memtrack_entry_t total;
+
+        ucs_memtrack_total(&total);
+        return total.size;
+    }
+
+    static const int num_eps = 64;
+};
+
+UCS_TEST_P(test_ucp_ep_memory, bytes_per_ep)
+{
+    uint64_t send_data = 0xdeadbeef;
+    size_t initial_size, base_size, stream_size;
+    ucp_request_param_t param;
+
+    ASSERT_TRUE(ucs_memtrack_is_enabled());
+
+    /* Measure the memory allocated by both sides of connected endpoints,
+     * averaged over many endpoints to amortize allocator chunks */
+    initial_size = allocated_size();
+    for (int i = 0; i < num_eps; ++i) {
+        sender().connect(&receiver(), get_ep_params(), i);
+    }
+    flush_workers();
+
+    /* Endpoints without stream or AM traffic have no cold section */
+    for (int i = 0; i < num_eps; ++i) {
+        EXPECT_EQ(NULL, sender().ep(0, i)->ext->cold);
+    }
+
+    base_size = allocated_size();
+    ASSERT_GT(base_size, initial_size);
+    UCS_TEST_MESSAGE << "bytes per endpoint pair: "
+                     << (base_size - initial_size) / num_eps;
+    EXPECT_GE(base_size - initial_size,
+              num_eps * (sizeof(ucp_ep_t) + sizeof(ucp_ep_ext_t)));
+
+    /* Stream data allocates the cold section of the receiving endpoints */
+    param.op_attr_mask = 0;
+    for (int i = 0; i < num_eps; ++i) {
+        ASSERT_UCS_OK(request_wait(ucp_stream_send_nbx(sender().ep(0, i),
+                                                       &send_data,
+                                                       sizeof(send_data),
+                                                       &param)));
+    }
+    flush_workers();
+
+    stream_size = allocated_size();
+    UCS_TEST_MESSAGE << "bytes per endpoint pair with stream: "
+                     << (stream_size - initial_size) / num_eps;
+    EXPECT_GE(stream_size, base_size + (num_eps * sizeof(ucp_ep_ext_cold_t)));
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_ep_memory);
+
+
+class test_ucp_ep_batch : public ucp_test {
+public:
+    static void get_test_variants(std::vector<ucp_test_variant> &variants)
+    {
+        add_variant(variants, UCP_FEATURE_TAG);
+    }
+
+    /// @override
+    virtual void init()
+    {
+        ucp_test::init();
+        /* sender() is the first entity, all others are peers */
+        while (entities().size() < (num_peers + 1)) {
+            create_entity();
+        }
+    }
+
+protected:
+    static const size_t num_peers = 8;
+};
+
+UCS_TEST_SKIP_COND_P(test_ucp_ep_batch, create, is_self())
+{
+    std::vector<ucp_address_t*> addresses(num_peers);
+    std::vector<ucp_ep_params_t> ep_params(num_peers);
+    std::vector<ucp_ep_h> eps(num_peers);
+    ucp_request_param_t param;
+    size_t address_length;
+    ucs_status_t status;
+
+    for (size_t i = 0; i < num_peers; ++i) {
+        status = ucp_worker_get_address(e(i + 1).worker(), &addresses[i],
+                                        &address_length);
+        ASSERT_UCS_OK(status);
+
+        ep_params[i]             = get_ep_params();
+        ep_params[i].field_mask |= UCP_EP_PARAM_FIELD_REMOTE_ADDRESS;
+        ep_params[i].address     = addresses[i];
+    }
+
+    status = ucp_ep_create_batch(sender().worker(), num_peers,
+                                 ep_params.data(), eps.data());
+    for (size_t i = 0; i < num_peers; ++i) {
+        ucp_worker_release_address(e(i + 1).worker(), addresses[i]);
+    }
+    ASSERT_UCS_OK(status);
+
+    param.op_attr_mask = 0;
+    for (size_t i = 0; i < num_peers; ++i) {
+        /* All peers have the same devices, so they get the same lanes */
+        EXPECT_EQ(eps[0]->cfg_index, eps[i]->cfg_index);
+
+        uint64_t send_data = i, recv_data = 0;
+        void *sreq = ucp_tag_send_nbx(eps[i], &send_data, sizeof(send_data),
+                                      i, &param);
+        void *rreq = ucp_tag_recv_nbx(e(i + 1).worker(), &recv_data,
+                                      sizeof(recv_data), i, UINT64_MAX,
+                                      &param);
+        ASSERT_UCS_OK(request_wait(sreq));
+        ASSERT_UCS_OK(request_wait(rreq));
+        EXPECT_EQ(send_data, recv_data);
+    }
+
+    for (size_t i = 0; i < num_peers; ++i) {
+        ASSERT_UCS_OK(request_wait(ucp_ep_close_nbx(eps[i], &param)));
+    }
+}
+
+UCS_TEST_P(test_ucp_ep_batch, invalid_param)
+{
+    std::vector<ucp_ep_params_t> ep_params(num_peers, get_ep_params());
+    std::vector<ucp_ep_h> eps(num_peers);
+    ucs_status_t status;
+
+    scoped_log_handler wrap_err(wrap_errors_logger);
+    status = ucp_ep_create_batch(sender().worker(), num_peers,
+                                 ep_params.data(), eps.data());
+    EXPECT_EQ(UCS_ERR_INVALID_PARAM, status);
+}
+
+UCS_TEST_SKIP_COND_P(test_ucp_ep_batch, create_multi_node,
+                     is_self() || !has_transport("tcp"))
+{
+    const size_t num_nodes = 4;
+    std::vector<std::vector<uint8_t> > addresses(num_nodes);
+    std::vector<ucp_ep_params_t> ep_params(num_nodes);
+    std::vector<ucp_ep_h> eps(num_nodes);
+    ucp_worker_h worker = sender().worker();
+    struct ifaddrs *ifaddrs, *ifa;
+    ucp_address_t *address;
+    size_t address_length, cache_size, offset;
+    ucp_request_param_t param;
+    uint64_t send_data, recv_data;
+    ucs_status_t status;
+    void *sreq, *rreq;
+    uint32_t in_addr;
+    uint8_t host;
+
+    status = ucp_worker_get_address(e(1).worker(), &address, &address_length);
+    ASSERT_UCS_OK(status);
+    addresses[0].assign((uint8_t*)address, (uint8_t*)address + address_length);
+    ucp_worker_release_address(e(1).worker(), address);
+
+    /* Find the device address of a non-loopback TCP interface, which is the
+     * IP address of the host */
+    ASSERT_EQ(0, getifaddrs(&ifaddrs));
+    offset = 0;
+    for (ifa = ifaddrs; (ifa != NULL) && (offset == 0); ifa = ifa->ifa_next) {
+        if ((ifa->ifa_addr == NULL) || (ifa->ifa_addr->sa_family != AF_INET) ||
+            ucs_sockaddr_is_inaddr_loopback(ifa->ifa_addr)) {
+            continue;
+        }
+
+        in_addr = ((struct sockaddr_in*)ifa->ifa_addr)->sin_addr.s_addr;
+        for (size_t i = 0; i + sizeof(in_addr) <= address_length; ++i) {
+            if (!memcmp(&addresses[0][i], &in_addr, sizeof(in_addr))) {
+                offset = i;
+                break;
+            }
+        }
+    }
+    freeifaddrs(ifaddrs);
+
+    if (offset == 0) {
+        UCS_TEST_SKIP_R("no TCP device address in the worker address");
+    }
+
+    /* Simulate peers on other hosts of the same subnet, with the same devices
+     * and transports */
+    host = addresses[0][offset + sizeof(in_addr) - 1];
+    for (size_t i = 1; i < num_nodes; ++i) {
+        addresses[i]                               = addresses[0];
+        addresses[i][offset + sizeof(in_addr) - 1] = ((host + i - 1) % 254) + 1;
+    }
+
+    for (size_t i = 0; i < num_nodes; ++i) {
+        ep_params[i]                 = get_ep_params();
+        ep_params[i].field_mask     |= UCP_EP_PARAM_FIELD_REMOTE_ADDRESS |
+                                       UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE;
+        ep_params[i].address         = (ucp_address_t*)addresses[i].data();
+        ep_params[i].err_mode        = UCP_ERR_HANDLING_MODE_PEER;
+    }
+
+    cache_size = kh_size(&worker->lane_cache_hash);
+    {
+        scoped_log_handler slh(wrap_errors_logger);
+        status = ucp_ep_create_batch(worker, num_nodes, ep_params.data(),
+                                     eps.data());
+    }
+    ASSERT_UCS_OK(status);
+
+    /* The lanes were selected only for the first host */
+    EXPECT_EQ(cache_size + 1, kh_size(&worker->lane_cache_hash));
+    for (size_t i = 0; i < num_nodes; ++i) {
+        EXPECT_EQ(eps[0]->cfg_index, eps[i]->cfg_index);
+    }
+
+    param.op_attr_mask = 0;
+    send_data          = 0xdeadbeef;
+    recv_data          = 0;
+    sreq = ucp_tag_send_nbx(eps[0], &send_data, sizeof(send_data), 0, &param);
+    rreq = ucp_tag_recv_nbx(e(1).worker(), &recv_data, sizeof(recv_data), 0,
+                            0, &param);
+    ASSERT_UCS_OK(request_wait(sreq));
+    ASSERT_UCS_OK(request_wait(rreq));
+    EXPECT_EQ(send_data, recv_data);
+
+    /* The simulated hosts do not exist */
+    param.op_attr_mask = UCP_OP_ATTR_FIELD_FLAGS;
+    param.flags        = UCP_EP_CLOSE_FLAG_FORCE;
+    scoped_log_handler slh(wrap_errors_logger);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        request_wait(ucp_ep_close_nbx(eps[i], &param));
+    }
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_ep_batch);
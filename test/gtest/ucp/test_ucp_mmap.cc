@@ -902,6 +902,52 @@ UCS_TEST_P(test_ucp_mmap, fixed) {
     }
 }
 
+UCS_TEST_P(test_ucp_mmap, alloc_shm_heap, "SHM_HEAP_MAX_ALLOC=64k") {
+    static const size_t max_alloc = 64 * UCS_KBYTE;
+    bool expect_rma_offload       = (is_tl_rdma() || is_tl_shm()) &&
+                                    check_reg_mem_types(sender(),
+                                                        UCS_MEMORY_TYPE_HOST);
+    std::vector<ucp_mem_h> memhs;
+    ucp_mem_map_params_t params;
+    ucs_status_t status;
+    ucp_mem_h memh;
+
+    params.field_mask = UCP_MEM_MAP_PARAM_FIELD_LENGTH |
+                        UCP_MEM_MAP_PARAM_FIELD_FLAGS;
+    params.flags      = UCP_MEM_MAP_ALLOCATE | mem_map_flags();
+
+    for (int i = 0; i < (100 / ucs::test_time_multiplier()); ++i) {
+        params.length = 1 + (ucs::rand() % (2 * max_alloc));
+        status        = ucp_mem_map(sender().ucph(), &params, &memh);
+        ASSERT_UCS_OK(status);
+        memhs.push_back(memh);
+
+        EXPECT_EQ(params.length <= max_alloc,
+                  !!(memh->flags & UCP_MEMH_FLAG_SHM_HEAP));
+        EXPECT_GE(ucp_memh_length(memh), params.length);
+
+        memset(ucp_memh_address(memh), i, ucp_memh_length(memh));
+        test_rkey_management(memh, false, expect_rma_offload);
+    }
+
+    /* Small buffers are carved from the same heap segment */
+    params.length = 100;
+    for (int i = 0; i < 2; ++i) {
+        status = ucp_mem_map(sender().ucph(), &params, &memh);
+        ASSERT_UCS_OK(status);
+        memhs.push_back(memh);
+    }
+
+    EXPECT_EQ(memhs[memhs.size() - 2]->parent, memhs.back()->parent);
+    EXPECT_NE(ucp_memh_address(memhs[memhs.size() - 2]),
+              ucp_memh_address(memhs.back()));
+
+    for (auto memh : memhs) {
+        status = ucp_mem_unmap(sender().ucph(), memh);
+        ASSERT_UCS_OK(status);
+    }
+}
+
 UCP_INSTANTIATE_TEST_CASE_GPU_AWARE(test_ucp_mmap)
 
 
@@ -1067,6 +1113,79 @@ UCS_TEST_P(test_ucp_rkey_compare, rkey_compare)
 UCP_INSTANTIATE_TEST_CASE_GPU_AWARE(test_ucp_rkey_compare)
 
 
+class test_ucp_rkey_cache : public test_ucp_rkey_compare {
+public:
+    void init() override
+    {
+        modify_config("RKEY_CACHE_SIZE", "2");
+        test_ucp_rkey_compare::init();
+    }
+
+protected:
+    std::string packed_rkey(const mem_chunk &chunk)
+    {
+        void *rkey_buffer;
+        size_t rkey_size;
+
+        ASSERT_UCS_OK(ucp_rkey_pack(chunk.context, chunk.memh, &rkey_buffer,
+                                    &rkey_size));
+        std::string result((const char*)rkey_buffer, rkey_size);
+        ucp_rkey_buffer_release(rkey_buffer);
+        return result;
+    }
+};
+
+UCS_TEST_P(test_ucp_rkey_cache, lru)
+{
+    ucp_ep_h ep = receiver().ep();
+    ucp_rkey_h rkey0, rkey1;
+
+    /* Same packed key on the same endpoint is unpacked once */
+    if ((packed_rkey(*m_chunks[0]) == packed_rkey(*m_chunks[1])) ||
+        (packed_rkey(*m_chunks[1]) == packed_rkey(*m_chunks[2]))) {
+        UCS_TEST_SKIP_R("packed keys do not depend on the buffer");
+    }
+
+    rkey0 = m_chunks[0]->unpack(ep);
+    EXPECT_EQ(rkey0, m_chunks[0]->unpack(ep));
+
+    rkey1 = m_chunks[1]->unpack(ep);
+    EXPECT_NE(rkey0, rkey1);
+
+    /* Touch the first key, so the second one is evicted */
+    EXPECT_EQ(rkey0, m_chunks[0]->unpack(ep));
+    m_chunks[2]->unpack(ep);
+    EXPECT_EQ(rkey0, m_chunks[0]->unpack(ep));
+    EXPECT_NE(rkey1, m_chunks[1]->unpack(ep));
+}
+
+UCS_TEST_P(test_ucp_rkey_cache, put)
+{
+    static const uint64_t pattern = 0xdeadbeef;
+    ucp_mem_attr_t mem_attr;
+    ucp_request_param_t param;
+    ucp_rkey_h rkey;
+    uint64_t value;
+
+    mem_attr.field_mask = UCP_MEM_ATTR_FIELD_ADDRESS;
+    ASSERT_UCS_OK(ucp_mem_query(m_chunks[0]->memh, &mem_attr));
+
+    param.op_attr_mask = 0;
+    for (int i = 0; i < 3; ++i) {
+        rkey  = m_chunks[0]->unpack(receiver().ep());
+        value = pattern + i;
+        ASSERT_UCS_OK(request_wait(ucp_put_nbx(receiver().ep(), &value,
+                                               sizeof(value),
+                                               (uintptr_t)mem_attr.address,
+                                               rkey, &param)));
+        flush_ep(receiver());
+        EXPECT_EQ(pattern + i, *(uint64_t*)mem_attr.address);
+    }
+}
+
+UCP_INSTANTIATE_TEST_CASE_GPU_AWARE(test_ucp_rkey_cache)
+
+
 class test_ucp_mmap_export : public test_ucp_mmap {
 public:
     static void
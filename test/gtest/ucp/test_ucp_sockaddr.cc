@@ -1146,6 +1146,111 @@ UCS_TEST_P(test_ucp_sockaddr, listen_inaddr_any) {
     connect_and_send_recv(false, SEND_DIRECTION_C2S);
 }
 
+UCS_TEST_P(test_ucp_sockaddr, listen_many_clients) {
+    const int num_clients = 8;
+    ucs_time_t deadline;
+
+    listen(cb_type());
+    {
+        scoped_log_handler slh(detect_error_logger);
+        client_ep_connect();
+        for (int i = 1; i < num_clients; ++i) {
+            create_entity(true);
+            client_ep_connect();
+        }
+
+        /* Connection requests arrive together and are accepted in a batch.
+         * Every client reuses the lanes selected for the first one. */
+        deadline = ucs::get_deadline();
+        while ((receiver().get_num_eps() < num_clients) &&
+               (ucs_get_time() < deadline)) {
+            progress();
+        }
+
+        if (receiver().get_num_eps() < num_clients) {
+            UCS_TEST_SKIP_R("cannot connect to server");
+        }
+    }
+
+    for (int i = 0; i < num_clients; ++i) {
+        send_recv(e(i), receiver(), SEND_RECV_TAG, false, cb_type());
+    }
+
+    /* Let every client get at most one disconnect error */
+    receiver().close_all_eps(*this, 0, 0);
+}
+
+static void destroy_listener_conn_cb(ucp_conn_request_h conn_req, void *arg)
+{
+    ucp_listener_h *listener_p = reinterpret_cast<ucp_listener_h*>(arg);
+
+    ucp_listener_reject(*listener_p, conn_req);
+    ucp_listener_destroy(*listener_p);
+    *listener_p = NULL;
+}
+
+UCS_TEST_SKIP_COND_P(test_ucp_sockaddr, destroy_listener_in_conn_handler,
+                     nonparameterized_test()) {
+    const int num_clients = 4;
+    ucs::sock_addr_storage listen_addr(m_test_addr.to_ucs_sock_addr());
+    ucp_listener_params_t params;
+    ucp_listener_attr_t attr;
+    ucp_listener_h listener;
+    ucs_time_t deadline;
+    ucs_status_t status;
+    uint16_t port;
+
+    listen_addr.set_port(0);
+    params.field_mask       = UCP_LISTENER_PARAM_FIELD_SOCK_ADDR |
+                              UCP_LISTENER_PARAM_FIELD_CONN_HANDLER;
+    params.sockaddr.addr    = listen_addr.get_sock_addr_ptr();
+    params.sockaddr.addrlen = listen_addr.get_addr_size();
+    params.conn_handler.cb  = destroy_listener_conn_cb;
+    params.conn_handler.arg = &listener;
+    status = ucp_listener_create(receiver().worker(), &params, &listener);
+    if (status == UCS_ERR_UNREACHABLE) {
+        UCS_TEST_SKIP_R("cannot listen to " + m_test_addr.to_str());
+    }
+    ASSERT_UCS_OK(status);
+
+    attr.field_mask = UCP_LISTENER_ATTR_FIELD_SOCKADDR;
+    ASSERT_UCS_OK(ucp_listener_query(listener, &attr));
+    ASSERT_UCS_OK(ucs_sockaddr_get_port((const struct sockaddr*)&attr.sockaddr,
+                                        &port));
+    m_test_addr.set_port(port);
+
+    scoped_log_handler slh(wrap_errors_logger);
+    client_ep_connect();
+    for (int i = 1; i < num_clients; ++i) {
+        create_entity(true);
+        client_ep_connect();
+    }
+
+    /* Let the connection requests arrive before the server handles them, so
+     * the first one destroys the listener in the middle of a batch */
+    deadline = ucs_get_time() + ucs_time_from_msec(200);
+    while (ucs_get_time() < deadline) {
+        for (int i = 0; i < num_clients; ++i) {
+            e(i).progress();
+        }
+    }
+
+    deadline = ucs::get_deadline();
+    while ((listener != NULL) && (ucs_get_time() < deadline)) {
+        progress();
+    }
+    ASSERT_TRUE(listener == NULL);
+
+    /* Every client is rejected, either by the handler or by the destroy */
+    deadline = ucs::get_deadline();
+    for (int i = 0; i < num_clients; ++i) {
+        while ((e(i).get_err_num() == 0) && (ucs_get_time() < deadline)) {
+            progress();
+        }
+        EXPECT_EQ(1ul, e(i).get_err_num());
+    }
+}
+
 UCS_TEST_SKIP_COND_P(test_ucp_sockaddr, reject, nonparameterized_test()) {
     listen_and_reject(false);
 }
@@ -587,6 +587,60 @@ UCS_TEST_P(test_ucp_stream, send_exp_recv_iov) {
     do_send_exp_recv_test<uint8_t, UCP_STREAM_RECV_FLAG_WAITALL>(DATATYPE_IOV);
 }
 
+UCS_TEST_P(test_ucp_stream, send_exp_recv_rndv, "RNDV_THRESH=1k") {
+    ucp_datatype_t datatype = ucp_dt_make_contig(sizeof(uint32_t));
+
+    do_send_exp_recv_test<uint32_t, 0>(datatype);
+    do_send_exp_recv_test<uint32_t, UCP_STREAM_RECV_FLAG_WAITALL>(datatype);
+}
+
+UCS_TEST_P(test_ucp_stream, send_recv_rndv, "RNDV_THRESH=1k") {
+    do_send_recv_test<uint8_t, 0>(DATATYPE);
+    do_send_recv_test<uint8_t, UCP_STREAM_RECV_FLAG_WAITALL>(DATATYPE);
+}
+
+UCS_TEST_P(test_ucp_stream, send_recv_data_rndv, "RNDV_THRESH=1k") {
+    do_send_recv_data_test(DATATYPE);
+}
+
+UCS_TEST_P(test_ucp_stream, send_small_exp_recv_rndv, "RNDV_THRESH=1k") {
+    /* The posted receive is smaller than the message, so the message has to
+     * be fetched to a temporary buffer and delivered in parts */
+    const size_t      msg_size  = 64 * UCS_KBYTE;
+    const size_t      recv_size = msg_size / 4;
+    std::vector<char> sbuf(msg_size);
+    std::vector<char> rbuf(msg_size, 'r');
+    ucp_request_param_t param;
+    size_t length;
+
+    ucs::fill_random(sbuf);
+
+    param.op_attr_mask = 0;
+    void *rreq         = ucp_stream_recv_nbx(receiver().ep(), &rbuf[0],
+                                             recv_size, &length, &param);
+    ASSERT_TRUE(UCS_PTR_IS_PTR(rreq));
+
+    ucp::data_type_desc_t dt_desc(DATATYPE, sbuf.data(), sbuf.size());
+    void *sreq = stream_send_nb(dt_desc);
+    EXPECT_FALSE(UCS_PTR_IS_ERR(sreq));
+
+    size_t roffset = wait_stream_recv(rreq);
+    EXPECT_EQ(recv_size, roffset);
+    while (roffset < msg_size) {
+        rreq = ucp_stream_recv_nbx(receiver().ep(), &rbuf[roffset],
+                                   recv_size, &length, &param);
+        ASSERT_FALSE(UCS_PTR_IS_ERR(rreq));
+        if (UCS_PTR_IS_PTR(rreq)) {
+            length = wait_stream_recv(rreq);
+        }
+        roffset += length;
+    }
+
+    request_wait(sreq);
+    EXPECT_EQ(msg_size, roffset);
+    EXPECT_EQ(sbuf, rbuf);
+}
+
 UCS_TEST_P(test_ucp_stream, send_recv_data_recv_8) {
     do_send_recv_data_recv_test(ucp_dt_make_contig(sizeof(uint8_t)));
 }
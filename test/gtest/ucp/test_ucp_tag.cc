@@ -14,6 +14,7 @@ extern "C" {
 #include <ucp/core/ucp_worker.h>
 #include <ucp/core/ucp_ep.h>
 #include <ucp/core/ucp_ep.inl>
+#include <ucp/core/ucp_mm.inl>
 #include <ucs/arch/atomic.h>
 #include <ucs/memory/rcache.h>
 #include <ucs/memory/rcache_int.h>
@@ -715,6 +716,37 @@ UCS_TEST_P(test_ucp_tag_nbx, rndv_zcopy, "ZCOPY_THRESH=0", "RNDV_THRESH=0")
     test_recv_send(64 * UCS_KBYTE);
 }
 
+UCS_TEST_P(test_ucp_tag_nbx, rndv_shm_heap, "RNDV_THRESH=0",
+           "SHM_HEAP_MAX_ALLOC=1m")
+{
+    static const size_t size       = 256 * UCS_KBYTE;
+    ucp_request_param_t send_param = null_param;
+    std::vector<char> recv_buffer(size);
+    ucp_mem_map_params_t params;
+    ucp_mem_h memh;
+
+    if (prereg() || is_iov()) {
+        UCS_TEST_SKIP_R("memory handle is provided by the test");
+    }
+
+    /* Send from a buffer carved from the shared memory heap, which the peer
+     * can access directly */
+    params.field_mask = UCP_MEM_MAP_PARAM_FIELD_LENGTH |
+                        UCP_MEM_MAP_PARAM_FIELD_FLAGS;
+    params.length     = size;
+    params.flags      = UCP_MEM_MAP_ALLOCATE;
+    ASSERT_UCS_OK(ucp_mem_map(sender().ucph(), &params, &memh));
+    EXPECT_TRUE(memh->flags & UCP_MEMH_FLAG_SHM_HEAP);
+
+    ucs::fill_random(ucp_memh_address(memh), size);
+    send_param.op_attr_mask = UCP_OP_ATTR_FIELD_MEMH;
+    send_param.memh         = memh;
+    test_recv_send(size, ucp_memh_address(memh), &recv_buffer[0], send_param);
+    EXPECT_EQ(0, memcmp(ucp_memh_address(memh), &recv_buffer[0], size));
+
+    ASSERT_UCS_OK(ucp_mem_unmap(sender().ucph(), memh));
+}
+
 UCS_TEST_P(test_ucp_tag_nbx, fallback, "ZCOPY_THRESH=inf", "PROTO_ENABLE=n")
 {
     if (!disable_proto() || prereg()) {
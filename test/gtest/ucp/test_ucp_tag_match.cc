@@ -1051,3 +1051,128 @@ UCS_TEST_P(test_ucp_tag_match_rndv_align, recv_align)
 }
 
 UCP_INSTANTIATE_TEST_CASE(test_ucp_tag_match_rndv_align)
+
+class test_ucp_tag_match_self : public test_ucp_tag_match {
+public:
+    void init()
+    {
+        modify_config("RNDV_THRESH", "64k");
+        test_ucp_tag_match::init();
+    }
+
+protected:
+    static const size_t SMALL_SIZE = 1000;
+    static const size_t LARGE_SIZE = 1148576;
+};
+
+UCS_TEST_P(test_ucp_tag_match_self, send_exp)
+{
+    static const size_t sizes[] = {0, SMALL_SIZE, LARGE_SIZE};
+
+    for (size_t size : sizes) {
+        std::vector<char> sendbuf(size, 0);
+        std::vector<char> recvbuf(size, 0);
+
+        ucs::fill_random(sendbuf);
+
+        request *my_recv_req = recv_nb(recvbuf.data(), recvbuf.size(), DATATYPE,
+                                       0x1337, 0xffff);
+        ASSERT_TRUE(!UCS_PTR_IS_ERR(my_recv_req));
+
+        /* The message is copied to the receive buffer while it is sent */
+        request *my_send_req = send_nb(sendbuf.data(), sendbuf.size(), DATATYPE,
+                                       0x111337);
+        EXPECT_TRUE(my_send_req == NULL) << "size=" << size;
+        wait_and_validate(my_send_req);
+
+        wait(my_recv_req);
+        EXPECT_TRUE(my_recv_req->completed);
+        EXPECT_EQ(UCS_OK, my_recv_req->status);
+        EXPECT_EQ(size, my_recv_req->info.length);
+        EXPECT_EQ((ucp_tag_t)0x111337, my_recv_req->info.sender_tag);
+        EXPECT_EQ(sendbuf, recvbuf);
+        request_free(my_recv_req);
+    }
+}
+
+UCS_TEST_P(test_ucp_tag_match_self, send_unexp_small)
+{
+    std::vector<char> sendbuf(SMALL_SIZE, 0);
+    std::vector<char> recvbuf(SMALL_SIZE, 0);
+    ucp_tag_recv_info_t info;
+
+    ucs::fill_random(sendbuf);
+
+    request *my_send_req = send_nb(&sendbuf[0], sendbuf.size(), DATATYPE,
+                                   0x111337);
+    EXPECT_TRUE(my_send_req == NULL);
+    wait_and_validate(my_send_req);
+
+    /* Send buffer can be reused after the send is completed */
+    std::vector<char> expected = sendbuf;
+    std::fill(sendbuf.begin(), sendbuf.end(), 0);
+
+    ucp_tag_message_h message = ucp_tag_probe_nb(receiver().worker(), 0x1337,
+                                                 0xffff, 0, &info);
+    ASSERT_TRUE(message != NULL);
+    EXPECT_EQ(sendbuf.size(), info.length);
+
+    ucs_status_t status = recv_b(&recvbuf[0], recvbuf.size(), DATATYPE, 0x1337,
+                                 0xffff, &info);
+    ASSERT_UCS_OK(status);
+    EXPECT_EQ(sendbuf.size(), info.length);
+    EXPECT_EQ((ucp_tag_t)0x111337, info.sender_tag);
+    EXPECT_EQ(expected, recvbuf);
+}
+
+UCS_TEST_P(test_ucp_tag_match_self, send_unexp_by_ref)
+{
+    std::vector<char> sendbuf(LARGE_SIZE, 0);
+    std::vector<char> recvbuf(LARGE_SIZE, 0);
+    ucp_tag_recv_info_t info;
+
+    ucs::fill_random(sendbuf);
+
+    /* The message is queued by reference, so the send is completed only when
+     * it is received */
+    request *my_send_req = send_nb(&sendbuf[0], sendbuf.size(), DATATYPE,
+                                   0x111337);
+    ASSERT_TRUE(my_send_req != NULL);
+    ASSERT_TRUE(!UCS_PTR_IS_ERR(my_send_req));
+
+    short_progress_loop();
+    EXPECT_FALSE(my_send_req->completed);
+
+    ucp_tag_message_h message = ucp_tag_probe_nb(receiver().worker(), 0x1337,
+                                                 0xffff, 0, &info);
+    ASSERT_TRUE(message != NULL);
+    EXPECT_EQ(sendbuf.size(), info.length);
+    EXPECT_EQ((ucp_tag_t)0x111337, info.sender_tag);
+
+    ucs_status_t status = recv_b(&recvbuf[0], recvbuf.size(), DATATYPE, 0x1337,
+                                 0xffff, &info);
+    ASSERT_UCS_OK(status);
+    EXPECT_EQ(sendbuf.size(), info.length);
+    EXPECT_EQ(sendbuf, recvbuf);
+
+    wait_and_validate(my_send_req);
+}
+
+UCS_TEST_P(test_ucp_tag_match_self, send_unexp_by_ref_truncated)
+{
+    std::vector<char> sendbuf(LARGE_SIZE, 0);
+    std::vector<char> recvbuf(LARGE_SIZE / 2, 0);
+    ucp_tag_recv_info_t info;
+
+    request *my_send_req = send_nb(&sendbuf[0], sendbuf.size(), DATATYPE,
+                                   0x111337);
+    ASSERT_TRUE(!UCS_PTR_IS_ERR(my_send_req));
+
+    ucs_status_t status = recv_b(&recvbuf[0], recvbuf.size(), DATATYPE, 0x1337,
+                                 0xffff, &info);
+    EXPECT_EQ(UCS_ERR_MESSAGE_TRUNCATED, status);
+
+    wait_and_validate(my_send_req);
+}
+
+UCP_INSTANTIATE_TEST_CASE_TLS(test_ucp_tag_match_self, self, "self")
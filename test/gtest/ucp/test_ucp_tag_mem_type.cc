@@ -271,6 +271,25 @@ UCS_TEST_P(test_ucp_tag_mem_type, rndv_4mb, "RNDV_THRESH=0")
     recv_mem_buf.pattern_check(2);
 }
 
+UCS_TEST_P(test_ucp_tag_mem_type, rndv_ppln_adaptive_frag, "RNDV_THRESH=0",
+           "RNDV_FRAG_SIZE=host:256k", "RNDV_PIPELINE_INIT_FRAG_SIZE=16k",
+           "RNDV_PIPELINE_MAX_INFLIGHT=512k")
+{
+    ucp_datatype_t type = ucp_dt_make_contig(1);
+    const size_t length = 8 * UCS_MBYTE;
+
+    mem_buffer recv_mem_buf(length, m_recv_mem_type, 1);
+    mem_buffer send_mem_buf(length, m_send_mem_type, 2);
+
+    size_t recvd = do_xfer(send_mem_buf.ptr(), recv_mem_buf.ptr(), length, type,
+                           type, true, false, false);
+    ASSERT_EQ(length, recvd);
+
+    recv_mem_buf.pattern_check(2);
+    EXPECT_EQ(0ul, receiver().worker()->rndv_ppln_inflight);
+    EXPECT_EQ(0ul, sender().worker()->rndv_ppln_inflight);
+}
+
 UCS_TEST_P(test_ucp_tag_mem_type, xfer_mismatch_length)
 {
     ucp_datatype_t type = ucp_dt_make_contig(1);
@@ -610,6 +610,16 @@ UCS_TEST_P(test_ucp_tag_xfer, contig_unexp) {
     test_xfer(&test_ucp_tag_xfer::test_xfer_contig, false, false, false);
 }
 
+UCS_TEST_P(test_ucp_tag_xfer, contig_exp_dynamic_lanes,
+           "MULTI_LANE_DYNAMIC=y") {
+    test_xfer(&test_ucp_tag_xfer::test_xfer_contig, true, false, false);
+}
+
+UCS_TEST_P(test_ucp_tag_xfer, contig_unexp_dynamic_lanes,
+           "MULTI_LANE_DYNAMIC=y") {
+    test_xfer(&test_ucp_tag_xfer::test_xfer_contig, false, false, false);
+}
+
 UCS_TEST_P(test_ucp_tag_xfer, generic_exp) {
     test_xfer(&test_ucp_tag_xfer::test_xfer_generic, true, false, false);
 }
@@ -1268,4 +1278,190 @@ UCS_TEST_P(multi_rail_max, max_lanes, "IB_NUM_PATHS?=16", "TM_SW_RNDV=y",
 
 UCP_INSTANTIATE_TEST_CASE_TLS(multi_rail_max, ib, "ib")
 
+class multi_rail_dynamic : public multi_rail_max {
+public:
+    void init() override
+    {
+        if (get_variant_value() == VARIANT_PROTO_V1) {
+            UCS_TEST_SKIP_R("dynamic lane selection is implemented by proto v2");
+        }
+
+        multi_rail_max::init();
+
+        /* Establish the lanes */
+        send_msgs(1);
+    }
+
+    unsigned num_lanes() override
+    {
+        return 2;
+    }
+
+protected:
+    typedef std::vector<uint64_t> lane_bytes_t;
+
+    lane_bytes_t send_msgs(unsigned count)
+    {
+        std::vector<uint8_t> sendbuf(msg_size), recvbuf(msg_size);
+        lane_bytes_t lane_bytes = get_lane_bytes();
+
+        for (unsigned i = 0; i < count; ++i) {
+            do_xfer(sendbuf.data(), recvbuf.data(), msg_size, DATATYPE,
+                    DATATYPE, true, false, false);
+        }
+
+        lane_bytes_t result = get_lane_bytes();
+        for (ucp_lane_index_t lane = 0; lane < result.size(); ++lane) {
+            result[lane] -= lane_bytes[lane];
+            UCS_TEST_MESSAGE << "lane[" << static_cast<int>(lane) << "] "
+                             << ucp_ep_get_tl_rsc(sender().ep(), lane)->tl_name
+                             << "/"
+                             << ucp_ep_get_tl_rsc(sender().ep(), lane)->dev_name
+                             << " : " << result[lane];
+        }
+
+        return result;
+    }
+
+    /* Lanes which carried a significant part of the data */
+    std::vector<ucp_lane_index_t> data_lanes(const lane_bytes_t &lane_bytes,
+                                             unsigned count)
+    {
+        std::vector<ucp_lane_index_t> lanes;
+
+        for (ucp_lane_index_t lane = 0; lane < lane_bytes.size(); ++lane) {
+            if (lane_bytes[lane] >= (count * msg_size / 8)) {
+                lanes.push_back(lane);
+            }
+        }
+
+        return lanes;
+    }
+
+    void disconnect_peer(entity *peer)
+    {
+        void *close_req = sender().disconnect_nb(0, 1);
+        while (!is_request_completed(close_req)) {
+            sender().progress();
+            peer->progress();
+        }
+
+        sender().close_ep_req_free(close_req);
+    }
+
+    ucp_worker_iface_t *lane_wiface(ucp_lane_index_t lane)
+    {
+        return ucp_worker_iface(sender().worker(),
+                                ucp_ep_get_rsc_index(sender().ep(), lane));
+    }
+
+    static const size_t msg_size = UCS_MBYTE;
+
+private:
+    lane_bytes_t get_lane_bytes()
+    {
+        lane_bytes_t lane_bytes;
+
+        for (ucp_lane_index_t lane = 0; lane < ucp_ep_num_lanes(sender().ep());
+             ++lane) {
+            lane_bytes.push_back(get_bytes_sent(sender().ep(), lane));
+        }
+
+        return lane_bytes;
+    }
+};
+
+UCS_TEST_P(multi_rail_dynamic, stripe, "MULTI_LANE_DYNAMIC=y", "RNDV_THRESH=1")
+{
+    const unsigned count    = 16;
+    lane_bytes_t lane_bytes = send_msgs(count);
+
+    /* Fragments of every message are spread over both lanes */
+    EXPECT_EQ(2, data_lanes(lane_bytes, count).size());
+}
+
+UCS_TEST_P(multi_rail_dynamic, skip_congested_lane, "MULTI_LANE_DYNAMIC=y",
+           "RNDV_THRESH=1")
+{
+    const unsigned count      = 16;
+    const size_t congest_size = 32 * UCS_MBYTE;
+    lane_bytes_t lane_bytes   = send_msgs(count);
+
+    std::vector<ucp_lane_index_t> lanes = data_lanes(lane_bytes, count);
+    ASSERT_EQ(2, lanes.size());
+
+    /* The first fragment is always sent on the first lane of the protocol,
+     * which also gets the largest share of the data. Congest the other lane. */
+    ucp_lane_index_t congested_lane = (lane_bytes[lanes[0]] <
+                                       lane_bytes[lanes[1]]) ?
+                                      lanes[0] : lanes[1];
+    ucp_lane_index_t other_lane     = (congested_lane == lanes[0]) ?
+                                      lanes[1] : lanes[0];
+    std::string dev_name = ucp_ep_get_tl_rsc(sender().ep(),
+                                             congested_lane)->dev_name;
+    if (dev_name == ucp_ep_get_tl_rsc(sender().ep(), other_lane)->dev_name) {
+        UCS_TEST_SKIP_R("both lanes use the same device");
+    }
+
+    /* Send a large message to another peer, which can use only the device of
+     * the congested lane. The peer stops making progress once the message
+     * data is in flight, so the data is not completed. */
+    modify_config("NET_DEVICES", dev_name);
+    std::unique_ptr<entity> peer(new entity(GetParam(), m_ucp_config,
+                                            get_worker_params(), this));
+    sender().connect(peer.get(), get_ep_params(), 1);
+
+    std::vector<uint8_t> congest_sendbuf(congest_size);
+    std::vector<uint8_t> congest_recvbuf(congest_size);
+    ucp_request_param_t param;
+    param.op_attr_mask = 0;
+    void *rreq = ucp_tag_recv_nbx(peer->worker(), congest_recvbuf.data(),
+                                  congest_size, 0, 0, &param);
+    void *sreq = ucp_tag_send_nbx(sender().ep(0, 1), congest_sendbuf.data(),
+                                  congest_size, 0, &param);
+    ucp_worker_iface_t *congested_wiface = lane_wiface(congested_lane);
+    ucs_time_t deadline                  = ucs::get_deadline();
+    while ((congested_wiface->tx_inflight == 0) &&
+           !is_request_completed(sreq) && (ucs_get_time() < deadline)) {
+        sender().progress();
+        peer->progress();
+    }
+
+    for (unsigned i = 0; i < 100; ++i) {
+        sender().progress();
+    }
+
+    UCS_TEST_MESSAGE << "in flight on " << dev_name << " : "
+                     << congested_wiface->tx_inflight;
+    if (congested_wiface->tx_inflight < (count * msg_size / 8)) {
+        request_wait(sreq, {&sender(), peer.get()});
+        request_wait(rreq, {&sender(), peer.get()});
+        disconnect_peer(peer.get());
+        UCS_TEST_SKIP_R("the protocol does not keep data in flight");
+    }
+
+    /* Only control messages may be sent on the congested lane */
+    lane_bytes = send_msgs(count);
+    lanes      = data_lanes(lane_bytes, count);
+    ASSERT_EQ(1, lanes.size());
+    EXPECT_EQ(other_lane, lanes[0]);
+    EXPECT_LT(lane_bytes[congested_lane], msg_size / 8);
+    EXPECT_GE(lane_bytes[other_lane], count * msg_size);
+
+    /* The data is released from the lane when the transport completes it */
+    request_wait(sreq, {&sender(), peer.get()});
+    request_wait(rreq, {&sender(), peer.get()});
+    EXPECT_EQ(0, congested_wiface->tx_inflight);
+    EXPECT_EQ(0, lane_wiface(other_lane)->tx_inflight);
+
+    disconnect_peer(peer.get());
+    peer.reset();
+
+    /* The lane is used again when it is no longer congested */
+    lane_bytes = send_msgs(count);
+    EXPECT_GE(lane_bytes[congested_lane], count * msg_size / 8);
+}
+
+UCP_INSTANTIATE_TEST_CASE_TLS(multi_rail_dynamic, tcp, "tcp")
+
 #endif
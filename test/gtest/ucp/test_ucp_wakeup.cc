@@ -6,7 +6,12 @@
 
 #include "ucp_test.h"
 
+extern "C" {
+#include <ucp/core/ucp_worker.h>
+}
+
 #include <algorithm>
+#include <thread>
 #include <sys/epoll.h>
 #include <sys/poll.h>
 
@@ -178,6 +183,53 @@ UCS_TEST_P(test_ucp_wakeup, signal)
     EXPECT_EQ(UCS_OK, ucp_worker_arm(worker));
 }
 
+UCS_TEST_SKIP_COND_P(test_ucp_wakeup, spin_wait, is_self(),
+                     "WAIT_SPIN_TIME=1s")
+{
+    const ucp_datatype_t DATATYPE = ucp_dt_make_contig(1);
+    const uint64_t TAG            = 0xdeadbeef;
+    const int COUNT               = 10;
+    ucp_worker_h recv_worker      = receiver().worker();
+    uint64_t send_data, recv_data;
+    void *rreq;
+
+    sender().connect(&receiver(), get_ep_params());
+    flush_worker(sender());
+
+    for (int i = 0; i < COUNT; ++i) {
+        rreq = ucp_tag_recv_nb(recv_worker, &recv_data, sizeof(recv_data),
+                               DATATYPE, TAG, (ucp_tag_t)-1, recv_completion);
+
+        /* Send the message while the receiver waits for it */
+        send_data = i;
+        std::thread sender_thread([&]() {
+            usleep(1000);
+            void *sreq = ucp_tag_send_nb(sender().ep(), &send_data,
+                                         sizeof(send_data), DATATYPE, TAG,
+                                         send_completion);
+            if (UCS_PTR_IS_PTR(sreq)) {
+                while (!ucp_request_is_completed(sreq)) {
+                    ucp_worker_progress(sender().worker());
+                }
+                ucp_request_release(sreq);
+            }
+        });
+
+        while (!ucp_request_is_completed(rreq)) {
+            if (ucp_worker_progress(recv_worker) == 0) {
+                ASSERT_UCS_OK(ucp_worker_wait(recv_worker));
+            }
+        }
+        sender_thread.join();
+        ucp_request_release(rreq);
+        EXPECT_EQ(send_data, recv_data);
+    }
+
+    EXPECT_GT(recv_worker->counters.wait_spin_hits, 0u);
+    UCS_TEST_MESSAGE << "spin hits: " << recv_worker->counters.wait_spin_hits
+                     << " sleeps: " << recv_worker->counters.wait_sleeps;
+}
+
 UCP_INSTANTIATE_TEST_CASE(test_ucp_wakeup)
 
 class test_ucp_wakeup_external_epollfd : public test_ucp_wakeup {
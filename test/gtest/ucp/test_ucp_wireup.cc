@@ -16,6 +16,7 @@
 
 extern "C" {
 #include <ucp/wireup/address.h>
+#include <ucp/wireup/wireup_ep.h>
 #include <ucp/core/ucp_ep.inl>
 #include <ucs/sys/math.h>
 }
@@ -505,6 +506,198 @@ UCS_TEST_P(test_ucp_wireup_1sided, address) {
     ASSERT_TRUE(packed_sys_devices == unpacked_sys_devices);
 }
 
+UCS_TEST_P(test_ucp_wireup_1sided, compact_address) {
+    const unsigned flags = UCP_ADDRESS_PACK_FLAGS_ALL;
+    ucp_unpacked_address unpacked_full, unpacked_compact, unpacked_dict;
+    size_t full_size, dict_size, compact_size;
+    void *full_buffer, *dict_buffer, *compact_buffer;
+    ucs_status_t status;
+
+    if (address_version() != UCP_OBJECT_VERSION_V2) {
+        UCS_TEST_SKIP_R("address dictionaries require address v2");
+    }
+
+    status = ucp_address_pack(sender().worker(), NULL, &ucp_tl_bitmap_max,
+                              flags, UCP_OBJECT_VERSION_V2, NULL, UINT_MAX,
+                              &full_size, &full_buffer);
+    ASSERT_UCS_OK(status);
+
+    status = ucp_address_pack(sender().worker(), NULL, &ucp_tl_bitmap_max,
+                              flags | UCP_ADDRESS_PACK_FLAG_COMPACT,
+                              UCP_OBJECT_VERSION_V2, NULL, UINT_MAX,
+                              &compact_size, &compact_buffer);
+    ASSERT_UCS_OK(status);
+    EXPECT_LT(compact_size, full_size);
+
+    /* Receiver does not know the dictionary yet */
+    status = ucp_address_unpack(receiver().worker(), compact_buffer,
+                                flags | UCP_ADDRESS_PACK_FLAG_NO_TRACE,
+                                &unpacked_compact);
+    EXPECT_EQ(UCS_ERR_NO_ELEM, status);
+
+    status = ucp_address_pack(sender().worker(), NULL, &ucp_tl_bitmap_max,
+                              flags | UCP_ADDRESS_PACK_FLAG_DICT,
+                              UCP_OBJECT_VERSION_V2, NULL, UINT_MAX,
+                              &dict_size, &dict_buffer);
+    ASSERT_UCS_OK(status);
+    EXPECT_EQ(full_size + sizeof(uint64_t), dict_size);
+
+    status = ucp_address_unpack(receiver().worker(), full_buffer, flags,
+                                &unpacked_full);
+    ASSERT_UCS_OK(status);
+    status = ucp_address_unpack(receiver().worker(), dict_buffer, flags,
+                                &unpacked_dict);
+    ASSERT_UCS_OK(status);
+    status = ucp_address_unpack(receiver().worker(), compact_buffer, flags,
+                                &unpacked_compact);
+    ASSERT_UCS_OK(status);
+
+    EXPECT_EQ(sender().worker()->uuid, unpacked_compact.uuid);
+    EXPECT_EQ(unpacked_full.dst_version, unpacked_compact.dst_version);
+    ASSERT_EQ(unpacked_full.address_count, unpacked_dict.address_count);
+    ASSERT_EQ(unpacked_full.address_count, unpacked_compact.address_count);
+
+    for (unsigned i = 0; i < unpacked_full.address_count; ++i) {
+        const ucp_address_entry_t *full = &unpacked_full.address_list[i];
+        const ucp_address_entry_t *ae   = &unpacked_compact.address_list[i];
+
+        EXPECT_EQ(full->tl_name_csum, ae->tl_name_csum);
+        EXPECT_EQ(full->md_index, ae->md_index);
+        EXPECT_EQ(full->dev_index, ae->dev_index);
+        EXPECT_EQ(full->iface_attr.flags, ae->iface_attr.flags);
+        ASSERT_EQ(full->dev_addr_len, ae->dev_addr_len);
+        EXPECT_EQ(0, memcmp(full->dev_addr, ae->dev_addr, ae->dev_addr_len));
+        if (ae->dev_addr_len > 0) {
+            /* Device addresses are carried by the compact address */
+            EXPECT_GE((const void*)ae->dev_addr, compact_buffer);
+            EXPECT_LE(UCS_PTR_BYTE_OFFSET(ae->dev_addr, ae->dev_addr_len),
+                      UCS_PTR_BYTE_OFFSET(compact_buffer, compact_size));
+        }
+        ASSERT_EQ(full->iface_addr_len, ae->iface_addr_len);
+        EXPECT_EQ(0, memcmp(full->iface_addr, ae->iface_addr,
+                            ae->iface_addr_len));
+    }
+
+    /* A worker on another node, which has different device addresses, uses
+     * the same dictionary */
+    std::vector<uint8_t> other_compact((uint8_t*)compact_buffer,
+                                       (uint8_t*)compact_buffer +
+                                       compact_size);
+    const uct_device_addr_t *dev_addr = NULL;
+    const ucp_address_entry_t *ae;
+    ucp_unpacked_address_for_each(ae, &unpacked_compact) {
+        if ((ae->dev_addr_len > 0) && (ae->dev_addr != dev_addr)) {
+            dev_addr = ae->dev_addr;
+            other_compact[UCS_PTR_BYTE_DIFF(compact_buffer, dev_addr)] ^= 0xff;
+        }
+    }
+
+    ucp_unpacked_address unpacked_other;
+    status = ucp_address_unpack(receiver().worker(), other_compact.data(),
+                                flags, &unpacked_other);
+    ASSERT_UCS_OK(status);
+    ASSERT_EQ(unpacked_compact.address_count, unpacked_other.address_count);
+    for (unsigned i = 0; i < unpacked_compact.address_count; ++i) {
+        const ucp_address_entry_t *compact = &unpacked_compact.address_list[i];
+        const ucp_address_entry_t *other   = &unpacked_other.address_list[i];
+
+        ASSERT_EQ(compact->dev_addr_len, other->dev_addr_len);
+        if (other->dev_addr_len > 0) {
+            EXPECT_EQ(*(const uint8_t*)compact->dev_addr ^ 0xff,
+                      *(const uint8_t*)other->dev_addr);
+        }
+        EXPECT_EQ(0, memcmp(compact->iface_addr, other->iface_addr,
+                            other->iface_addr_len));
+    }
+
+    ucs_free(unpacked_other.address_list);
+    ucs_free(unpacked_compact.address_list);
+    ucs_free(unpacked_dict.address_list);
+    ucs_free(unpacked_full.address_list);
+    ucs_free(compact_buffer);
+    ucs_free(dict_buffer);
+    ucs_free(full_buffer);
+}
+
+UCS_TEST_P(test_ucp_wireup_1sided, compact_address_ambiguous) {
+    const unsigned flags = UCP_ADDRESS_PACK_FLAGS_ALL;
+    /* XOR-ing a message with the CRC32 polynomial does not change its CRC32 */
+    const uint8_t crc32_poly[] = {0x41, 0x06, 0x71, 0xdb, 0x01};
+    ucp_unpacked_address unpacked;
+    size_t dict_size, compact_size;
+    void *dict_buffer, *compact_buffer;
+    ucs_status_t status;
+
+    if (address_version() != UCP_OBJECT_VERSION_V2) {
+        UCS_TEST_SKIP_R("address dictionaries require address v2");
+    }
+
+    if (get_variant_value() & UNIFIED_MODE) {
+        /* Modified transport attributes refer to an invalid resource */
+        UCS_TEST_SKIP_R("unified mode");
+    }
+
+    status = ucp_address_pack(sender().worker(), NULL, &ucp_tl_bitmap_max,
+                              flags | UCP_ADDRESS_PACK_FLAG_DICT,
+                              UCP_OBJECT_VERSION_V2, NULL, UINT_MAX,
+                              &dict_size, &dict_buffer);
+    ASSERT_UCS_OK(status);
+
+    status = ucp_address_pack(sender().worker(), NULL, &ucp_tl_bitmap_max,
+                              flags | UCP_ADDRESS_PACK_FLAG_COMPACT,
+                              UCP_OBJECT_VERSION_V2, NULL, UINT_MAX,
+                              &compact_size, &compact_buffer);
+    ASSERT_UCS_OK(status);
+
+    status = ucp_address_unpack(receiver().worker(), dict_buffer, flags,
+                                &unpacked);
+    ASSERT_UCS_OK(status);
+
+    /* Make a different dictionary address with the same id, by changing the
+     * transport name checksum and attributes which follow a device address */
+    std::vector<uint8_t> other_dict((uint8_t*)dict_buffer,
+                                    (uint8_t*)dict_buffer + dict_size);
+    const ucp_address_entry_t *ae;
+    ucp_unpacked_address_for_each(ae, &unpacked) {
+        if (ae->dev_addr_len > 0) {
+            break;
+        }
+    }
+
+    if (ae == (unpacked.address_list + unpacked.address_count)) {
+        ucs_free(unpacked.address_list);
+        ucs_free(compact_buffer);
+        ucs_free(dict_buffer);
+        UCS_TEST_SKIP_R("no device address");
+    }
+
+    size_t offset = UCS_PTR_BYTE_DIFF(dict_buffer, ae->dev_addr) +
+                    ae->dev_addr_len;
+    for (size_t i = 0; i < sizeof(crc32_poly); ++i) {
+        other_dict[offset + i] ^= crc32_poly[i];
+    }
+    ucs_free(unpacked.address_list);
+
+    /* Compact addresses are accepted as long as the id is not ambiguous */
+    status = ucp_address_unpack(receiver().worker(), compact_buffer, flags,
+                                &unpacked);
+    ASSERT_UCS_OK(status);
+    ucs_free(unpacked.address_list);
+
+    status = ucp_address_unpack(receiver().worker(), other_dict.data(), flags,
+                                &unpacked);
+    ASSERT_UCS_OK(status);
+    ucs_free(unpacked.address_list);
+
+    status = ucp_address_unpack(receiver().worker(), compact_buffer,
+                                flags | UCP_ADDRESS_PACK_FLAG_NO_TRACE,
+                                &unpacked);
+    EXPECT_EQ(UCS_ERR_NO_ELEM, status);
+
+    ucs_free(compact_buffer);
+    ucs_free(dict_buffer);
+}
+
 UCS_TEST_P(test_ucp_wireup_1sided, ep_address, "IB_NUM_PATHS?=2") {
     ucs_status_t status;
     size_t size;
@@ -570,6 +763,62 @@ UCS_TEST_P(test_ucp_wireup_1sided, one_sided_wireup) {
     flush_worker(sender());
 }
 
+UCS_TEST_P(test_ucp_wireup_1sided, on_demand_lanes, "ON_DEMAND_LANES=y",
+           "RNDV_THRESH=1") {
+    sender().connect(&receiver(), get_ep_params());
+
+    ucp_ep_h ep                    = sender().ep();
+    const ucp_ep_config_key_t *key = &ucp_ep_config(ep)->key;
+    std::vector<ucp_lane_index_t> on_demand_lanes;
+    for (ucp_lane_index_t lane = 0; lane < key->num_lanes; ++lane) {
+        ucp_wireup_ep_t *wireup_ep = ucp_wireup_ep(ucp_ep_get_lane(ep, lane));
+        if ((wireup_ep == NULL) ||
+            !(wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND)) {
+            continue;
+        }
+
+        EXPECT_NE(key->am_lane, lane);
+        EXPECT_NE(key->wireup_msg_lane, lane);
+        EXPECT_NE(key->keepalive_lane, lane);
+
+        /* Not connected before it is used */
+        EXPECT_EQ(NULL, wireup_ep->super.uct_ep) << "lane " << (int)lane;
+        EXPECT_TRUE(ucs_queue_is_empty(&wireup_ep->pending_q))
+                << "lane " << (int)lane;
+        on_demand_lanes.push_back(lane);
+    }
+
+    if (on_demand_lanes.empty()) {
+        UCS_TEST_SKIP_R("no lanes are connected on demand");
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        send_recv(sender().ep(), receiver().worker(), receiver().ep(),
+                  BUFFER_LENGTH, 1);
+    }
+
+    flush_worker(sender());
+
+    /* The lanes which were used are connected, and the rest are still not */
+    unsigned num_connected = 0;
+    for (size_t i = 0; i < on_demand_lanes.size(); ++i) {
+        uct_ep_h uct_ep            = ucp_ep_get_lane(ep, on_demand_lanes[i]);
+        ucp_wireup_ep_t *wireup_ep = ucp_wireup_ep(uct_ep);
+        if (wireup_ep == NULL) {
+            ++num_connected;
+        } else {
+            EXPECT_TRUE(wireup_ep->flags & UCP_WIREUP_EP_FLAG_ON_DEMAND);
+            EXPECT_EQ(NULL, wireup_ep->super.uct_ep);
+        }
+    }
+
+    /* Tag rendezvous fetches the data using the receiver endpoint, so only
+     * RMA is sure to use the sender lanes */
+    if (get_variant_value() & TEST_RMA) {
+        EXPECT_GT(num_connected, 0u);
+    }
+}
+
 UCS_TEST_P(test_ucp_wireup_1sided, one_sided_wireup_rndv, "RNDV_THRESH=1") {
     sender().connect(&receiver(), get_ep_params());
     send_recv(sender().ep(), receiver().worker(), receiver().ep(), BUFFER_LENGTH, 1);
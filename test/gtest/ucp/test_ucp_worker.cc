@@ -11,6 +11,7 @@
 extern "C" {
 #include <ucp/core/ucp_worker.h>
 #include <ucp/core/ucp_worker.inl>
+#include <ucp/core/ucp_worker_group.h>
 #include <ucp/core/ucp_request.h>
 #include <ucp/wireup/wireup_ep.h>
 #include <uct/base/uct_iface.h>
@@ -802,6 +803,134 @@ UCS_TEST_P(test_ucp_worker_address_query, query)
 
 UCP_INSTANTIATE_TEST_CASE(test_ucp_worker_address_query)
 
+class test_ucp_worker_group : public ucp_test {
+public:
+    static void get_test_variants(std::vector<ucp_test_variant> &variants)
+    {
+        add_variant(variants, UCP_FEATURE_TAG);
+        /* Progress threads wait for events instead of polling */
+        add_variant_with_value(variants, UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP,
+                               0, "wakeup");
+    }
+
+protected:
+    static const ucp_tag_t TAG = 0x1337;
+
+    ucp_worker_group_h create_group(entity &e, unsigned num_workers,
+                                    uint64_t flags = 0)
+    {
+        ucp_worker_group_params_t params;
+        ucp_worker_group_h group;
+
+        params.field_mask  = UCP_WORKER_GROUP_PARAM_FIELD_NUM_WORKERS |
+                             UCP_WORKER_GROUP_PARAM_FIELD_FLAGS;
+        params.num_workers = num_workers;
+        params.flags       = flags;
+        ASSERT_UCS_OK(ucp_worker_group_create(e.ucph(), &params, &group));
+        EXPECT_EQ(num_workers, ucp_worker_group_get_num_workers(group));
+        return group;
+    }
+
+    ucp_ep_h connect(ucp_worker_group_h group, ucp_worker_group_h remote)
+    {
+        ucp_ep_params_t ep_params;
+        ucp_address_t *address;
+        size_t address_length;
+        ucp_ep_h ep;
+
+        ASSERT_UCS_OK(ucp_worker_group_get_address(remote, &address,
+                                                   &address_length));
+        EXPECT_GT(address_length, 0);
+
+        ep_params.field_mask = UCP_EP_PARAM_FIELD_REMOTE_ADDRESS;
+        ep_params.address    = address;
+        ASSERT_UCS_OK(ucp_worker_group_ep_create(group, &ep_params, &ep));
+        ucp_worker_group_release_address(remote, address);
+        return ep;
+    }
+
+    void wait(void *req, ucp_worker_group_h group1, ucp_worker_group_h group2)
+    {
+        ucs_status_t status;
+
+        if (req == NULL) {
+            return;
+        }
+
+        ASSERT_FALSE(UCS_PTR_IS_ERR(req));
+        ucs_time_t deadline = ucs::get_deadline();
+        do {
+            if (!(group1->flags & UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD)) {
+                ucp_worker_group_progress(group1);
+                ucp_worker_group_progress(group2);
+            }
+            status = ucp_request_check_status(req);
+        } while ((status == UCS_INPROGRESS) &&
+                 (ucs_get_time() < deadline));
+
+        EXPECT_UCS_OK(status);
+        ucp_request_free(req);
+    }
+
+    void close(ucp_ep_h ep, ucp_worker_group_h group1,
+               ucp_worker_group_h group2)
+    {
+        ucp_request_param_t param = {};
+
+        wait(ucp_ep_close_nbx(ep, &param), group1, group2);
+    }
+
+    void test_send_recv(uint64_t flags)
+    {
+        ucp_worker_group_h group1 = create_group(sender(), 3, flags);
+        ucp_worker_group_h group2 = create_group(receiver(), 2, flags);
+        ucp_request_param_t param = {};
+        uint64_t send_data        = 0xdeadbeef;
+        uint64_t recv_data        = 0;
+
+        ucp_ep_h ep1 = connect(group1, group2);
+        ucp_ep_h ep2 = connect(group2, group1);
+
+        /* Both groups select the same pair of members for each other */
+        EXPECT_EQ(ucp_worker_group_get_worker(group1, group2->uuid % 3),
+                  ep1->worker);
+        EXPECT_EQ(ucp_worker_group_get_worker(group2, group1->uuid % 2),
+                  ep2->worker);
+
+        void *rreq = ucp_tag_recv_nbx(ep2->worker, &recv_data,
+                                      sizeof(recv_data), TAG, UCP_TAG_MASK_FULL,
+                                      &param);
+        void *sreq = ucp_tag_send_nbx(ep1, &send_data, sizeof(send_data), TAG,
+                                      &param);
+        wait(sreq, group1, group2);
+        wait(rreq, group1, group2);
+        EXPECT_EQ(send_data, recv_data);
+
+        close(ep1, group1, group2);
+        close(ep2, group1, group2);
+        ucp_worker_group_destroy(group1);
+        ucp_worker_group_destroy(group2);
+    }
+};
+
+/* self transport can't connect different workers */
+UCS_TEST_SKIP_COND_P(test_ucp_worker_group, send_recv, is_self())
+{
+    test_send_recv(0);
+}
+
+UCS_TEST_SKIP_COND_P(test_ucp_worker_group, send_recv_progress_thread,
+                     is_self())
+{
+#if ENABLE_MT
+    test_send_recv(UCP_WORKER_GROUP_FLAG_PROGRESS_THREAD);
+#else
+    UCS_TEST_SKIP_R("multi-thread support is disabled");
+#endif
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_worker_group)
+
 class test_ucp_modify_uct_cfg : public test_ucp_context {
 public:
     test_ucp_modify_uct_cfg() : m_seg_size((ucs::rand() & 0x3ff) + 1024) {
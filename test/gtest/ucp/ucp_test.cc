@@ -1033,7 +1033,7 @@ unsigned ucp_test_base::entity::progress(int worker_index)
 
     unsigned progress_count = 0;
     if (!m_conn_reqs.empty()) {
-        ucp_conn_request_h conn_req = m_conn_reqs.back();
+        ucp_conn_request_h conn_req = m_conn_reqs.front();
         m_conn_reqs.pop();
         accept(worker_index, conn_req);
         ++progress_count;
@@ -107,3 +107,33 @@ UCS_TEST_F(test_lru, pop_oldest) {
     expected.insert(expected.end(), elements2.begin(), elements2.end());
     run(elements2, expected);
 }
+
+UCS_TEST_F(test_lru, remove) {
+    std::vector<uint64_t> elements;
+    init_vector(elements, m_capacity, 1);
+    run(elements, elements);
+
+    EXPECT_EQ(elements.front(), (uint64_t)ucs_lru_tail(m_lru));
+
+    ucs_lru_remove(m_lru, (void*)elements.front());
+    ucs_lru_remove(m_lru, (void*)elements.back());
+    /* Removing a missing element is a no-op */
+    ucs_lru_remove(m_lru, (void*)elements.back());
+    EXPECT_FALSE(ucs_lru_is_present(m_lru, (void*)elements.front()));
+    EXPECT_FALSE(ucs_lru_is_present(m_lru, (void*)elements.back()));
+
+    std::vector<uint64_t> expected(elements.begin() + 1, elements.end() - 1);
+    EXPECT_EQ(expected.front(), (uint64_t)ucs_lru_tail(m_lru));
+
+    void **item;
+    size_t elem_index = 0;
+    std::reverse(expected.begin(), expected.end());
+    ucs_lru_for_each(item, m_lru) {
+        EXPECT_EQ(expected[elem_index], (uint64_t)*item);
+        elem_index++;
+    }
+    EXPECT_EQ(expected.size(), elem_index);
+
+    ucs_lru_reset(m_lru);
+    EXPECT_EQ(NULL, ucs_lru_tail(m_lru));
+}
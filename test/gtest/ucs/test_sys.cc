@@ -126,6 +126,34 @@ UCS_TEST_F(test_sys, fcntl) {
     close(fd);
 }
 
+UCS_TEST_F(test_sys, dup_remote_fd) {
+    int fds[2], dup_fd;
+    char c = 'x';
+
+    ASSERT_EQ(0, pipe(fds));
+
+    ucs_status_t status = ucs_sys_dup_remote_fd(getpid(), fds[1], &dup_fd);
+    if ((status == UCS_ERR_UNSUPPORTED) || (status == UCS_ERR_REJECTED)) {
+        close(fds[0]);
+        close(fds[1]);
+        UCS_TEST_SKIP_R(ucs_status_string(status));
+    }
+
+    ASSERT_UCS_OK(status);
+    EXPECT_NE(fds[1], dup_fd);
+    EXPECT_TRUE(fcntl(dup_fd, F_GETFD) & FD_CLOEXEC);
+
+    /* Writing to the duplicate is visible on the original pipe */
+    EXPECT_EQ(1, write(dup_fd, &c, 1));
+    c = 0;
+    EXPECT_EQ(1, read(fds[0], &c, 1));
+    EXPECT_EQ('x', c);
+
+    close(dup_fd);
+    close(fds[0]);
+    close(fds[1]);
+}
+
 UCS_TEST_F(test_sys, memory) {
     size_t phys_size = ucs_get_phys_mem_size();
     UCS_TEST_MESSAGE << "Physical memory size: " << ucs::size_value(phys_size);
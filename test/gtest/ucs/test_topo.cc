@@ -151,3 +151,32 @@ UCS_TEST_F(test_topo, numa_distance) {
         }
     }
 }
+
+UCS_TEST_F(test_topo, numa_mem_bind) {
+    const size_t length   = 4 * ucs_get_page_size();
+    ucs_numa_node_t local = ucs_numa_node_of_current_cpu();
+    ucs_numa_node_t node;
+
+    if (local == UCS_NUMA_NODE_UNDEFINED) {
+        UCS_TEST_SKIP_R("cannot detect the NUMA node of the current CPU");
+    }
+
+    void *ptr = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr);
+
+    for (int policy = 0; policy < UCS_NUMA_POLICY_LAST; ++policy) {
+        UCS_TEST_MESSAGE << "policy " << ucs_numa_policy_names[policy];
+        ASSERT_UCS_OK(ucs_numa_mem_bind(ptr, length,
+                                        (ucs_numa_policy_t)policy, local));
+        memset(ptr, policy, length);
+
+        node = ucs_numa_node_of_address(ptr);
+        if ((policy != UCS_NUMA_POLICY_DEFAULT) &&
+            (node != UCS_NUMA_NODE_UNDEFINED)) {
+            EXPECT_EQ(local, node);
+        }
+    }
+
+    munmap(ptr, length);
+}
@@ -7,6 +7,8 @@
 
 extern "C" {
 #include <ucs/time/time.h>
+#include <uct/sm/mm/base/mm_ep.h>
+#include <uct/sm/mm/base/mm_iface.h>
 }
 #include <common/test.h>
 #include "uct_test.h"
@@ -203,6 +205,58 @@ UCS_TEST_SKIP_COND_P(test_uct_event, am_with_fc,
     test_recv_am(UCT_EVENT_RECV, 0);
 }
 
+UCS_TEST_SKIP_COND_P(test_uct_event, am_socket_signal,
+                     !check_caps(UCT_IFACE_FLAG_CB_SYNC |
+                                 UCT_IFACE_FLAG_AM_BCOPY) ||
+                     !check_event_caps(UCT_IFACE_FLAG_EVENT_RECV) ||
+                     !has_mm(),
+                     "SIGNAL_EVENTFD?=n")
+{
+    test_recv_am(UCT_EVENT_RECV, 0);
+}
+
+UCS_TEST_SKIP_COND_P(test_uct_event, am_eventfd_signal,
+                     !check_caps(UCT_IFACE_FLAG_CB_SYNC |
+                                 UCT_IFACE_FLAG_AM_BCOPY) ||
+                     !check_event_caps(UCT_IFACE_FLAG_EVENT_RECV) ||
+                     !has_mm(),
+                     "SIGNAL_EVENTFD?=y")
+{
+    uct_mm_iface_t *iface = ucs_derived_of(m_e2->iface(), uct_mm_iface_t);
+    uct_mm_ep_t *ep       = ucs_derived_of(m_e1->ep(0), uct_mm_ep_t);
+    recv_desc_t *recv_buffer;
+    uint64_t value;
+    char dummy;
+
+    if (ep->signal_eventfd < 0) {
+        UCS_TEST_SKIP_R("receiver eventfd could not be duplicated");
+    }
+
+    recv_buffer = (recv_desc_t*)malloc(sizeof(*recv_buffer) +
+                                       sizeof(m_send_data));
+    recv_buffer->length = 0;
+    uct_iface_set_am_handler(m_e2->iface(), 0, am_handler, recv_buffer, 0);
+
+    for (unsigned i = 0; i < 100; ++i) {
+        arm(m_e2, UCT_EVENT_RECV);
+        send_am_data(0, false);
+        EXPECT_TRUE(m_async_event_ctx.wait_for_event(*m_e2, 60));
+
+        /* The wakeup signal was written to the eventfd, not to the socket */
+        EXPECT_EQ((ssize_t)sizeof(value),
+                  read(iface->signal_eventfd, &value, sizeof(value)));
+        EXPECT_EQ(-1, recv(iface->signal_fd, &dummy, sizeof(dummy),
+                           MSG_PEEK | MSG_DONTWAIT));
+
+        while (m_am_recv_count < m_am_send_count) {
+            progress();
+        }
+    }
+
+    m_e1->flush();
+    free(recv_buffer);
+}
+
 UCS_TEST_SKIP_COND_P(test_uct_event, sig_am,
                      !check_caps(UCT_IFACE_FLAG_CB_SYNC |
                                  UCT_IFACE_FLAG_AM_BCOPY) ||
@@ -13,17 +13,21 @@ extern "C" {
 #include <common/test.h>
 #include "uct_test.h"
 
+#include <fstream>
+
 
 class test_uct_mm : public uct_test {
 public:
 
     struct mm_resource : public resource {
         std::string  shm_dir;
+        bool         memfd;
 
-        mm_resource(const resource& res, const std::string& shm_dir = "") :
+        mm_resource(const resource& res, const std::string& shm_dir = "",
+                    bool memfd = false) :
             resource(res.component, res.component_name, res.md_name,
                      res.local_cpus, res.tl_name, res.dev_name, res.dev_type),
-            shm_dir(shm_dir)
+            shm_dir(shm_dir), memfd(memfd)
         {
         }
 
@@ -32,6 +36,9 @@ public:
             if (!shm_dir.empty()) {
                 name += ",dir=" + shm_dir;
             }
+            if (memfd) {
+                name += ",memfd";
+            }
             return name;
         }
     };
@@ -74,10 +81,31 @@ public:
                                     std::vector<mm_resource> &variants) {
         variants.push_back(mm_resource(res, "."       ));
         variants.push_back(mm_resource(res, "/dev/shm"));
+        variants.push_back(mm_resource(res, "", true));
     }
 
     void set_posix_config() {
-        set_config("POSIX_DIR=" + GetParam()->shm_dir);
+        if (GetParam()->memfd) {
+            set_config("POSIX_MEMFD=y");
+        } else {
+            set_config("POSIX_DIR=" + GetParam()->shm_dir);
+            set_config("POSIX_MEMFD=n");
+        }
+    }
+
+    static size_t free_huge_pages_size() {
+        std::ifstream meminfo("/proc/meminfo");
+        ssize_t huge_page_size = ucs_get_huge_page_size();
+        std::string line;
+        unsigned count;
+
+        while ((huge_page_size > 0) && std::getline(meminfo, line)) {
+            if (sscanf(line.c_str(), "HugePages_Free: %u", &count) == 1) {
+                return count * huge_page_size;
+            }
+        }
+
+        return 0;
     }
 
     virtual void init() {
@@ -187,6 +215,28 @@ public:
         test_rkey(ptr, memh, size);
     }
 
+    void test_alloc(size_t size, uct_allocated_memory_t *mem) {
+        uct_md_h md_ref           = m_e1->md();
+        uct_alloc_method_t method = UCT_ALLOC_METHOD_MD;
+        ucs_status_t status;
+        uct_mem_alloc_params_t params;
+
+        params.field_mask      = UCT_MEM_ALLOC_PARAM_FIELD_FLAGS      |
+                                 UCT_MEM_ALLOC_PARAM_FIELD_ADDRESS    |
+                                 UCT_MEM_ALLOC_PARAM_FIELD_MEM_TYPE   |
+                                 UCT_MEM_ALLOC_PARAM_FIELD_MDS        |
+                                 UCT_MEM_ALLOC_PARAM_FIELD_NAME;
+        params.flags           = UCT_MD_MEM_ACCESS_ALL;
+        params.name            = "test_mm";
+        params.mem_type        = UCS_MEMORY_TYPE_HOST;
+        params.address         = NULL;
+        params.mds.mds         = &md_ref;
+        params.mds.count       = 1;
+
+        status = uct_mem_alloc(size, &method, 1, &params, mem);
+        ASSERT_UCS_OK(status);
+    }
+
 protected:
     entity *m_e1, *m_e2;
 };
@@ -221,29 +271,32 @@ UCS_TEST_SKIP_COND_P(test_uct_mm, open_for_posix,
 UCS_TEST_SKIP_COND_P(test_uct_mm, alloc,
                      !check_md_caps(UCT_MD_FLAG_ALLOC)) {
 
-    size_t size               = ucs_min(100000u, m_e1->md_attr().max_alloc);
-    void *address             = NULL;
-    uct_md_h md_ref           = m_e1->md();
-    uct_alloc_method_t method = UCT_ALLOC_METHOD_MD;
+    size_t size = ucs_min(100000u, m_e1->md_attr().max_alloc);
     ucs_status_t status;
-    uct_mem_alloc_params_t params;
     uct_allocated_memory_t mem;
 
-    params.field_mask      = UCT_MEM_ALLOC_PARAM_FIELD_FLAGS      |
-                             UCT_MEM_ALLOC_PARAM_FIELD_ADDRESS    |
-                             UCT_MEM_ALLOC_PARAM_FIELD_MEM_TYPE   |
-                             UCT_MEM_ALLOC_PARAM_FIELD_MDS        |
-                             UCT_MEM_ALLOC_PARAM_FIELD_NAME;
-    params.flags           = UCT_MD_MEM_ACCESS_ALL;
-    params.name            = "test_mm";
-    params.mem_type        = UCS_MEMORY_TYPE_HOST;
-    params.address         = address;
-    params.mds.mds         = &md_ref;
-    params.mds.count       = 1;
-
-    status = uct_mem_alloc(size, &method, 1, &params, &mem);
+    test_alloc(size, &mem);
+    test_memh(mem.address, mem.memh, mem.length);
+
+    status = uct_mem_free(&mem);
     ASSERT_UCS_OK(status);
+}
 
+UCS_TEST_SKIP_COND_P(test_uct_mm, alloc_memfd_hugetlb,
+                     !check_md_caps(UCT_MD_FLAG_ALLOC) || !GetParam()->memfd)
+{
+    /* Not a multiple of huge page size, but large enough to use huge pages
+     * with the default HUGETLB_MODE=try */
+    size_t size = 3 * UCS_MBYTE + 1;
+    ucs_status_t status;
+    uct_allocated_memory_t mem;
+
+    if (free_huge_pages_size() < (2 * size)) {
+        UCS_TEST_SKIP_R("not enough free huge pages");
+    }
+
+    test_alloc(size, &mem);
+    EXPECT_EQ(0u, mem.length % ucs_get_huge_page_size());
     test_memh(mem.address, mem.memh, mem.length);
 
     status = uct_mem_free(&mem);
@@ -269,6 +322,52 @@ UCS_TEST_SKIP_COND_P(test_uct_mm, reg,
     ASSERT_UCS_OK(status);
 }
 
+UCS_TEST_SKIP_COND_P(test_uct_mm, reg_rkey_legacy,
+                     !has_transport("xpmem"))
+{
+    /* Peers of older versions unpack segment id, address and length */
+    EXPECT_EQ(3 * sizeof(uint64_t), m_e1->md_attr().rkey_packed_size);
+}
+
+UCS_TEST_SKIP_COND_P(test_uct_mm, reg_attach_vma, !has_transport("xpmem"),
+                     "XPMEM_ATTACH_VMA~=y", "XPMEM_PREFAULT_MAX~=64k")
+{
+    static const size_t size = 100000;
+    std::vector<uint8_t> buffer(3 * size);
+    std::vector<uint8_t> rkey_buffer(m_e1->md_attr().rkey_packed_size);
+    uct_rkey_bundle_t rkey_ob[2];
+    uct_mem_h memh[2];
+    ucs_status_t status;
+
+    /* The extended remote key follows the legacy one */
+    EXPECT_EQ(6 * sizeof(uint64_t), m_e1->md_attr().rkey_packed_size);
+
+    for (int i = 0; i < 2; ++i) {
+        status = uct_md_mem_reg(m_e1->md(), &buffer[(i * 2) * size], size,
+                                UCT_MD_MEM_ACCESS_ALL, &memh[i]);
+        ASSERT_UCS_OK(status);
+
+        test_memh(&buffer[(i * 2) * size], memh[i], size);
+
+        status = uct_md_mkey_pack(m_e1->md(), memh[i], &rkey_buffer[0]);
+        ASSERT_UCS_OK(status);
+
+        status = uct_rkey_unpack(GetParam()->component, &rkey_buffer[0],
+                                 &rkey_ob[i]);
+        ASSERT_UCS_OK(status);
+    }
+
+    /* Both buffers are in the same memory area, so the second remote key is
+     * served by the attachment of the first one */
+    EXPECT_EQ(rkey_ob[0].handle, rkey_ob[1].handle);
+
+    for (int i = 0; i < 2; ++i) {
+        uct_rkey_release(GetParam()->component, &rkey_ob[i]);
+        status = uct_md_mem_dereg(m_e1->md(), memh[i]);
+        ASSERT_UCS_OK(status);
+    }
+}
+
 _UCT_INSTANTIATE_TEST_CASE(test_uct_mm, posix)
 _UCT_INSTANTIATE_TEST_CASE(test_uct_mm, sysv)
 _UCT_INSTANTIATE_TEST_CASE(test_uct_mm, xpmem)
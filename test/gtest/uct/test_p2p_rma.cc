@@ -164,3 +164,157 @@ UCS_TEST_SKIP_COND_P(test_p2p_rma_madvise, madvise,
 }
 
 UCT_INSTANTIATE_TEST_CASE(test_p2p_rma_madvise)
+
+class test_p2p_rma_copy_threads : public uct_p2p_rma_test {
+public:
+    virtual void init()
+    {
+        /* Several segments per operation to copy them in parallel */
+        modify_config("SCOPY_COPY_THREADS", "3");
+        modify_config("SCOPY_SEG_SIZE", "8k");
+        uct_p2p_rma_test::init();
+    }
+
+protected:
+    void test_lengths(send_func_t send, unsigned flags)
+    {
+        /* Less than one segment, unaligned and many segments */
+        static const size_t lengths[] = {1000, 8193, 100000, UCS_MBYTE};
+
+        for (size_t i = 0; i < ucs_static_array_size(lengths); ++i) {
+            test_xfer(send, lengths[i], flags, UCS_MEMORY_TYPE_HOST);
+        }
+    }
+};
+
+UCS_TEST_SKIP_COND_P(test_p2p_rma_copy_threads, put_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY))
+{
+    test_lengths(static_cast<send_func_t>(&uct_p2p_rma_test::put_zcopy),
+                 TEST_UCT_FLAG_SEND_ZCOPY);
+}
+
+UCS_TEST_SKIP_COND_P(test_p2p_rma_copy_threads, get_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_GET_ZCOPY))
+{
+    test_lengths(static_cast<send_func_t>(&uct_p2p_rma_test::get_zcopy),
+                 TEST_UCT_FLAG_RECV_ZCOPY);
+}
+
+UCS_TEST_SKIP_COND_P(test_p2p_rma_copy_threads, destroy_ep_inflight,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY))
+{
+    static const size_t num_ops = 8;
+    mapped_buffer sendbuf(UCS_MBYTE, SEED1, sender());
+    mapped_buffer recvbuf(UCS_MBYTE, SEED2, receiver());
+    uct_completion_t comp;
+    uct_iov_t iov;
+
+    comp.func   = (uct_completion_callback_t)ucs_empty_function;
+    comp.count  = num_ops;
+    comp.status = UCS_OK;
+
+    iov.buffer = sendbuf.ptr();
+    iov.length = sendbuf.length();
+    iov.memh   = sendbuf.memh();
+    iov.stride = 0;
+    iov.count  = 1;
+
+    for (size_t i = 0; i < num_ops; ++i) {
+        ucs_status_t status = uct_ep_put_zcopy(sender_ep(), &iov, 1,
+                                               recvbuf.addr(), recvbuf.rkey(),
+                                               &comp);
+        ASSERT_EQ(UCS_INPROGRESS, status);
+    }
+
+    /* Offload the first operations to the helper threads */
+    progress();
+
+    /* Chunks still queued for the helper threads are canceled, and every
+     * operation is completed before the endpoint is released */
+    sender().destroy_ep(0);
+    EXPECT_EQ(0, comp.count);
+    if (comp.status != UCS_OK) {
+        EXPECT_EQ(UCS_ERR_CANCELED, comp.status);
+    }
+}
+
+_UCT_INSTANTIATE_TEST_CASE(test_p2p_rma_copy_threads, cma)
+_UCT_INSTANTIATE_TEST_CASE(test_p2p_rma_copy_threads, knem)
+
+class test_p2p_rma_tx_batch : public uct_p2p_rma_test {
+public:
+    virtual void init()
+    {
+        modify_config("SCOPY_TX_BATCH", "16");
+        uct_p2p_rma_test::init();
+    }
+
+protected:
+    typedef ucs_status_t (*zcopy_func_t)(uct_ep_h ep, const uct_iov_t *iov,
+                                         size_t iovcnt, uint64_t remote_addr,
+                                         uct_rkey_t rkey,
+                                         uct_completion_t *comp);
+
+    void test_batch(zcopy_func_t zcopy, bool put)
+    {
+        static const size_t num_ops  = 100;
+        static const size_t length   = 100;
+        static const size_t tx_batch = 16; /* SCOPY_TX_BATCH */
+        mapped_buffer sendbuf(num_ops * length, SEED1, sender());
+        mapped_buffer recvbuf(num_ops * length, SEED2, receiver());
+        uct_completion_t comp;
+        uct_iov_t iov[2];
+        unsigned num_progress;
+
+        comp.func   = (uct_completion_callback_t)ucs_empty_function;
+        comp.count  = num_ops;
+        comp.status = UCS_OK;
+
+        for (size_t i = 0; i < num_ops; ++i) {
+            /* Two IOVs per operation to check their order in the batch */
+            for (size_t j = 0; j < 2; ++j) {
+                iov[j].buffer = UCS_PTR_BYTE_OFFSET(sendbuf.ptr(),
+                                                    (i * length) +
+                                                    (j * length / 2));
+                iov[j].length = length / 2;
+                iov[j].memh   = sendbuf.memh();
+                iov[j].stride = 0;
+                iov[j].count  = 1;
+            }
+
+            ucs_status_t status = zcopy(sender_ep(), iov, 2,
+                                        recvbuf.addr() + (i * length),
+                                        recvbuf.rkey(), &comp);
+            ASSERT_EQ(UCS_INPROGRESS, status);
+        }
+
+        for (num_progress = 0; comp.count > 0; ++num_progress) {
+            progress();
+        }
+
+        EXPECT_UCS_OK(comp.status);
+        /* Each progress call transfers a whole batch */
+        EXPECT_LE(num_progress, ucs_div_round_up(num_ops, tx_batch));
+
+        if (put) {
+            recvbuf.pattern_check(SEED1);
+        } else {
+            sendbuf.pattern_check(SEED2);
+        }
+    }
+};
+
+UCS_TEST_SKIP_COND_P(test_p2p_rma_tx_batch, put_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY))
+{
+    test_batch(uct_ep_put_zcopy, true);
+}
+
+UCS_TEST_SKIP_COND_P(test_p2p_rma_tx_batch, get_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_GET_ZCOPY))
+{
+    test_batch(uct_ep_get_zcopy, false);
+}
+
+_UCT_INSTANTIATE_TEST_CASE(test_p2p_rma_tx_batch, cma)
@@ -94,3 +94,70 @@ UCS_TEST_P(test_uct_progress, oneshot_progress_remove)
 }
 
 UCT_INSTANTIATE_TEST_CASE(test_uct_progress);
+
+
+class test_uct_progress_backoff : public uct_test {
+public:
+    virtual void init()
+    {
+        modify_config("PROGRESS_IDLE_BACKOFF", "8");
+        uct_test::init();
+
+        m_sender = create_entity(0);
+        m_entities.push_back(m_sender);
+        m_receiver = create_entity(0);
+        m_entities.push_back(m_receiver);
+
+        check_skip_test();
+        check_caps_skip(UCT_IFACE_FLAG_AM_SHORT | UCT_IFACE_FLAG_CB_SYNC);
+
+        m_sender->connect(0, *m_receiver, 0);
+        flush();
+
+        /* Loopback transports deliver to the sender interface */
+        for (auto e : m_entities) {
+            uct_iface_set_am_handler(e->iface(), 0, am_handler, &m_am_count,
+                                     0);
+        }
+    }
+
+protected:
+    static ucs_status_t
+    am_handler(void *arg, void *data, size_t length, unsigned flags)
+    {
+        ++(*reinterpret_cast<unsigned*>(arg));
+        return UCS_OK;
+    }
+
+    entity   *m_sender;
+    entity   *m_receiver;
+    unsigned m_am_count{0};
+};
+
+
+UCS_TEST_P(test_uct_progress_backoff, idle_iface)
+{
+    for (int iter = 0; iter < 10; ++iter) {
+        /* Make the receiver idle, so it polls with the longest interval */
+        for (int i = 0; i < 1000; ++i) {
+            m_receiver->progress();
+        }
+
+        ucs_status_t status;
+        do {
+            status = uct_ep_am_short(m_sender->ep(0), 0, 0, NULL, 0);
+            m_sender->progress();
+        } while (status == UCS_ERR_NO_RESOURCE);
+        ASSERT_UCS_OK(status);
+
+        /* The message must be received once the idle interface is polled */
+        ucs_time_t deadline = ucs_get_time() + ucs_time_from_sec(10.0);
+        while ((m_am_count <= iter) && (ucs_get_time() < deadline)) {
+            m_receiver->progress();
+            m_sender->progress();
+        }
+        ASSERT_EQ(iter + 1, m_am_count);
+    }
+}
+
+UCT_INSTANTIATE_TEST_CASE(test_uct_progress_backoff);
@@ -7,7 +7,10 @@
 #include <common/test.h>
 #include <gtest/uct/uct_p2p_test.h>
 
+#include <fstream>
+
 extern "C" {
+#include <ucs/sys/string.h>
 #include <ucs/sys/topo/base/topo.h>
 #include <uct/api/uct.h>
 #include <uct/api/v2/uct_v2.h>
@@ -69,3 +72,65 @@ UCS_TEST_P(test_uct_query, query_perf)
 }
 
 UCT_INSTANTIATE_TEST_CASE(test_uct_query)
+
+
+class test_uct_query_calib : public test_uct_query {
+protected:
+    virtual void init()
+    {
+        if (!has_mm() && !has_cma() && !has_transport("knem")) {
+            UCS_TEST_SKIP_R("not a shared memory transport");
+        }
+
+        test_uct_query::init();
+    }
+
+    virtual void cleanup()
+    {
+        char path[PATH_MAX];
+
+        ucs_fill_filename_template(CACHE_TMPL, path, sizeof(path));
+        unlink(path);
+        test_uct_query::cleanup();
+    }
+
+    static void estimate_perf(const entity &e, uct_perf_attr_t &perf_attr)
+    {
+        perf_attr.field_mask = UCT_PERF_ATTR_FIELD_OPERATION |
+                               UCT_PERF_ATTR_FIELD_SEND_PRE_OVERHEAD |
+                               UCT_PERF_ATTR_FIELD_BANDWIDTH;
+        perf_attr.operation  = UCT_EP_OP_PUT_ZCOPY;
+        ASSERT_UCS_OK(uct_iface_estimate_perf(e.iface(), &perf_attr));
+    }
+
+    static const char *CACHE_TMPL;
+};
+
+const char *test_uct_query_calib::CACHE_TMPL = "/tmp/ucx_test_sm_calib_%p";
+
+UCS_TEST_P(test_uct_query_calib, estimate_perf, "SM_CALIBRATE?=y",
+           "SM_CALIBRATE_CACHE?=/tmp/ucx_test_sm_calib_%p")
+{
+    uct_perf_attr_t perf_attr, receiver_perf_attr;
+
+    estimate_perf(sender(), perf_attr);
+
+    EXPECT_GT(perf_attr.bandwidth.dedicated, 0);
+    EXPECT_GE(perf_attr.send_pre_overhead, 0);
+
+    /* Results are cached for other interfaces */
+    char path[PATH_MAX];
+    ucs_fill_filename_template(CACHE_TMPL, path, sizeof(path));
+    std::ifstream cache(path);
+    std::string line;
+    ASSERT_TRUE(std::getline(cache, line).good()) << path;
+    UCS_TEST_MESSAGE << line;
+
+    estimate_perf(receiver(), receiver_perf_attr);
+    EXPECT_EQ(perf_attr.bandwidth.dedicated,
+              receiver_perf_attr.bandwidth.dedicated);
+    EXPECT_EQ(perf_attr.send_pre_overhead,
+              receiver_perf_attr.send_pre_overhead);
+}
+
+UCT_INSTANTIATE_TEST_CASE(test_uct_query_calib)